@@ -95,11 +95,8 @@ size_t CommonUtils::getSetPower(ScMemoryContext * ms_context, ScAddr const & set
 {
   SC_CHECK_PARAM(set, "Invalid set address passed to `getSetPower`");
 
-  int power = 0;
   ScIterator3Ptr iterator3 = ms_context->CreateIterator3(set, ScType::ConstPermPosArc, ScType::Unknown);
-  while (iterator3->Next())
-    power++;
-  return power;
+  return iterator3->Count();
 }
 
 bool CommonUtils::isEmpty(ScMemoryContext * ms_context, ScAddr const & set)
@@ -107,7 +104,7 @@ bool CommonUtils::isEmpty(ScMemoryContext * ms_context, ScAddr const & set)
   SC_CHECK_PARAM(set, "Invalid set address to `isEmpty`");
 
   ScIterator3Ptr iterator3 = ms_context->CreateIterator3(set, ScType::ConstPermPosArc, ScType::Unknown);
-  return !iterator3->Next();
+  return iterator3->Count(1) == 0;
 }
 
 std::string CommonUtils::getAddrHashString(ScAddr const & scAddr)
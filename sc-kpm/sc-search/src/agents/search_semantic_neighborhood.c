@@ -6,6 +6,7 @@
 
 #include "search_semantic_neighborhood.h"
 #include "search_keynodes.h"
+#include "search_cache.h"
 #include "search.h"
 
 #include <stdio.h>
@@ -315,6 +316,15 @@ sc_result agent_search_full_semantic_neighborhood(sc_event_subscription const *
     arc = sc_memory_arc_new(s_default_ctx, sc_type_const_perm_pos_arc, keynode_rrel_main_key_sc_element, arc);
     SYSTEM_ELEMENT(s_default_ctx, arc);
 
+    if (search_cache_restore(keynode_action_full_semantic_neighborhood, element, result) == SC_TRUE)
+    {
+      sc_iterator3_free(it1);
+
+      connect_result_to_action(s_default_ctx, action, result);
+      finish_action(s_default_ctx, action);
+      return SC_RESULT_OK;
+    }
+
     search_translation(element, result, sys_off);
     search_arc_components(element, result, sys_off);
 
@@ -687,6 +697,8 @@ sc_result agent_search_full_semantic_neighborhood(sc_event_subscription const *
       }
     }
     sc_iterator3_free(it2);
+
+    search_cache_store(keynode_action_full_semantic_neighborhood, element, result);
   }
   sc_iterator3_free(it1);
 
@@ -12,6 +12,7 @@
 #include <sc-common/sc_keynodes.h>
 
 #include "search_agents.h"
+#include "search_cache.h"
 #include "search_keynodes.h"
 
 sc_memory_context * s_default_ctx = 0;
@@ -40,6 +41,8 @@ sc_result sc_module_initialize_with_init_memory_generated_structure(sc_addr cons
   if (search_keynodes_initialize(s_default_ctx, init_memory_generated_structure) != SC_RESULT_OK)
     return SC_RESULT_ERROR;
 
+  search_cache_initialize();
+
   event_action_search_all_outgoing_arcs = sc_event_subscription_new(
       s_default_ctx,
       keynode_action_initiated,
@@ -183,5 +186,7 @@ sc_result sc_module_shutdown()
   if (event_action_search_links_of_relation_connected_with_element)
     sc_event_subscription_destroy(event_action_search_links_of_relation_connected_with_element);
 
+  search_cache_shutdown();
+
   return SC_RESULT_OK;
 }
@@ -0,0 +1,343 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "search_cache.h"
+
+#include <glib.h>
+
+#include <sc-core/sc_keynodes.h>
+#include <sc-core/sc_memory_headers.h>
+
+#include <sc-common/sc_keynodes.h>
+#include <sc-common/sc_defines.h>
+
+#include "search.h"
+
+typedef struct _search_cache_key
+{
+  sc_addr agent_action_class;
+  sc_addr argument;
+} search_cache_key;
+
+//! Record of sc-element which cached search results depend on
+typedef struct _search_cache_dependency
+{
+  sc_event_subscription * generate_subscription;
+  sc_event_subscription * erase_subscription;
+  GHashTable * keys;  // keys of cached search results that contain sc-element
+} search_cache_dependency;
+
+// Subscriptions are destroyed only outside of cache lock: sc-event callbacks are called under monitors of
+// subscriptions, so destroying of them under cache lock may deadlock with callback waiting for this lock.
+static GMutex search_cache_mutex;
+static GHashTable * search_cache_entries = null_ptr;       // search_cache_key -> GArray of sc-addrs
+static GHashTable * search_cache_dependencies = null_ptr;  // sc-addr hash -> search_cache_dependency
+static sc_uint64 search_cache_hits_count = 0;
+static sc_uint64 search_cache_misses_count = 0;
+
+#define SEARCH_CACHE_ADDR_KEY(addr) GUINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(addr))
+
+guint _search_cache_key_hash(gconstpointer key)
+{
+  search_cache_key const * cache_key = key;
+  return SC_ADDR_LOCAL_TO_INT(cache_key->agent_action_class) * 31u ^ SC_ADDR_LOCAL_TO_INT(cache_key->argument);
+}
+
+gboolean _search_cache_key_equal(gconstpointer key, gconstpointer other_key)
+{
+  search_cache_key const * cache_key = key;
+  search_cache_key const * other_cache_key = other_key;
+  return SC_ADDR_IS_EQUAL(cache_key->agent_action_class, other_cache_key->agent_action_class)
+         && SC_ADDR_IS_EQUAL(cache_key->argument, other_cache_key->argument);
+}
+
+search_cache_key * _search_cache_key_new(search_cache_key const * key)
+{
+  search_cache_key * new_key = g_new(search_cache_key, 1);
+  *new_key = *key;
+  return new_key;
+}
+
+void _search_cache_entry_free(gpointer entry)
+{
+  g_array_unref((GArray *)entry);
+}
+
+sc_bool _search_cache_is_action(sc_addr element)
+{
+  return sc_helper_check_arc(s_default_ctx, keynode_action, element, sc_type_const_perm_pos_arc);
+}
+
+sc_result _search_cache_on_connector_changed(
+    sc_event_subscription const * event_subscription,
+    sc_addr user_addr,
+    sc_addr connector_addr,
+    sc_type connector_type,
+    sc_addr other_addr)
+{
+  // sc-connectors from result structures, actions and other system sc-elements don't change semantic neighborhood
+  if (IS_SYSTEM_ELEMENT(s_default_ctx, other_addr) || _search_cache_is_action(other_addr) == SC_TRUE)
+    return SC_RESULT_OK;
+
+  sc_addr const element = sc_event_subscription_get_element(event_subscription);
+
+  g_mutex_lock(&search_cache_mutex);
+  search_cache_dependency * dependency =
+      search_cache_dependencies == null_ptr
+          ? null_ptr
+          : g_hash_table_lookup(search_cache_dependencies, SEARCH_CACHE_ADDR_KEY(element));
+  if (dependency != null_ptr)
+  {
+    GHashTableIter iter;
+    gpointer key;
+    g_hash_table_iter_init(&iter, dependency->keys);
+    while (g_hash_table_iter_next(&iter, &key, null_ptr))
+      g_hash_table_remove(search_cache_entries, key);
+    g_hash_table_remove_all(dependency->keys);
+  }
+  g_mutex_unlock(&search_cache_mutex);
+
+  return SC_RESULT_OK;
+}
+
+search_cache_dependency * _search_cache_dependency_new(sc_addr element)
+{
+  search_cache_dependency * dependency = g_new0(search_cache_dependency, 1);
+  dependency->keys = g_hash_table_new_full(_search_cache_key_hash, _search_cache_key_equal, g_free, null_ptr);
+  dependency->generate_subscription = sc_event_subscription_with_user_new(
+      s_default_ctx,
+      element,
+      sc_event_after_generate_connector_addr,
+      0,
+      null_ptr,
+      _search_cache_on_connector_changed,
+      null_ptr);
+  dependency->erase_subscription = sc_event_subscription_with_user_new(
+      s_default_ctx,
+      element,
+      sc_event_before_erase_connector_addr,
+      0,
+      null_ptr,
+      _search_cache_on_connector_changed,
+      null_ptr);
+  return dependency;
+}
+
+void _search_cache_dependency_free(gpointer data)
+{
+  search_cache_dependency * dependency = data;
+  g_hash_table_destroy(dependency->keys);
+  g_free(dependency);
+}
+
+void _search_cache_tables_new(GHashTable ** entries, GHashTable ** dependencies)
+{
+  *entries = g_hash_table_new_full(_search_cache_key_hash, _search_cache_key_equal, g_free, _search_cache_entry_free);
+  *dependencies = g_hash_table_new_full(g_direct_hash, g_direct_equal, null_ptr, _search_cache_dependency_free);
+}
+
+//! Replaces tables of cache by empty ones, returned tables must be destroyed by `_search_cache_tables_free`
+void _search_cache_tables_take(GHashTable ** entries, GHashTable ** dependencies)
+{
+  *entries = search_cache_entries;
+  *dependencies = search_cache_dependencies;
+  _search_cache_tables_new(&search_cache_entries, &search_cache_dependencies);
+}
+
+void _search_cache_tables_free(GHashTable * entries, GHashTable * dependencies)
+{
+  if (dependencies != null_ptr)
+  {
+    GHashTableIter iter;
+    gpointer value;
+    g_hash_table_iter_init(&iter, dependencies);
+    while (g_hash_table_iter_next(&iter, null_ptr, &value))
+    {
+      search_cache_dependency * dependency = value;
+      sc_event_subscription_destroy(dependency->generate_subscription);
+      sc_event_subscription_destroy(dependency->erase_subscription);
+    }
+    g_hash_table_destroy(dependencies);
+  }
+
+  if (entries != null_ptr)
+    g_hash_table_destroy(entries);
+}
+
+void search_cache_initialize()
+{
+  g_mutex_lock(&search_cache_mutex);
+  _search_cache_tables_new(&search_cache_entries, &search_cache_dependencies);
+  search_cache_hits_count = 0;
+  search_cache_misses_count = 0;
+  g_mutex_unlock(&search_cache_mutex);
+}
+
+void search_cache_shutdown()
+{
+  g_mutex_lock(&search_cache_mutex);
+  GHashTable * entries = search_cache_entries;
+  GHashTable * dependencies = search_cache_dependencies;
+  search_cache_entries = null_ptr;
+  search_cache_dependencies = null_ptr;
+  g_mutex_unlock(&search_cache_mutex);
+
+  _search_cache_tables_free(entries, dependencies);
+}
+
+sc_bool search_cache_restore(sc_addr agent_action_class, sc_addr argument, sc_addr result)
+{
+  search_cache_key const key = {agent_action_class, argument};
+
+  g_mutex_lock(&search_cache_mutex);
+  GArray * elements = search_cache_entries == null_ptr ? null_ptr : g_hash_table_lookup(search_cache_entries, &key);
+  if (elements != null_ptr)
+    g_array_ref(elements);
+  g_mutex_unlock(&search_cache_mutex);
+
+  sc_bool is_valid = elements != null_ptr;
+  for (guint i = 0; is_valid && i < elements->len; ++i)
+    is_valid = sc_memory_is_element(s_default_ctx, g_array_index(elements, sc_addr, i));
+
+  if (is_valid)
+  {
+    // sc-elements of cached result are unique, so they are appended into new result structure without checks
+    for (guint i = 0; i < elements->len; ++i)
+    {
+      sc_addr const arc =
+          sc_memory_arc_new(s_default_ctx, sc_type_const_perm_pos_arc, result, g_array_index(elements, sc_addr, i));
+      SYSTEM_ELEMENT(s_default_ctx, arc);
+    }
+  }
+
+  g_mutex_lock(&search_cache_mutex);
+  if (is_valid)
+    ++search_cache_hits_count;
+  else
+  {
+    ++search_cache_misses_count;
+    // some sc-element of cached result has been erased without events on other sc-elements of this result
+    if (elements != null_ptr && search_cache_entries != null_ptr)
+      g_hash_table_remove(search_cache_entries, &key);
+  }
+  g_mutex_unlock(&search_cache_mutex);
+
+  if (elements != null_ptr)
+    g_array_unref(elements);
+
+  return is_valid;
+}
+
+void search_cache_store(sc_addr agent_action_class, sc_addr argument, sc_addr result)
+{
+  search_cache_key const key = {agent_action_class, argument};
+
+  // argument is not a part of result, but its sc-connectors change result too
+  GArray * elements = g_array_new(FALSE, FALSE, sizeof(sc_addr));
+  GArray * dependency_elements = g_array_new(FALSE, FALSE, sizeof(sc_addr));
+  g_array_append_val(dependency_elements, argument);
+
+  sc_iterator3 * it3 = sc_iterator3_f_a_a_new(s_default_ctx, result, sc_type_const_perm_pos_arc, 0);
+  while (sc_iterator3_next(it3) == SC_TRUE)
+  {
+    sc_addr const element = sc_iterator3_value(it3, 2);
+    if (SC_ADDR_IS_EQUAL(element, argument))
+      continue;
+
+    g_array_append_val(elements, element);
+    // actions are finished after their results are stored, so their sc-connectors aren't tracked
+    if (_search_cache_is_action(element) == SC_FALSE)
+      g_array_append_val(dependency_elements, element);
+  }
+  sc_iterator3_free(it3);
+
+  GHashTable * taken_entries = null_ptr;
+  GHashTable * taken_dependencies = null_ptr;
+
+  // find sc-elements without subscriptions
+  GArray * new_elements = g_array_new(FALSE, FALSE, sizeof(sc_addr));
+  g_mutex_lock(&search_cache_mutex);
+  if (search_cache_dependencies != null_ptr)
+  {
+    if (g_hash_table_size(search_cache_entries) >= SEARCH_CACHE_MAX_ENTRIES_COUNT
+        || g_hash_table_size(search_cache_dependencies) + dependency_elements->len
+               > SEARCH_CACHE_MAX_DEPENDENCIES_COUNT)
+      _search_cache_tables_take(&taken_entries, &taken_dependencies);
+
+    for (guint i = 0; i < dependency_elements->len; ++i)
+    {
+      sc_addr const element = g_array_index(dependency_elements, sc_addr, i);
+      if (!g_hash_table_contains(search_cache_dependencies, SEARCH_CACHE_ADDR_KEY(element)))
+        g_array_append_val(new_elements, element);
+    }
+  }
+  g_mutex_unlock(&search_cache_mutex);
+
+  GPtrArray * new_dependencies = g_ptr_array_new();
+  for (guint i = 0; i < new_elements->len; ++i)
+    g_ptr_array_add(new_dependencies, _search_cache_dependency_new(g_array_index(new_elements, sc_addr, i)));
+
+  GPtrArray * rejected_dependencies = g_ptr_array_new();
+
+  g_mutex_lock(&search_cache_mutex);
+  sc_bool is_subscribed = search_cache_dependencies != null_ptr;
+  for (guint i = 0; i < new_elements->len; ++i)
+  {
+    search_cache_dependency * dependency = g_ptr_array_index(new_dependencies, i);
+    gpointer const element_key = SEARCH_CACHE_ADDR_KEY(g_array_index(new_elements, sc_addr, i));
+    // sc-element may be subscribed by concurrent storing of other result
+    if (is_subscribed == SC_FALSE || g_hash_table_contains(search_cache_dependencies, element_key))
+      g_ptr_array_add(rejected_dependencies, dependency);
+    else
+      g_hash_table_insert(search_cache_dependencies, element_key, dependency);
+  }
+
+  // result isn't stored if cache has been cleared concurrently and some of its sc-elements aren't subscribed
+  for (guint i = 0; is_subscribed && i < dependency_elements->len; ++i)
+  {
+    sc_addr const element = g_array_index(dependency_elements, sc_addr, i);
+    is_subscribed = g_hash_table_contains(search_cache_dependencies, SEARCH_CACHE_ADDR_KEY(element));
+  }
+
+  if (is_subscribed)
+  {
+    for (guint i = 0; i < dependency_elements->len; ++i)
+    {
+      sc_addr const element = g_array_index(dependency_elements, sc_addr, i);
+      search_cache_dependency * dependency =
+          g_hash_table_lookup(search_cache_dependencies, SEARCH_CACHE_ADDR_KEY(element));
+      g_hash_table_add(dependency->keys, _search_cache_key_new(&key));
+    }
+    g_hash_table_insert(search_cache_entries, _search_cache_key_new(&key), g_array_ref(elements));
+  }
+  g_mutex_unlock(&search_cache_mutex);
+
+  for (guint i = 0; i < rejected_dependencies->len; ++i)
+  {
+    search_cache_dependency * dependency = g_ptr_array_index(rejected_dependencies, i);
+    sc_event_subscription_destroy(dependency->generate_subscription);
+    sc_event_subscription_destroy(dependency->erase_subscription);
+    _search_cache_dependency_free(dependency);
+  }
+
+  _search_cache_tables_free(taken_entries, taken_dependencies);
+
+  g_ptr_array_free(rejected_dependencies, TRUE);
+  g_ptr_array_free(new_dependencies, TRUE);
+  g_array_free(new_elements, TRUE);
+  g_array_free(dependency_elements, TRUE);
+  g_array_unref(elements);
+}
+
+void search_cache_get_stat(search_cache_stat * stat)
+{
+  g_mutex_lock(&search_cache_mutex);
+  stat->hits_count = search_cache_hits_count;
+  stat->misses_count = search_cache_misses_count;
+  stat->entries_count = search_cache_entries == null_ptr ? 0 : g_hash_table_size(search_cache_entries);
+  stat->dependencies_count = search_cache_dependencies == null_ptr ? 0 : g_hash_table_size(search_cache_dependencies);
+  g_mutex_unlock(&search_cache_mutex);
+}
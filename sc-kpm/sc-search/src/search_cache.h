@@ -0,0 +1,60 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#ifndef _search_cache_h_
+#define _search_cache_h_
+
+#include <sc-core/sc_memory.h>
+
+//! Maximum number of search results stored in cache, cache is cleared if it is exceeded
+#define SEARCH_CACHE_MAX_ENTRIES_COUNT 1000
+//! Maximum number of sc-elements which cached search results depend on, cache is cleared if it is exceeded
+#define SEARCH_CACHE_MAX_DEPENDENCIES_COUNT 100000
+
+/*! Statistics of search results cache
+ */
+typedef struct _search_cache_stat
+{
+  sc_uint64 hits_count;    // number of search results restored from cache
+  sc_uint64 misses_count;  // number of search results not found in cache
+  sc_uint32 entries_count;
+  sc_uint32 dependencies_count;
+} search_cache_stat;
+
+/*! Initializes cache of search results. Each result is stored by action class of search agent and argument of action.
+ * Cached result is invalidated if some sc-connector is generated or erased for any of sc-elements of this result.
+ * @remarks Result is invalidated by sc-events of these sc-connectors, so until the sc-events are processed, the result
+ * is restored without changes made by them. Only erased sc-elements of result are checked when it is restored.
+ */
+void search_cache_initialize();
+
+/*! Clears cache of search results and unsubscribes from events of sc-elements of cached results.
+ */
+void search_cache_shutdown();
+
+/*! Appends sc-elements of cached search result into the specified result structure. Result is restored only if all
+ * its sc-elements exist, it may not contain sc-connectors whose sc-events are not processed yet.
+ * @param agent_action_class sc-address of action class of search agent.
+ * @param argument sc-address of argument of action.
+ * @param result sc-address of result structure.
+ * @returns SC_TRUE, if search result is found in cache; otherwise SC_FALSE.
+ */
+sc_bool search_cache_restore(sc_addr agent_action_class, sc_addr argument, sc_addr result);
+
+/*! Stores sc-elements of the specified result structure into cache and subscribes to events of these sc-elements to
+ * invalidate stored result.
+ * @param agent_action_class sc-address of action class of search agent.
+ * @param argument sc-address of argument of action.
+ * @param result sc-address of result structure.
+ */
+void search_cache_store(sc_addr agent_action_class, sc_addr argument, sc_addr result);
+
+/*! Gets statistics of search results cache.
+ * @param stat A pointer to statistics to fill.
+ */
+void search_cache_get_stat(search_cache_stat * stat);
+
+#endif
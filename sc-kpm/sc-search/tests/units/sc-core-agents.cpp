@@ -6,14 +6,40 @@
 
 #include <sc-memory/test/sc_test.hpp>
 
+#include <chrono>
+#include <functional>
+#include <thread>
+
 extern "C"
 {
 #include <sc-common/sc_keynodes.h>
 #include "search.h"
+#include "search_cache.h"
 #include "search_keynodes.h"
 #include "search_agents.h"
 }
 
+namespace
+{
+//! Waits until condition is satisfied, because sc-agents and sc-events are processed by other threads
+bool WaitFor(std::function<bool()> const & isSatisfied)
+{
+  for (size_t i = 0; i < 500 && !isSatisfied(); ++i)
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+  return isSatisfied();
+}
+
+bool WaitActionFinished(sc_memory_context * context, sc_addr action)
+{
+  return WaitFor(
+      [context, action]()
+      {
+        return sc_helper_check_arc(context, keynode_action_finished, action, sc_type_const_perm_pos_arc) == SC_TRUE;
+      });
+}
+}  // namespace
+
 TEST_F(ScMemoryTest, agent_search_all_const_pos_outgoing_arc)
 {
   sc_memory_context * context = m_ctx->GetRealContext();
@@ -421,6 +447,91 @@ TEST_F(ScMemoryTest, agent_search_full_semantic_neighborhood)
   sc_module_shutdown();
 }
 
+TEST_F(ScMemoryTest, agent_search_full_semantic_neighborhood_cached)
+{
+  sc_memory_context * context = m_ctx->GetRealContext();
+
+  sc_addr init_memory_generated_structure;
+  SC_ADDR_MAKE_EMPTY(init_memory_generated_structure);
+
+  sc_common_keynodes_initialize(context, init_memory_generated_structure);
+  EXPECT_EQ(sc_module_initialize_with_init_memory_generated_structure(init_memory_generated_structure), SC_RESULT_OK);
+
+  sc_addr const elementAddr = sc_memory_node_new(context, sc_type_node | sc_type_const);
+  sc_addr const classAddr = sc_memory_node_new(context, sc_type_node | sc_type_const | sc_type_node_class);
+  sc_memory_arc_new(context, sc_type_const_perm_pos_arc, classAddr, elementAddr);
+
+  auto const & searchNeighborhood = [&]() -> size_t
+  {
+    sc_addr const action = sc_memory_node_new(context, sc_type_node | sc_type_const);
+    sc_memory_arc_new(context, sc_type_const_perm_pos_arc, keynode_action, action);
+    sc_memory_arc_new(context, sc_type_const_perm_pos_arc, keynode_action_full_semantic_neighborhood, action);
+    sc_memory_arc_new(context, sc_type_const_perm_pos_arc, action, elementAddr);
+    sc_memory_arc_new(context, sc_type_const_perm_pos_arc, keynode_action_initiated, action);
+
+    EXPECT_TRUE(WaitActionFinished(context, action));
+
+    sc_iterator5 * it5 = sc_iterator5_f_a_a_a_f_new(
+        context,
+        action,
+        sc_type_const_common_arc,
+        sc_type_node | sc_type_const,
+        sc_type_const_perm_pos_arc,
+        keynode_nrel_result);
+    EXPECT_TRUE(sc_iterator5_next(it5));
+    sc_addr const structure_addr = sc_iterator5_value(it5, 2);
+    sc_iterator5_free(it5);
+
+    size_t count = 0;
+    sc_iterator3 * it3 = sc_iterator3_f_a_a_new(context, structure_addr, sc_type_const_perm_pos_arc, 0);
+    while (sc_iterator3_next(it3))
+      ++count;
+    sc_iterator3_free(it3);
+    return count;
+  };
+
+  search_cache_stat stat;
+  size_t const elementsCount = searchNeighborhood();
+  search_cache_get_stat(&stat);
+  EXPECT_EQ(stat.hits_count, 0u);
+  EXPECT_EQ(stat.misses_count, 1u);
+  EXPECT_EQ(stat.entries_count, 1u);
+
+  // result is restored from cache, actions connected with sc-element don't invalidate it
+  EXPECT_EQ(searchNeighborhood(), elementsCount);
+  search_cache_get_stat(&stat);
+  EXPECT_EQ(stat.hits_count, 1u);
+  EXPECT_EQ(stat.misses_count, 1u);
+
+  // result is invalidated by sc-events of new sc-arc of sc-element, so it is restored until they are processed
+  sc_memory_context_pending_begin(context);
+  sc_addr const otherClassAddr = sc_memory_node_new(context, sc_type_node | sc_type_const | sc_type_node_class);
+  sc_memory_arc_new(context, sc_type_const_perm_pos_arc, otherClassAddr, elementAddr);
+
+  sc_addr const resultAddr = sc_memory_node_new(context, sc_type_node | sc_type_const);
+  EXPECT_TRUE(search_cache_restore(keynode_action_full_semantic_neighborhood, elementAddr, resultAddr));
+  EXPECT_FALSE(sc_helper_check_arc(context, resultAddr, otherClassAddr, sc_type_const_perm_pos_arc));
+  search_cache_get_stat(&stat);
+  EXPECT_EQ(stat.hits_count, 2u);
+  EXPECT_EQ(stat.entries_count, 1u);
+
+  sc_memory_context_pending_end(context);
+  EXPECT_TRUE(WaitFor(
+      []()
+      {
+        search_cache_stat currentStat;
+        search_cache_get_stat(&currentStat);
+        return currentStat.entries_count == 0;
+      }));
+
+  EXPECT_GT(searchNeighborhood(), elementsCount);
+  search_cache_get_stat(&stat);
+  EXPECT_EQ(stat.hits_count, 2u);
+  EXPECT_EQ(stat.misses_count, 2u);
+
+  sc_module_shutdown();
+}
+
 TEST_F(ScMemoryTest, agent_search_links_of_relation_connected_with_element)
 {
   sc_memory_context * context = m_ctx->GetRealContext();
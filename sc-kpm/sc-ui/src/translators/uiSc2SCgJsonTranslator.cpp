@@ -11,75 +11,114 @@
 #include "uiTranslators.h"
 #include "uiUtils.h"
 
-uiSc2SCgJsonTranslator::uiSc2SCgJsonTranslator() {}
-
-uiSc2SCgJsonTranslator::~uiSc2SCgJsonTranslator() {}
-
-void uiSc2SCgJsonTranslator::runImpl()
+namespace
 {
-  bool first = true;
-  sc_type el_type = 0;
-  sc_addr addr;
-  tStringStringMap attrs;
+//! Facts about translated sc-element collected before serialization
+struct ScgJsonElementInfo
+{
+  sc_type type = 0;
+  sc_addr begin = {};
+  sc_addr end = {};
+  bool isTranslated = false;
+};
 
-  mOutputData = "[";
+//! Maximal length of serialized sc-element, it is used to preallocate output buffer
+size_t constexpr SCG_JSON_ELEMENT_MAX_SIZE = 100;
 
-  sc_iterator3 * it = sc_iterator3_f_a_a_new(s_default_ctx, mInputConstructionAddr, sc_type_const_perm_pos_arc, 0);
-  while (sc_iterator3_next(it) == SC_TRUE)
-  {
-    el_type = 0;
-    addr = sc_iterator3_value(it, 2);
+void AppendAttribute(String & output, char const * name, sc_uint32 value, bool isFirst = false)
+{
+  if (!isFirst)
+    output += ", ";
+  output += '"';
+  output += name;
+  output += "\": \"";
+  output += std::to_string(value);
+  output += '"';
+}
 
-    //! TODO add error logging
-    if (sc_memory_get_element_type(s_default_ctx, addr, &el_type) != SC_RESULT_OK)
-      continue;
+void AppendAttribute(String & output, char const * name, char const * value)
+{
+  output += ", \"";
+  output += name;
+  output += "\": \"";
+  output += value;
+  output += '"';
+}
 
-    attrs.clear();
+}  // namespace
 
-    attrs["id"] = buildId(addr);
-    StringStream ss;
-    ss << el_type;
-    attrs["el_type"] = ss.str();
-    if (el_type & sc_type_node)
-      attrs["type"] = "node";
+uiSc2SCgJsonTranslator::uiSc2SCgJsonTranslator() {}
 
-    if (el_type & sc_type_arc_mask)
-    {
-      attrs["type"] = "arc";
+uiSc2SCgJsonTranslator::~uiSc2SCgJsonTranslator() {}
 
-      sc_addr beg_addr;
-      if (sc_memory_get_arc_begin(s_default_ctx, addr, &beg_addr) != SC_RESULT_OK)
-        continue;  //! TODO error logging
-      sc_addr end_addr;
-      if (sc_memory_get_arc_end(s_default_ctx, addr, &end_addr) != SC_RESULT_OK)
-        continue;  //! TODO error logging
+void uiSc2SCgJsonTranslator::runImpl()
+{
+  tScAddrVector addrs;
+  sc_iterator3 * it = sc_iterator3_f_a_a_new(s_default_ctx, mInputConstructionAddr, sc_type_const_perm_pos_arc, 0);
+  while (sc_iterator3_next(it) == SC_TRUE)
+    addrs.push_back(sc_iterator3_value(it, 2));
+  sc_iterator3_free(it);
 
-      attrs["begin"] = buildId(beg_addr);
-      attrs["end"] = buildId(end_addr);
-    }
+  // collect facts about sc-elements in parallel
+  std::vector<ScgJsonElementInfo> infos(addrs.size());
+  processInParallel(
+      addrs.size(),
+      [&addrs, &infos](size_t beginIndex, size_t endIndex)
+      {
+        for (size_t i = beginIndex; i < endIndex; ++i)
+        {
+          ScgJsonElementInfo & info = infos[i];
+
+          //! TODO add error logging
+          if (sc_memory_get_element_type(s_default_ctx, addrs[i], &info.type) != SC_RESULT_OK)
+            continue;
+
+          if (info.type & sc_type_arc_mask)
+          {
+            if (sc_memory_get_arc_begin(s_default_ctx, addrs[i], &info.begin) != SC_RESULT_OK)
+              continue;  //! TODO error logging
+            if (sc_memory_get_arc_end(s_default_ctx, addrs[i], &info.end) != SC_RESULT_OK)
+              continue;  //! TODO error logging
+          }
+
+          info.isTranslated = true;
+        }
+      });
+
+  // serialize sc-elements in one pass, attributes are written in alphabetical order of their names
+  mOutputData.clear();
+  mOutputData.reserve(2 + addrs.size() * SCG_JSON_ELEMENT_MAX_SIZE);
+  mOutputData += "[";
 
-    if (el_type & sc_type_node_link)
-    {
-      attrs["type"] = "link";
-    }
+  bool first = true;
+  for (size_t i = 0; i < addrs.size(); ++i)
+  {
+    ScgJsonElementInfo const & info = infos[i];
+    if (!info.isTranslated)
+      continue;
 
     if (!first)
       mOutputData += ", ";
 
     mOutputData += "{ ";
-    tStringStringMap::iterator itAttrs, itAttrsEnd = attrs.end();
-    for (itAttrs = attrs.begin(); itAttrs != itAttrsEnd; ++itAttrs)
-    {
-      if (itAttrs != attrs.begin())
-        mOutputData += ", ";
-      mOutputData += "\"" + itAttrs->first + "\": ";
-      mOutputData += "\"" + itAttrs->second + "\"";
-    }
+    bool const isArc = info.type & sc_type_arc_mask;
+    if (isArc)
+      AppendAttribute(mOutputData, "begin", SC_ADDR_LOCAL_TO_INT(info.begin), true);
+    AppendAttribute(mOutputData, "el_type", info.type, !isArc);
+    if (isArc)
+      AppendAttribute(mOutputData, "end", SC_ADDR_LOCAL_TO_INT(info.end));
+    AppendAttribute(mOutputData, "id", SC_ADDR_LOCAL_TO_INT(addrs[i]));
+
+    if (info.type & sc_type_node_link)
+      AppendAttribute(mOutputData, "type", "link");
+    else if (isArc)
+      AppendAttribute(mOutputData, "type", "arc");
+    else if (info.type & sc_type_node)
+      AppendAttribute(mOutputData, "type", "node");
     mOutputData += " }";
 
     first = false;
   }
-  sc_iterator3_free(it);
 
   mOutputData += "]";
 }
@@ -87,6 +87,7 @@ void uiSc2SCnJsonTranslator::runImpl()
   sc_iterator5_free(it5);
 
   CollectScStructureElementsInfo();
+  ResolveIdentifiers();
 
   ScJson results;
   for (auto const & keyword : mKeywordsList)
@@ -102,36 +103,57 @@ void uiSc2SCnJsonTranslator::runImpl()
 
 void uiSc2SCnJsonTranslator::CollectScStructureElementsInfo()
 {
+  struct ArcInfo
+  {
+    sc_addr addr;
+    sc_type type;
+    sc_addr begAddr;
+    sc_type begType;
+    sc_addr endAddr;
+    sc_type endType;
+    bool isValid;
+  };
+
+  // first collect information about arcs and their ends in parallel
+  std::vector<ArcInfo> arcsInfo;
+  arcsInfo.reserve(mEdges.size());
+  for (auto const & it : mEdges)
+    arcsInfo.push_back({it.first, it.second, {}, 0, {}, 0, false});
+
+  processInParallel(
+      arcsInfo.size(),
+      [&arcsInfo](size_t beginIndex, size_t endIndex)
+      {
+        for (size_t i = beginIndex; i < endIndex; ++i)
+        {
+          ArcInfo & arcInfo = arcsInfo[i];
+          // get begin/end addrs
+          if (sc_memory_get_arc_info(s_default_ctx, arcInfo.addr, &arcInfo.begAddr, &arcInfo.endAddr) != SC_RESULT_OK)
+            continue;  // @todo process errors
+
+          sc_memory_get_element_type(s_default_ctx, arcInfo.begAddr, &arcInfo.begType);
+          sc_memory_get_element_type(s_default_ctx, arcInfo.endAddr, &arcInfo.endType);
+          arcInfo.isValid = true;
+        }
+      });
+
   // now we need to iterate all arcs and collect output/incoming sc-arcs info
-  // first collect information about elements
   std::set<sc_addr> filtered;
-  for (auto const & it : mEdges)
+  for (auto const & arcInfo : arcsInfo)
   {
-    sc_addr const arcAddr = it.first;
+    if (!arcInfo.isValid)
+      continue;
 
-    // get begin/end addrs
-    sc_addr begAddr;
-    if (sc_memory_get_arc_begin(s_default_ctx, arcAddr, &begAddr) != SC_RESULT_OK)
-      continue;  // @todo process errors
-    sc_addr endAddr;
-    if (sc_memory_get_arc_end(s_default_ctx, arcAddr, &endAddr) != SC_RESULT_OK)
-      continue;  // @todo process errors
-
-    if (std::any_of(
-            mFilterList.cbegin(),
-            mFilterList.cend(),
-            [begAddr](sc_addr const & modifier)
-            {
-              return modifier == begAddr;
-            }))
+    sc_addr const begAddr = arcInfo.begAddr;
+    if (mFilterList.find(begAddr) != mFilterList.cend())
     {
-      filtered.insert(arcAddr);
-      filtered.insert(endAddr);
+      filtered.insert(arcInfo.addr);
+      filtered.insert(arcInfo.endAddr);
     }
 
-    ScStructureElementInfo * elInfo = ResolveStructureElementInfo(it.first, it.second);
-    ScStructureElementInfo * begInfo = ResolveStructureElementInfo(begAddr);
-    ScStructureElementInfo * endInfo = ResolveStructureElementInfo(endAddr);
+    ScStructureElementInfo * elInfo = ResolveStructureElementInfo(arcInfo.addr, arcInfo.type);
+    ScStructureElementInfo * begInfo = ResolveStructureElementInfo(begAddr, arcInfo.begType);
+    ScStructureElementInfo * endInfo = ResolveStructureElementInfo(arcInfo.endAddr, arcInfo.endType);
 
     elInfo->sourceInfo = begInfo;
     elInfo->targetInfo = endInfo;
@@ -148,6 +170,31 @@ void uiSc2SCnJsonTranslator::CollectScStructureElementsInfo()
   }
 }
 
+void uiSc2SCnJsonTranslator::ResolveIdentifiers()
+{
+  std::vector<ScStructureElementInfo *> elementsInfo;
+  elementsInfo.reserve(mStructureElementsInfo.size());
+  for (auto const & it : mStructureElementsInfo)
+  {
+    if (it.second != nullptr && !it.second->isIdtfResolved)
+      elementsInfo.push_back(it.second);
+  }
+
+  processInParallel(
+      elementsInfo.size(),
+      [this, &elementsInfo](size_t beginIndex, size_t endIndex)
+      {
+        for (size_t i = beginIndex; i < endIndex; ++i)
+          ResolveIdentifier(elementsInfo[i]);
+      });
+}
+
+void uiSc2SCnJsonTranslator::ResolveIdentifier(ScStructureElementInfo * elInfo) const
+{
+  elInfo->isIdtfFound = ui_translate_get_identifier(elInfo->addr, mOutputLanguageAddr, elInfo->idtf);
+  elInfo->isIdtfResolved = true;
+}
+
 void uiSc2SCnJsonTranslator::ResolveStructure(sc_addr structure_addr)
 {
   // find structures elements
@@ -218,6 +265,8 @@ ScStructureElementInfo * uiSc2SCnJsonTranslator::ResolveStructureElementInfo(sc_
   elInfo->addr = addr;
   elInfo->type = type;
   elInfo->isInTree = false;
+  elInfo->isIdtfResolved = false;
+  elInfo->isIdtfFound = false;
   mStructureElementsInfo[addr] = elInfo;
 
   return elInfo;
@@ -517,12 +566,12 @@ void uiSc2SCnJsonTranslator::ParseScElementInfo(ScStructureElementInfo * elInfo,
   if (!elInfo)
     return;
 
-  result[ScnTranslatorConstants::ADDR.data()] = std::stoi(uiTranslateFromSc::buildId(elInfo->addr));
-  String idtf;
-  bool idtf_exists = ui_translate_get_identifier(elInfo->addr, mOutputLanguageAddr, idtf);
-  if (idtf_exists)
+  result[ScnTranslatorConstants::ADDR.data()] = SC_ADDR_LOCAL_TO_INT(elInfo->addr);
+  if (!elInfo->isIdtfResolved)
+    ResolveIdentifier(elInfo);
+  if (elInfo->isIdtfFound)
   {
-    result[ScnTranslatorConstants::IDTF.data()] = idtf;
+    result[ScnTranslatorConstants::IDTF.data()] = elInfo->idtf;
   }
   else
   {
@@ -24,6 +24,11 @@ struct ScStructureElementInfo
   ScStructureElementInfoList structureElements;
 
   bool isInTree;
+
+  // identifier is resolved once for all occurrences of sc-element in translation
+  bool isIdtfResolved;
+  bool isIdtfFound;
+  String idtf;
 };
 
 /*!
@@ -48,6 +53,12 @@ protected:
   //! Collect sc-structure elements and store it
   void ResolveStructure(sc_addr structure_addr);
 
+  //! Resolve identifiers of all collected sc-elements in parallel
+  void ResolveIdentifiers();
+
+  //! Resolve identifier of specified element
+  void ResolveIdentifier(ScStructureElementInfo * elInfo) const;
+
   //! Generate json for specified element
   void ParseScnJsonSentence(ScStructureElementInfo * elInfo, int level, bool isStruct, ScJson & result);
 
@@ -7,7 +7,12 @@
 #include "uiTranslatorFromSc.h"
 #include "uiKeynodes.h"
 
+#include <algorithm>
+#include <thread>
+
 constexpr size_t MAX_TRIPLES_COUNT = 1000000;
+//! Minimal number of sc-elements processed by one thread, smaller ranges are processed by calling thread
+constexpr size_t MIN_ELEMENTS_COUNT_PER_THREAD = 1024;
 
 uiTranslateFromSc::uiTranslateFromSc() {}
 
@@ -43,23 +48,50 @@ void uiTranslateFromSc::translate(sc_addr const & input_addr, sc_addr const & fo
 
 void uiTranslateFromSc::collectObjects()
 {
+  // sc-elements are read by batches not larger than number of sc-arcs remaining to MAX_TRIPLES_COUNT, so iteration
+  // stops at the same sc-element as when each sc-element is checked right after it is read
+  tScAddrVector addrs;
+  std::vector<sc_type> types;
   sc_iterator3 * it = sc_iterator3_f_a_a_new(s_default_ctx, mInputConstructionAddr, sc_type_const_perm_pos_arc, 0);
   sc_uint32 i = 0;
-  while (sc_iterator3_next(it) == SC_TRUE && i != MAX_TRIPLES_COUNT)
+  bool isIterated = false;
+  while (!isIterated && i != MAX_TRIPLES_COUNT)
   {
-    sc_type el_type = 0;
-    sc_addr addr = sc_iterator3_value(it, 2);
-
-    //! TODO add error logging
-    if (sc_memory_get_element_type(s_default_ctx, addr, &el_type) != SC_RESULT_OK)
-      continue;
-
-    if (!(el_type & sc_type_arc_mask))
-      continue;
-
-    ++i;
-
-    mEdges[addr] = el_type;
+    size_t const batchSize = MAX_TRIPLES_COUNT - i;
+    addrs.clear();
+    while (addrs.size() != batchSize)
+    {
+      if (sc_iterator3_next(it) != SC_TRUE)
+      {
+        isIterated = true;
+        break;
+      }
+
+      addrs.push_back(sc_iterator3_value(it, 2));
+    }
+
+    types.assign(addrs.size(), 0);
+    processInParallel(
+        addrs.size(),
+        [&addrs, &types](size_t beginIndex, size_t endIndex)
+        {
+          for (size_t j = beginIndex; j < endIndex; ++j)
+          {
+            //! TODO add error logging
+            if (sc_memory_get_element_type(s_default_ctx, addrs[j], &types[j]) != SC_RESULT_OK)
+              types[j] = 0;
+          }
+        });
+
+    for (size_t j = 0; j < addrs.size(); ++j)
+    {
+      if (!(types[j] & sc_type_arc_mask))
+        continue;
+
+      ++i;
+
+      mEdges[addrs[j]] = types[j];
+    }
   }
   sc_iterator3_free(it);
 }
@@ -69,6 +101,30 @@ bool uiTranslateFromSc::isNeedToTranslate(sc_addr const & addr) const
   return mEdges.find(addr) != mEdges.end();
 }
 
+void uiTranslateFromSc::processInParallel(
+    size_t count,
+    std::function<void(size_t beginIndex, size_t endIndex)> const & processRange)
+{
+  size_t const threadsCount = std::min<size_t>(
+      std::max<size_t>(std::thread::hardware_concurrency(), 1), count / MIN_ELEMENTS_COUNT_PER_THREAD);
+  if (threadsCount <= 1)
+  {
+    processRange(0, count);
+    return;
+  }
+
+  size_t const rangeSize = (count + threadsCount - 1) / threadsCount;
+  std::vector<std::thread> threads;
+  threads.reserve(threadsCount - 1);
+  for (size_t beginIndex = rangeSize; beginIndex < count; beginIndex += rangeSize)
+    threads.emplace_back(processRange, beginIndex, std::min(beginIndex + rangeSize, count));
+
+  processRange(0, rangeSize);
+
+  for (auto & thread : threads)
+    thread.join();
+}
+
 String uiTranslateFromSc::buildId(sc_addr const & addr)
 {
   auto v = SC_ADDR_LOCAL_TO_INT(addr);
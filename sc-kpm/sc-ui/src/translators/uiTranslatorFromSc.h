@@ -7,6 +7,8 @@
 #ifndef _uiTranslatorFromSc_h_
 #define _uiTranslatorFromSc_h_
 
+#include <functional>
+
 #include "uiTypes.h"
 
 /*! Base class for translators that translate from SC-code to external
@@ -35,6 +37,15 @@ protected:
   //! Check if sc-element need to be translated
   bool isNeedToTranslate(sc_addr const & addr) const;
 
+  /*! Process range of indices [0, count) by several threads. Each thread processes its own subrange, so facts
+   * about different sc-elements can be collected without locks.
+   * @param count Number of processed indices
+   * @param processRange Function that processes subrange [beginIndex, endIndex)
+   */
+  static void processInParallel(
+      size_t count,
+      std::function<void(size_t beginIndex, size_t endIndex)> const & processRange);
+
 public:
   //! Build id from specified sc-addr
   static String buildId(sc_addr const & addr);
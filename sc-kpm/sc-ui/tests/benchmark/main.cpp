@@ -0,0 +1,107 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "benchmark/benchmark.h"
+
+#include <sc-memory/sc_memory.hpp>
+
+#include "ui.h"
+#include "uiKeynodes.h"
+#include "translators/uiSc2SCgJsonTranslator.h"
+#include "translators/uiSc2SCnJsonTranslator.h"
+
+size_t constexpr kStructureElementsCount = 100000;
+
+class TestTranslateStructure
+{
+public:
+  void Initialize(size_t elementsCount)
+  {
+    sc_memory_params params;
+    sc_memory_params_clear(&params);
+    params.clear = SC_TRUE;
+    params.storage = "test_repo";
+
+    ScMemory::LogMute();
+    ScMemory::Initialize(params);
+
+    m_ctx = std::make_unique<ScMemoryContext>();
+
+    ScAddr const & initMemoryGeneratedStructure = m_ctx->GenerateNode(ScType::ConstNodeStructure);
+    sc_module_initialize_with_init_memory_generated_structure(*initMemoryGeneratedStructure);
+
+    Setup(elementsCount);
+  }
+
+  void Shutdown()
+  {
+    sc_module_shutdown();
+    m_ctx.reset();
+
+    ScMemory::Shutdown(false);
+  }
+
+  //! Generates structure with keyword and sc-arcs from it to other sc-nodes, and action with this structure as result
+  void Setup(size_t elementsCount)
+  {
+    m_structureAddr = m_ctx->GenerateNode(ScType::ConstNodeStructure);
+    m_langAddr = m_ctx->GenerateNode(ScType::ConstNodeClass);
+
+    ScAddr const & keywordAddr = m_ctx->GenerateNode(ScType::ConstNode);
+    m_ctx->GenerateConnector(ScType::ConstPermPosArc, m_structureAddr, keywordAddr);
+    for (size_t i = 0; i < elementsCount / 2; ++i)
+    {
+      ScAddr const & nodeAddr = m_ctx->GenerateNode(ScType::ConstNode);
+      ScAddr const & arcAddr = m_ctx->GenerateConnector(ScType::ConstPermPosArc, keywordAddr, nodeAddr);
+      m_ctx->GenerateConnector(ScType::ConstPermPosArc, m_structureAddr, nodeAddr);
+      m_ctx->GenerateConnector(ScType::ConstPermPosArc, m_structureAddr, arcAddr);
+    }
+
+    ScAddr const & actionAddr = m_ctx->GenerateNode(ScType::ConstNode);
+    m_ctx->GenerateConnector(ScType::ConstPermPosArc, actionAddr, keywordAddr);
+    ScAddr const & resultArcAddr = m_ctx->GenerateConnector(ScType::ConstCommonArc, actionAddr, m_structureAddr);
+    m_ctx->GenerateConnector(ScType::ConstPermPosArc, ScAddr(keynode_action_nrel_result), resultArcAddr);
+  }
+
+  template <class TranslatorType>
+  void Run(sc_addr const & formatAddr)
+  {
+    TranslatorType translator;
+    translator.translate(*m_structureAddr, formatAddr, *m_langAddr);
+  }
+
+private:
+  std::unique_ptr<ScMemoryContext> m_ctx;
+  ScAddr m_structureAddr;
+  ScAddr m_langAddr;
+};
+
+void BM_TranslateStructureToSCgJson(benchmark::State & state)
+{
+  TestTranslateStructure test;
+  test.Initialize(kStructureElementsCount);
+
+  for (auto _ : state)
+    test.Run<uiSc2SCgJsonTranslator>(keynode_format_scg_json);
+
+  test.Shutdown();
+}
+
+void BM_TranslateStructureToSCnJson(benchmark::State & state)
+{
+  TestTranslateStructure test;
+  test.Initialize(kStructureElementsCount);
+
+  for (auto _ : state)
+    test.Run<uiSc2SCnJsonTranslator>(keynode_format_scn_json);
+
+  test.Shutdown();
+}
+
+BENCHMARK(BM_TranslateStructureToSCgJson)->Iterations(5)->Unit(benchmark::TimeUnit::kMillisecond);
+BENCHMARK(BM_TranslateStructureToSCnJson)->Iterations(5)->Unit(benchmark::TimeUnit::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,155 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include <sc-memory/test/sc_test.hpp>
+
+#include <sc-memory/sc_memory.hpp>
+
+#include "uiKeynodes.h"
+#include "ui.h"
+#include "translators/uiSc2SCgJsonTranslator.h"
+
+#include <nlohmann/json.hpp>
+
+using json = nlohmann::json;
+
+namespace
+{
+json TranslateToSCgJson(ScMemoryContext & context, sc_addr const & constructionAddr)
+{
+  sc_addr const langAddr = sc_memory_node_new(context.GetRealContext(), sc_type_const_node);
+
+  uiSc2SCgJsonTranslator translator;
+  translator.translate(constructionAddr, keynode_format_scg_json, langAddr);
+
+  ScTemplate translationTemplate;
+  translationTemplate.Quintuple(
+      ScAddr(constructionAddr),
+      ScType::VarCommonArc,
+      ScType::VarNodeLink >> "_translation_link",
+      ScType::VarPermPosArc,
+      ScAddr(keynode_nrel_translation));
+  ScTemplateSearchResult result;
+  EXPECT_TRUE(context.SearchByTemplate(translationTemplate, result));
+  EXPECT_EQ(result.Size(), 1u);
+
+  std::string translation;
+  EXPECT_TRUE(context.GetLinkContent(result[0]["_translation_link"], translation));
+  return json::parse(translation);
+}
+
+//! Builds SCg-json object of sc-element by reading its facts sequentially
+json BuildSCgJsonElement(sc_memory_context * context, sc_addr const & addr)
+{
+  sc_type type = 0;
+  EXPECT_EQ(sc_memory_get_element_type(context, addr, &type), SC_RESULT_OK);
+
+  json element{{"el_type", std::to_string(type)}, {"id", std::to_string(ScAddr(addr).Hash())}};
+  if (type & sc_type_node_link)
+    element["type"] = "link";
+  else if (type & sc_type_arc_mask)
+  {
+    sc_addr beginAddr, endAddr;
+    EXPECT_EQ(sc_memory_get_arc_begin(context, addr, &beginAddr), SC_RESULT_OK);
+    EXPECT_EQ(sc_memory_get_arc_end(context, addr, &endAddr), SC_RESULT_OK);
+    element["begin"] = std::to_string(ScAddr(beginAddr).Hash());
+    element["end"] = std::to_string(ScAddr(endAddr).Hash());
+    element["type"] = "arc";
+  }
+  else if (type & sc_type_node)
+    element["type"] = "node";
+
+  return element;
+}
+
+json BuildSCgJson(sc_memory_context * context, sc_addr const & constructionAddr)
+{
+  json elements = json::array();
+  sc_iterator3 * it = sc_iterator3_f_a_a_new(context, constructionAddr, sc_type_const_perm_pos_arc, 0);
+  while (sc_iterator3_next(it) == SC_TRUE)
+    elements.push_back(BuildSCgJsonElement(context, sc_iterator3_value(it, 2)));
+  sc_iterator3_free(it);
+
+  return elements;
+}
+
+void AddToConstruction(sc_memory_context * context, sc_addr const & constructionAddr, sc_addr const & addr)
+{
+  sc_memory_arc_new(context, sc_type_const_perm_pos_arc, constructionAddr, addr);
+}
+}  // namespace
+
+TEST_F(ScMemoryTest, test_scg_json_translation)
+{
+  sc_memory_context * context = m_ctx->GetRealContext();
+  sc_addr const structAddr = sc_memory_node_new(context, sc_type_node_structure | sc_type_const);
+  sc_module_initialize_with_init_memory_generated_structure(structAddr);
+
+  sc_addr const constructionAddr = sc_memory_node_new(context, sc_type_node_structure | sc_type_const);
+  sc_addr const nodeAddr = sc_memory_node_new(context, sc_type_const_node);
+  sc_addr const linkAddr = sc_memory_link_new(context);
+  sc_addr const arcAddr = sc_memory_arc_new(context, sc_type_const_common_arc, nodeAddr, linkAddr);
+  AddToConstruction(context, constructionAddr, nodeAddr);
+  AddToConstruction(context, constructionAddr, linkAddr);
+  AddToConstruction(context, constructionAddr, arcAddr);
+
+  json const translation = TranslateToSCgJson(*m_ctx, constructionAddr);
+  ASSERT_TRUE(translation.is_array());
+  ASSERT_EQ(translation.size(), 3u);
+
+  for (json const & element : translation)
+  {
+    std::string const & id = element["id"].get<std::string>();
+    if (id == std::to_string(ScAddr(nodeAddr).Hash()))
+    {
+      EXPECT_EQ(element["type"], "node");
+      EXPECT_EQ(element["el_type"], std::to_string(sc_type_const_node));
+    }
+    else if (id == std::to_string(ScAddr(linkAddr).Hash()))
+      EXPECT_EQ(element["type"], "link");
+    else
+    {
+      EXPECT_EQ(id, std::to_string(ScAddr(arcAddr).Hash()));
+      EXPECT_EQ(element["type"], "arc");
+      EXPECT_EQ(element["el_type"], std::to_string(sc_type_const_common_arc));
+      EXPECT_EQ(element["begin"], std::to_string(ScAddr(nodeAddr).Hash()));
+      EXPECT_EQ(element["end"], std::to_string(ScAddr(linkAddr).Hash()));
+    }
+  }
+
+  EXPECT_EQ(translation, BuildSCgJson(context, constructionAddr));
+
+  sc_module_shutdown();
+}
+
+TEST_F(ScMemoryTest, test_scg_json_translation_of_large_construction)
+{
+  sc_memory_context * context = m_ctx->GetRealContext();
+  sc_addr const structAddr = sc_memory_node_new(context, sc_type_node_structure | sc_type_const);
+  sc_module_initialize_with_init_memory_generated_structure(structAddr);
+
+  // facts about sc-elements of construction are collected in parallel if it has at least 2048 sc-elements
+  size_t const nodesCount = 3000;
+  sc_addr const constructionAddr = sc_memory_node_new(context, sc_type_node_structure | sc_type_const);
+  sc_addr prevNodeAddr = sc_memory_node_new(context, sc_type_const_node);
+  AddToConstruction(context, constructionAddr, prevNodeAddr);
+  for (size_t i = 1; i < nodesCount; ++i)
+  {
+    sc_addr const nodeAddr =
+        i % 10 == 0 ? sc_memory_link_new(context) : sc_memory_node_new(context, sc_type_const_node);
+    sc_addr const arcAddr = sc_memory_arc_new(context, sc_type_const_perm_pos_arc, prevNodeAddr, nodeAddr);
+    AddToConstruction(context, constructionAddr, nodeAddr);
+    AddToConstruction(context, constructionAddr, arcAddr);
+    prevNodeAddr = nodeAddr;
+  }
+
+  json const translation = TranslateToSCgJson(*m_ctx, constructionAddr);
+  ASSERT_TRUE(translation.is_array());
+  EXPECT_EQ(translation.size(), 2 * nodesCount - 1);
+  EXPECT_EQ(translation, BuildSCgJson(context, constructionAddr));
+
+  sc_module_shutdown();
+}
@@ -10,8 +10,12 @@
 #include <sc-common/sc_keynodes.h>
 #include <sc-common/sc_utils.h>
 
+#include <sc-core/sc-base/sc_allocator.h>
+
 #include "utils_keynodes.h"
 
+#define ERASE_ELEMENTS_INITIAL_CAPACITY 32
+
 /*!
  *  Erase sc-elements from memory if they dont belong to init memory structure
  */
@@ -47,6 +51,10 @@ sc_result agent_erase_elements(sc_event_subscription const * event, sc_addr arg)
   sc_addr set_addr = sc_iterator5_value(get_set_it, 2);
   sc_iterator5_free(get_set_it);
 
+  sc_uint32 elements_count = 0;
+  sc_uint32 elements_capacity = ERASE_ELEMENTS_INITIAL_CAPACITY;
+  sc_addr * elements = sc_mem_new(sc_addr, elements_capacity);
+
   sc_iterator3 * set_it = sc_iterator3_f_a_a_new(s_erase_elements_ctx, set_addr, 0, 0);
   while (sc_iterator3_next(set_it) == SC_TRUE)
   {
@@ -55,6 +63,7 @@ sc_result agent_erase_elements(sc_event_subscription const * event, sc_addr arg)
     if (SC_ADDR_IS_EQUAL(element_addr, action_addr))
     {
       sc_iterator3_free(set_it);
+      sc_mem_free(elements);
       finish_action_unsuccessfully(s_erase_elements_ctx, action_addr);
       return SC_RESULT_ERROR;
     }
@@ -80,10 +89,23 @@ sc_result agent_erase_elements(sc_event_subscription const * event, sc_addr arg)
       }
     }
 
-    sc_memory_element_free(s_erase_elements_ctx, element_addr);
+    if (elements_count == elements_capacity)
+    {
+      sc_addr * const old_elements = elements;
+      elements_capacity *= 2;
+      elements = sc_mem_new(sc_addr, elements_capacity);
+      sc_mem_cpy(elements, old_elements, sizeof(sc_addr) * elements_count);
+      sc_mem_free(old_elements);
+    }
+    elements[elements_count++] = element_addr;
   }
 
   sc_iterator3_free(set_it);
+
+  // all collected sc-elements and their incident sc-connectors are erased in one pass
+  sc_memory_elements_free(s_erase_elements_ctx, elements, elements_count);
+  sc_mem_free(elements);
+
   // @TODO: edge from finish_action_successfully to action doesn't create
   finish_action_successfully(s_erase_elements_ctx, action_addr);
   return SC_RESULT_OK;
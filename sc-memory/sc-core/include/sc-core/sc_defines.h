@@ -78,4 +78,12 @@
 
 #define SC_DEPRECATED(__Version, __Message) _SC_DEPRECATED_IMPL(__Version, __Message)
 
+// -------------- Prefetching ---------------
+#if (SC_COMPILER == SC_COMPILER_CLANG) || (SC_COMPILER == SC_COMPILER_GNU)
+//! Hints processor to load memory by specified address into cache for further reading
+#  define SC_PREFETCH_READ(__Address) __builtin_prefetch((__Address), 0, 3)
+#else
+#  define SC_PREFETCH_READ(__Address) ((void)(__Address))
+#endif
+
 #endif  // _sc_defines_h_
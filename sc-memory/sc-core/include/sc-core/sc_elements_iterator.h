@@ -0,0 +1,67 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#ifndef _sc_elements_iterator_h_
+#define _sc_elements_iterator_h_
+
+#include "sc-core/sc_defines.h"
+#include "sc-core/sc_types.h"
+
+/*! Structure to store information of iterator of all sc-elements of some type
+ */
+struct _sc_elements_iterator
+{
+  sc_type type;                   // type of iterated sc-elements
+  sc_addr addr;                   // sc-address of found sc-element
+  sc_memory_context const * ctx;  // pointer to used memory context
+  sc_bool finished;
+};
+
+/*! Create iterator to find all sc-elements which types have all bits of specified type. Sc-elements are found in order
+ * of their sc-addresses without scanning all sc-segments if sc-elements are indexed by their types.
+ * @param ctx Pointer to used memory context
+ * @param type Type of sc-elements to iterate (0 - all types)
+ * @return Pointer to created iterator
+ * @code
+ * sc_elements_iterator * it = sc_elements_iterator_new(ctx, sc_type_const_node_class);
+ * while (sc_elements_iterator_next(it))
+ * {
+ *   sc_addr const class_addr = sc_elements_iterator_value(it);
+ * }
+ * sc_elements_iterator_free(it);
+ * @endcode
+ */
+_SC_EXTERN sc_elements_iterator * sc_elements_iterator_new(sc_memory_context const * ctx, sc_type type);
+
+/*! Destroy iterator and free allocated memory
+ * @param it Pointer to iterator that need to be destroyed
+ */
+_SC_EXTERN void sc_elements_iterator_free(sc_elements_iterator * it);
+
+/*! Go to next sc-element of iterator type
+ * @param it Pointer to iterator that we need to go next result
+ * @return Return SC_TRUE, if iterator moved to new sc-element; otherwise return SC_FALSE.
+ */
+_SC_EXTERN sc_bool sc_elements_iterator_next(sc_elements_iterator * it);
+
+/*! Go to next sc-element of iterator type
+ * @param it Pointer to iterator that we need to go next result
+ * @param result Pointer to error caused during search
+ * @return Return SC_TRUE, if iterator moved to new sc-element; otherwise return SC_FALSE.
+ * @retval SC_RESULT_OK The function executed successfully.
+ * @retval SC_RESULT_NO The specified iterator is not valid.
+ * @retval SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED The specified sc-memory context is not authenticated.
+ * @note Sc-elements which the sc-memory context has no read permissions for are skipped.
+ */
+_SC_EXTERN sc_bool sc_elements_iterator_next_ext(sc_elements_iterator * it, sc_result * result);
+
+/*! Get found sc-element
+ * @param it Pointer to iterator for getting value
+ * @return Return sc-addr of found sc-element or empty sc-addr if iterator is finished
+ */
+_SC_EXTERN sc_addr sc_elements_iterator_value(sc_elements_iterator * it);
+
+#endif
@@ -59,6 +59,13 @@ _SC_EXTERN sc_result sc_helper_find_element_by_system_identifier(
  * contains sc-addr of this one; otherwise return SC_RESULT_ERROR. If there are more then one sc-elements with
  * specified system identifier, then return SC_RESULT_ERROR_INVALID_STATE, but result_addr will contains sc-addr
  * of firstly found sc-element.
+ * @note System identifiers are found in index filled at sc-memory initialization and by this helper. Found fiver is
+ * checked again only if version of system identifiers was changed since its previous check, i.e. a sc-arc from
+ * nrel_system_identifier was erased or content of a system identifier sc-link was set. If system identifier isn't
+ * indexed, then it is found by sc-links contents.
+ * @note If system identifier is indexed, then SC_RESULT_OK is returned with indexed sc-element even if there are more
+ * then one sc-elements with it. SC_RESULT_ERROR_INVALID_STATE is returned for them only when system identifier is
+ * found by sc-links contents. Index keeps the first sc-element found with duplicated system identifier.
  */
 _SC_EXTERN sc_result sc_helper_find_element_by_system_identifier_ext(
     sc_memory_context const * ctx,
@@ -137,6 +144,8 @@ _SC_EXTERN sc_bool sc_helper_resolve_system_identifier_ext(
  * @param arc_type Type of sc-arc to check
  * @return If arc with specified type between beg_el and end_el exist, then return SC_TRUE;
  * otherwise return SC_FALSE
+ * @note It walks the shorter list of outgoing arcs of beg_el and incoming arcs of end_el, so membership of element
+ * in large set or structure is checked by arcs of this element.
  */
 _SC_EXTERN sc_bool sc_helper_check_arc(sc_memory_context const * ctx, sc_addr beg_el, sc_addr end_el, sc_type arc_type);
 
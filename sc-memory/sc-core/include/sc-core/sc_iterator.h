@@ -9,5 +9,6 @@
 
 #include "sc-core/sc_iterator3.h"
 #include "sc-core/sc_iterator5.h"
+#include "sc-core/sc_elements_iterator.h"
 
 #endif  // _sc_iterator_h_
@@ -61,6 +61,7 @@ struct _sc_iterator3
   sc_iterator_result results[3];  // results array (same size as params)
   sc_memory_context const * ctx;  // pointer to used memory context
   sc_bool finished;
+  sc_bool is_outgoing_walk;  // f_a_f iterator walks outgoing sc-connectors of begin instead of incoming ones of end
 };
 
 /*! Create iterator to find outgoing sc-arcs for specified element
@@ -168,6 +169,60 @@ _SC_EXTERN sc_bool sc_iterator3_next(sc_iterator3 * it);
  */
 _SC_EXTERN sc_bool sc_iterator3_next_ext(sc_iterator3 * it, sc_result * result);
 
+/*! Go to next iterator results and get up to `max_count` of them at once
+ * @param it Pointer to iterator that we need to go next results
+ * @param results Pointer to array of at least `3 * max_count` sc-addrs. Found construction with index `i` is stored
+ * into `results[3 * i]`, `results[3 * i + 1]` and `results[3 * i + 2]`. sc-addrs of sc-elements that can't be read by
+ * iterator context are stored as SC_ADDR_EMPTY.
+ * @param max_count Maximum number of constructions to get
+ * @return Return number of found constructions; 0, if there are no more results.
+ * @note f_a_a, a_a_f and f_a_f iterators lock fixed sc-elements only once for all found constructions.
+ * @code
+ * sc_addr results[3 * 64];
+ * sc_uint32 count;
+ * while ((count = sc_iterator3_next_batch(it, results, 64)) != 0) { <your code> }
+ * @endcode
+ */
+_SC_EXTERN sc_uint32 sc_iterator3_next_batch(sc_iterator3 * it, sc_addr * results, sc_uint32 max_count);
+
+/*! Go to next iterator results and get up to `max_count` of them at once
+ * @param it Pointer to iterator that we need to go next results
+ * @param results Pointer to array of at least `3 * max_count` sc-addrs to store found constructions
+ * @param max_count Maximum number of constructions to get
+ * @param result Pointer to error caused during search
+ * @return Return number of found constructions; 0, if there are no more results.
+ * @retval SC_RESULT_OK The function executed successfully.
+ * @retval SC_RESULT_NO The specified sc-iterator3 is not valid.
+ * @retval SC_RESULT_ERROR_INVALID_PARAMS The specified results array is null or `max_count` is 0.
+ * @retval SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED The specified sc-memory context is not authorized.
+ */
+_SC_EXTERN sc_uint32
+sc_iterator3_next_batch_ext(sc_iterator3 * it, sc_addr * results, sc_uint32 max_count, sc_result * result);
+
+/*! Go to next iterator results and count up to `max_count` of them without getting their sc-elements
+ * @param it Pointer to iterator that we need to go next results
+ * @param max_count Maximum number of constructions to count; 0 - count all next constructions. Use 1 to check if
+ * there is at least one next construction.
+ * @return Return number of counted constructions.
+ * @note Types of not fixed sc-elements are read only if iterator filters them, and sc-elements of counted
+ * constructions can't be got by sc_iterator3_value.
+ * @code
+ * sc_bool const is_empty = sc_iterator3_count_next(it, 1) == 0;
+ * @endcode
+ */
+_SC_EXTERN sc_uint32 sc_iterator3_count_next(sc_iterator3 * it, sc_uint32 max_count);
+
+/*! Go to next iterator results and count up to `max_count` of them without getting their sc-elements
+ * @param it Pointer to iterator that we need to go next results
+ * @param max_count Maximum number of constructions to count; 0 - count all next constructions
+ * @param result Pointer to error caused during search
+ * @return Return number of counted constructions.
+ * @retval SC_RESULT_OK The function executed successfully.
+ * @retval SC_RESULT_NO The specified sc-iterator3 is not valid.
+ * @retval SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED The specified sc-memory context is not authorized.
+ */
+_SC_EXTERN sc_uint32 sc_iterator3_count_next_ext(sc_iterator3 * it, sc_uint32 max_count, sc_result * result);
+
 /*! Get iterator value
  * @param it Pointer to iterator for getting value
  * @param index Value id (can't be more that 3 for sc-iterator3)
@@ -245,6 +245,29 @@ _SC_EXTERN sc_bool sc_memory_is_element_ext(sc_memory_context const * ctx, sc_ad
  */
 _SC_EXTERN sc_result sc_memory_element_free(sc_memory_context * ctx, sc_addr addr);
 
+/*!
+ * @brief Erases specified sc-elements and all sc-connectors incident to them.
+ *
+ * Incident sc-connectors of all specified sc-elements are collected once, and erased sc-elements are returned to
+ * sc-memory once per sc-segment, so it is faster than calling `sc_memory_element_free` for each sc-element.
+ *
+ * @param ctx A pointer to the sc-memory context that manages the operation.
+ * @param addrs A pointer to array of sc-addrs of sc-elements to be freed. Not existing sc-elements are skipped.
+ * @param count A number of sc-addrs in array.
+ *
+ * @return Returns SC_RESULT_OK if the operation executed successfully. Sc-elements aren't erased, if the specified
+ * sc-memory context has no permissions to erase at least one of them.
+ *
+ * @note This function is thread-safe.
+ *
+ * Possible values for the result:
+ * @retval SC_RESULT_OK The function executed successfully.
+ * @retval SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHORIZED The specified sc-memory context is not authorized.
+ * @retval SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_ERASE_PERMISSIONS The specified sc-memory context does not have
+ * erase permissions.
+ */
+_SC_EXTERN sc_result sc_memory_elements_free(sc_memory_context * ctx, sc_addr const * addrs, sc_uint32 count);
+
 /*!
  * @brief Generates a new sc-node with the specified type.
  *
@@ -871,7 +894,8 @@ _SC_EXTERN sc_result sc_memory_find_links_contents_by_content_substring_ext(
  * @brief Retrieves statistics for sc-storage elements.
  *
  * This function retrieves statistics for SC-storage elements, including the count
- * of various types of elements (nodes, links, arcs) and their total size in bytes.
+ * of various types of elements (nodes, links, arcs) and their total size in bytes. Statistics is maintained when
+ * sc-elements are generated and erased, so it is got without scanning sc-segments.
  *
  * @param ctx A pointer to the sc-memory context that manages the operation.
  * @param stat Pointer to the `sc_stat` structure where the statistics will be stored.
@@ -891,6 +915,24 @@ _SC_EXTERN sc_result sc_memory_find_links_contents_by_content_substring_ext(
  */
 _SC_EXTERN sc_result sc_memory_stat(sc_memory_context const * ctx, sc_stat * stat);
 
+/*!
+ * @brief Calculates statistics for sc-storage elements by scanning all sc-segments.
+ *
+ * It is slow and is used to verify statistics retrieved by `sc_memory_stat`.
+ *
+ * @param ctx A pointer to the sc-memory context that manages the operation.
+ * @param stat Pointer to the `sc_stat` structure where the statistics will be stored.
+ *
+ * @return Returns SC_RESULT_OK, if statistics is calculated.
+ *
+ * @note This function is thread-safe.
+ *
+ * @retval SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHORIZED The specified sc-memory context is not authorized.
+ * @retval SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_READ_PERMISSIONS The specified sc-memory context does not have read
+ * permissions.
+ */
+_SC_EXTERN sc_result sc_memory_collect_stat(sc_memory_context const * ctx, sc_stat * stat);
+
 /*!
  * @brief Saves the current state of the sc-storage to persistent storage.
  *
@@ -911,4 +953,52 @@ _SC_EXTERN sc_result sc_memory_stat(sc_memory_context const * ctx, sc_stat * sta
  */
 _SC_EXTERN sc_result sc_memory_save(sc_memory_context const * ctx);
 
+/*!
+ * @brief Begins mode in which sc-links contents aren't indexed to search sc-links by content substrings.
+ *
+ * Modes can be nested, and sc-links contents are indexed when the last begun mode is ended. Sc-links are found by
+ * full contents as usual in this mode, and search by content substring indexes deferred contents before search. Use
+ * this mode to generate large amount of sc-links, for example, while knowledge base is built.
+ *
+ * @param ctx A pointer to the sc-memory context that manages the operation.
+ *
+ * @return Returns SC_RESULT_OK, if mode is begun.
+ *
+ * @note This function is thread-safe.
+ *
+ * @retval SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHORIZED The specified sc-memory context is not authorized.
+ * @retval SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_WRITE_PERMISSIONS The specified sc-memory context does not have
+ * write permissions.
+ */
+_SC_EXTERN sc_result sc_memory_deferred_indexing_begin(sc_memory_context const * ctx);
+
+/*!
+ * @brief Ends mode begun by `sc_memory_deferred_indexing_begin` and indexes deferred sc-links contents, if it is the
+ * last begun mode.
+ *
+ * @param ctx A pointer to the sc-memory context that manages the operation.
+ *
+ * @return Returns SC_RESULT_OK, if mode is ended, and SC_RESULT_ERROR, if mode isn't begun.
+ *
+ * @note This function is thread-safe.
+ *
+ * @retval SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHORIZED The specified sc-memory context is not authorized.
+ * @retval SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_WRITE_PERMISSIONS The specified sc-memory context does not have
+ * write permissions.
+ */
+_SC_EXTERN sc_result sc_memory_deferred_indexing_end(sc_memory_context const * ctx);
+
+/*!
+ * @brief Gets version of sc-elements system identifiers.
+ *
+ * Version is changed when constructions of system identifiers are erased, contents of their sc-links are changed or
+ * sc-memory is initialized. If version isn't changed, then sc-elements found by system identifiers earlier are still
+ * found by them, so version can be used to invalidate caches of resolved system identifiers.
+ *
+ * @return Returns the current version of system identifiers.
+ *
+ * @note This function is thread-safe.
+ */
+_SC_EXTERN sc_uint32 sc_memory_get_identifiers_version();
+
 #endif
@@ -26,6 +26,7 @@
 #define DEFAULT_MAX_SEARCHABLE_STRING_SIZE 1000
 #define DEFAULT_TERM_SEPARATORS " _"
 #define DEFAULT_SEARCH_BY_SUBSTRING SC_TRUE
+#define DEFAULT_INDEX_ELEMENTS_BY_TYPES SC_TRUE
 
 /*! Structure representing parameters for configuring the sc-memory.
  * @note This structure holds various configuration parameters that control the behavior of the sc-memory.
@@ -69,6 +70,10 @@ typedef struct
   sc_uint32 max_searchable_string_size;  ///< Maximum size of a searchable string.
   sc_char const * term_separators;       ///< String containing term separators used in string operations.
   sc_bool search_by_substring;           ///< Boolean indicating whether to allow searching by substring.
+
+  ///< Boolean indicating whether to index sc-elements by their types to iterate sc-elements of type without scanning all
+  ///< sc-segments. By default, it is SC_TRUE.
+  sc_bool index_elements_by_types;
 } sc_memory_params;
 
 _SC_EXTERN void sc_memory_params_clear(sc_memory_params * params);
@@ -6,6 +6,9 @@
 
 #ifdef SC_DICTIONARY_FS_MEMORY
 
+#  include <stdlib.h>
+#  include <string.h>
+
 #  include "sc_dictionary_fs_memory.h"
 #  include "sc_dictionary_fs_memory_private.h"
 
@@ -150,6 +153,8 @@ sc_dictionary_fs_memory_status sc_dictionary_fs_memory_initialize_ext(
       (*memory)->last_string_offset = 0;
       sc_monitor_init(&(*memory)->monitor);
       sc_monitor_init(&(*memory)->resolve_string_offset_monitor);
+      (*memory)->deferred_indexing_depth = 0;
+      (*memory)->deferred_strings = null_ptr;
     }
 
     _sc_number_dictionary_initialize(&(*memory)->link_hashes_string_offsets_dictionary);
@@ -217,6 +222,8 @@ sc_dictionary_fs_memory_status sc_dictionary_fs_memory_shutdown(sc_dictionary_fs
       _sc_monitor_table_destroy(&memory->strings_channels_monitors_table);
       sc_monitor_destroy(&memory->monitor);
       sc_monitor_destroy(&memory->resolve_string_offset_monitor);
+      if (memory->deferred_strings != null_ptr)
+        sc_hash_table_destroy(memory->deferred_strings);
     }
 
     sc_dictionary_destroy(memory->link_hashes_string_offsets_dictionary, _sc_dictionary_fs_memory_string_node_clear);
@@ -398,6 +405,80 @@ sc_uint64 _sc_dictionary_fs_memory_get_string_offset_by_string(
   return string_offset;
 }
 
+guint _sc_dictionary_fs_memory_deferred_string_hash(gconstpointer data)
+{
+  sc_dictionary_fs_memory_deferred_string const * deferred_string = data;
+
+  guint hash = 2166136261u;
+  for (sc_uint64 i = 0; i < deferred_string->string_size; ++i)
+  {
+    hash ^= (sc_uchar)deferred_string->string[i];
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+gboolean _sc_dictionary_fs_memory_deferred_string_equal(gconstpointer data, gconstpointer other_data)
+{
+  sc_dictionary_fs_memory_deferred_string const * deferred_string = data;
+  sc_dictionary_fs_memory_deferred_string const * other_deferred_string = other_data;
+
+  return deferred_string->string_size == other_deferred_string->string_size
+         && memcmp(deferred_string->string, other_deferred_string->string, deferred_string->string_size) == 0;
+}
+
+void _sc_dictionary_fs_memory_deferred_string_free(gpointer data)
+{
+  sc_dictionary_fs_memory_deferred_string * deferred_string = data;
+  sc_mem_free(deferred_string->string);
+  sc_mem_free(deferred_string);
+}
+
+int _sc_dictionary_fs_memory_deferred_strings_compare(void const * data, void const * other_data)
+{
+  sc_dictionary_fs_memory_deferred_string const * deferred_string =
+      *(sc_dictionary_fs_memory_deferred_string const **)data;
+  sc_dictionary_fs_memory_deferred_string const * other_deferred_string =
+      *(sc_dictionary_fs_memory_deferred_string const **)other_data;
+
+  sc_uint64 const min_size = sc_min(deferred_string->string_size, other_deferred_string->string_size);
+  int const result = memcmp(deferred_string->string, other_deferred_string->string, min_size);
+  if (result != 0)
+    return result;
+
+  return (deferred_string->string_size > other_deferred_string->string_size)
+         - (deferred_string->string_size < other_deferred_string->string_size);
+}
+
+//! Should be called under `resolve_string_offset_monitor`
+sc_uint64 _sc_dictionary_fs_memory_get_deferred_string_offset(
+    sc_dictionary_fs_memory const * memory,
+    sc_char const * string,
+    sc_uint64 const string_size)
+{
+  if (memory->deferred_strings == null_ptr)
+    return INVALID_STRING_OFFSET;
+
+  sc_dictionary_fs_memory_deferred_string const key = {(sc_char *)string, string_size, 0};
+  sc_dictionary_fs_memory_deferred_string const * deferred_string =
+      sc_hash_table_get(memory->deferred_strings, (gconstpointer)&key);
+  return deferred_string == null_ptr ? INVALID_STRING_OFFSET : deferred_string->string_offset;
+}
+
+//! Should be called under `resolve_string_offset_monitor`
+void _sc_dictionary_fs_memory_append_deferred_string(
+    sc_dictionary_fs_memory * memory,
+    sc_char const * string,
+    sc_uint64 const string_size,
+    sc_uint64 const string_offset)
+{
+  sc_dictionary_fs_memory_deferred_string * deferred_string = sc_mem_new(sc_dictionary_fs_memory_deferred_string, 1);
+  sc_str_cpy(deferred_string->string, string, string_size);
+  deferred_string->string_size = string_size;
+  deferred_string->string_offset = string_offset;
+  sc_hash_table_insert(memory->deferred_strings, deferred_string, deferred_string);
+}
+
 sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_write_string(
     sc_dictionary_fs_memory * memory,
     sc_addr_hash const link_hash,
@@ -406,7 +487,8 @@ sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_write_string(
     sc_list const * string_terms,
     sc_bool is_searchable_string,
     sc_uint64 * string_offset,
-    sc_bool * is_not_exist)
+    sc_bool * is_not_exist,
+    sc_bool * is_deferred)
 {
   sc_monitor * channel_monitor;
   sc_monitor_acquire_write(&memory->resolve_string_offset_monitor);
@@ -416,11 +498,21 @@ sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_write_string(
   if (strings_channel == null_ptr)
     goto no_last_channel_error;
 
-  // find string if it exists in fs-memory
-  if (is_searchable_string)
+  // find string if it exists in fs-memory, strings appended in deferred indexing mode are found in hash table
+  *is_deferred = is_searchable_string && memory->deferred_strings != null_ptr;
+  if (*is_deferred)
+    *string_offset = _sc_dictionary_fs_memory_get_deferred_string_offset(memory, string, string_size);
+  if (is_searchable_string && *string_offset == INVALID_STRING_OFFSET)
   {
-    *string_offset =
-        _sc_dictionary_fs_memory_get_string_offset_by_string(memory, string, string_size, string_terms->begin->data);
+    if (string_terms != null_ptr)
+      *string_offset =
+          _sc_dictionary_fs_memory_get_string_offset_by_string(memory, string, string_size, string_terms->begin->data);
+    else
+    {
+      sc_char * term = _sc_dictionary_fs_memory_get_first_term(string, memory->term_separators);
+      *string_offset = _sc_dictionary_fs_memory_get_string_offset_by_string(memory, string, string_size, term);
+      sc_mem_free(term);
+    }
   }
 
   sc_monitor_acquire_write(&memory->monitor);
@@ -454,6 +546,9 @@ sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_write_string(
     }
 
     memory->last_string_offset += written_bytes;
+
+    if (*is_deferred)
+      _sc_dictionary_fs_memory_append_deferred_string(memory, string, string_size, *string_offset);
   }
 
   sc_monitor_release_write(channel_monitor);
@@ -518,14 +613,23 @@ sc_dictionary_fs_memory_status sc_dictionary_fs_memory_link_string_ext(
 
   is_searchable_string &= string_size < memory->max_searchable_string_size;
   sc_list * string_terms = null_ptr;
-  // don't divide into terms big strings if you don't need to search them
-  if (is_searchable_string)
+  // don't divide into terms big strings if you don't need to search them, and strings which are indexed later
+  if (is_searchable_string && memory->deferred_strings == null_ptr)
     string_terms = _sc_dictionary_fs_memory_get_string_terms(string, memory->term_separators);
 
   sc_bool is_not_exist = SC_TRUE;
+  sc_bool is_deferred = SC_FALSE;
   sc_uint64 string_offset;
   sc_dictionary_fs_memory_status status = _sc_dictionary_fs_memory_write_string(
-      memory, link_hash, string, string_size, string_terms, is_searchable_string, &string_offset, &is_not_exist);
+      memory,
+      link_hash,
+      string,
+      string_size,
+      string_terms,
+      is_searchable_string,
+      &string_offset,
+      &is_not_exist,
+      &is_deferred);
   if (status != SC_FS_MEMORY_OK)
     goto exit;
 
@@ -534,8 +638,13 @@ sc_dictionary_fs_memory_status sc_dictionary_fs_memory_link_string_ext(
     _sc_dictionary_fs_memory_append_link_string_unique(memory, link_hash, string_offset);
   }
 
-  if (is_searchable_string && is_not_exist)
+  if (is_searchable_string && is_not_exist && !is_deferred)
+  {
+    // deferred indexing mode can be ended after string terms are skipped
+    if (string_terms == null_ptr)
+      string_terms = _sc_dictionary_fs_memory_get_string_terms(string, memory->term_separators);
     status = _sc_dictionary_fs_memory_write_string_terms_string_offset(memory, string_offset, string_terms);
+  }
 
 exit:
   sc_list_clear(string_terms);
@@ -689,6 +798,42 @@ sc_dictionary_fs_memory_status sc_dictionary_fs_memory_get_string_by_link_hash(
   return SC_FS_MEMORY_OK;
 }
 
+void _sc_dictionary_fs_memory_push_link_hashes(sc_list const * link_hashes, sc_link_handler * link_handler)
+{
+  sc_iterator * data_it = sc_list_iterator(link_hashes);
+  while (sc_iterator_next(data_it))
+  {
+    sc_addr_hash link_hash = (sc_pointer_to_sc_addr_hash)sc_iterator_get(data_it);
+    sc_addr link_addr;
+    SC_ADDR_LOCAL_FROM_INT(link_hash, link_addr);
+    if (link_handler->push_link_callback != null_ptr)
+      link_handler->push_link_callback(link_handler->push_link_callback_data, link_addr);
+  }
+  sc_iterator_destroy(data_it);
+}
+
+sc_bool _sc_dictionary_fs_memory_get_link_hashes_by_deferred_string(
+    sc_dictionary_fs_memory * memory,
+    sc_char const * string,
+    sc_uint64 const string_size,
+    sc_link_handler * link_handler)
+{
+  sc_monitor_acquire_read(&memory->resolve_string_offset_monitor);
+  sc_uint64 const string_offset = _sc_dictionary_fs_memory_get_deferred_string_offset(memory, string, string_size);
+  sc_monitor_release_read(&memory->resolve_string_offset_monitor);
+  if (string_offset == INVALID_STRING_OFFSET)
+    return SC_FALSE;
+
+  sc_char string_offset_str[DEFAULT_STRING_INT_SIZE];
+  sc_uint64 string_offset_str_size;
+  sc_int_to_str_int(string_offset, string_offset_str, string_offset_str_size);
+
+  sc_list const * link_hashes = sc_dictionary_get_by_key(
+      memory->string_offsets_link_hashes_dictionary, string_offset_str, string_offset_str_size);
+  _sc_dictionary_fs_memory_push_link_hashes(link_hashes, link_handler);
+  return SC_TRUE;
+}
+
 sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_get_link_hashes_by_string_term(
     sc_dictionary_fs_memory * memory,
     sc_char const * string,
@@ -779,16 +924,7 @@ sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_get_link_hashes_by_strin
       link_hashes_list = sc_dictionary_get_by_key(
           memory->string_offsets_link_hashes_dictionary, string_offset_str, string_offset_str_size);
 
-    sc_iterator * data_it = sc_list_iterator(link_hashes_list);
-    while (sc_iterator_next(data_it))
-    {
-      sc_addr_hash link_hash = (sc_pointer_to_sc_addr_hash)sc_iterator_get(data_it);
-      sc_addr link_addr;
-      SC_ADDR_LOCAL_FROM_INT(link_hash, link_addr);
-      if (link_handler->push_link_callback != null_ptr)
-        link_handler->push_link_callback(link_handler->push_link_callback_data, link_addr);
-    }
-    sc_iterator_destroy(data_it);
+    _sc_dictionary_fs_memory_push_link_hashes(link_hashes_list, link_handler);
   }
   sc_iterator_destroy(string_offset_it);
 
@@ -924,6 +1060,14 @@ sc_dictionary_fs_memory_status sc_dictionary_fs_memory_get_link_hashes_by_string
     return SC_FS_MEMORY_NO;
   }
 
+  // strings appended in deferred indexing mode are found by full string in hash table, and by substring after indexing
+  sc_bool is_deferred_string_found = SC_FALSE;
+  if (is_substring)
+    sc_dictionary_fs_memory_index_deferred_strings(memory);
+  else
+    is_deferred_string_found =
+        _sc_dictionary_fs_memory_get_link_hashes_by_deferred_string(memory, string, string_size, link_handler);
+
   sc_char * term = _sc_dictionary_fs_memory_get_first_term(string, memory->term_separators);
   sc_list * string_offsets = null_ptr;
   if (is_substring)
@@ -932,8 +1076,10 @@ sc_dictionary_fs_memory_status sc_dictionary_fs_memory_get_link_hashes_by_string
     string_offsets = _sc_dictionary_fs_memory_get_string_offsets_by_term(memory, term);
   sc_mem_free(term);
 
-  sc_dictionary_fs_memory_status const status = _sc_dictionary_fs_memory_get_link_hashes_by_string_term(
+  sc_dictionary_fs_memory_status status = _sc_dictionary_fs_memory_get_link_hashes_by_string_term(
       memory, string, string_size, is_substring, to_search_as_prefix, string_offsets, link_handler);
+  if (status == SC_FS_MEMORY_NO_STRING && is_deferred_string_found)
+    status = SC_FS_MEMORY_OK;
 
   if (is_substring)
   {
@@ -1084,6 +1230,8 @@ sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_get_strings_by_substring
     return SC_FS_MEMORY_NO;
   }
 
+  sc_dictionary_fs_memory_index_deferred_strings(memory);
+
   sc_char * term = _sc_dictionary_fs_memory_get_first_term(string, memory->term_separators);
   sc_list * string_offsets = _sc_dictionary_fs_memory_get_string_offsets_by_term_prefix(memory, term, link_handler);
   sc_mem_free(term);
@@ -1498,6 +1646,117 @@ sc_fs_memory_status _sc_dictionary_fs_memory_load_deprecated_dictionaries(sc_dic
   return SC_FS_MEMORY_OK;
 }
 
+sc_dictionary_fs_memory_status sc_dictionary_fs_memory_deferred_indexing_begin(sc_dictionary_fs_memory * memory)
+{
+  if (memory == null_ptr)
+  {
+    sc_fs_memory_info("Memory is empty to begin deferred indexing");
+    return SC_FS_MEMORY_NO;
+  }
+
+  sc_monitor_acquire_write(&memory->resolve_string_offset_monitor);
+  if (memory->deferred_indexing_depth++ == 0 && memory->deferred_strings == null_ptr)
+    memory->deferred_strings = sc_hash_table_init(
+        _sc_dictionary_fs_memory_deferred_string_hash,
+        _sc_dictionary_fs_memory_deferred_string_equal,
+        _sc_dictionary_fs_memory_deferred_string_free,
+        null_ptr);
+  sc_monitor_release_write(&memory->resolve_string_offset_monitor);
+
+  return SC_FS_MEMORY_OK;
+}
+
+sc_dictionary_fs_memory_status sc_dictionary_fs_memory_deferred_indexing_end(sc_dictionary_fs_memory * memory)
+{
+  if (memory == null_ptr)
+  {
+    sc_fs_memory_info("Memory is empty to end deferred indexing");
+    return SC_FS_MEMORY_NO;
+  }
+
+  sc_monitor_acquire_write(&memory->resolve_string_offset_monitor);
+  if (memory->deferred_indexing_depth == 0)
+  {
+    sc_monitor_release_write(&memory->resolve_string_offset_monitor);
+    sc_fs_memory_info("Deferred indexing isn't begun");
+    return SC_FS_MEMORY_NO;
+  }
+  sc_bool const is_last_mode = --memory->deferred_indexing_depth == 0;
+  sc_monitor_release_write(&memory->resolve_string_offset_monitor);
+
+  if (!is_last_mode)
+    return SC_FS_MEMORY_OK;
+
+  sc_dictionary_fs_memory_status const status = sc_dictionary_fs_memory_index_deferred_strings(memory);
+
+  sc_monitor_acquire_write(&memory->resolve_string_offset_monitor);
+  // deferred indexing can be begun again while strings are indexed
+  if (memory->deferred_indexing_depth == 0 && memory->deferred_strings != null_ptr)
+  {
+    sc_hash_table_destroy(memory->deferred_strings);
+    memory->deferred_strings = null_ptr;
+  }
+  sc_monitor_release_write(&memory->resolve_string_offset_monitor);
+
+  return status;
+}
+
+sc_dictionary_fs_memory_status sc_dictionary_fs_memory_index_deferred_strings(sc_dictionary_fs_memory * memory)
+{
+  if (memory == null_ptr)
+  {
+    sc_fs_memory_info("Memory is empty to index deferred strings");
+    return SC_FS_MEMORY_NO;
+  }
+
+  sc_monitor_acquire_write(&memory->resolve_string_offset_monitor);
+  sc_uint32 const deferred_strings_count =
+      memory->deferred_strings == null_ptr ? 0 : sc_hash_table_size(memory->deferred_strings);
+  if (deferred_strings_count == 0)
+  {
+    sc_monitor_release_write(&memory->resolve_string_offset_monitor);
+    return SC_FS_MEMORY_OK;
+  }
+
+  // deferred strings are indexed in sorted order, so their offsets are appended into terms dictionary in the same order
+  // regardless of hash table order. Terms of each string are still appended by separate walks from dictionary root,
+  // sorting only makes consecutive walks of strings with common first terms pass the same recently visited nodes.
+  sc_dictionary_fs_memory_deferred_string ** deferred_strings =
+      sc_mem_new(sc_dictionary_fs_memory_deferred_string *, deferred_strings_count);
+  sc_uint32 i = 0;
+  sc_hash_table_iterator it;
+  sc_hash_table_iterator_init(&it, memory->deferred_strings);
+  gpointer key, value;
+  while (sc_hash_table_iterator_next(&it, &key, &value))
+    deferred_strings[i++] = value;
+  qsort(
+      deferred_strings,
+      deferred_strings_count,
+      sizeof(sc_dictionary_fs_memory_deferred_string *),
+      _sc_dictionary_fs_memory_deferred_strings_compare);
+
+  for (i = 0; i < deferred_strings_count; ++i)
+  {
+    sc_dictionary_fs_memory_deferred_string const * deferred_string = deferred_strings[i];
+    sc_list * string_terms = _sc_dictionary_fs_memory_get_string_terms(deferred_string->string, memory->term_separators);
+    _sc_dictionary_fs_memory_write_string_terms_string_offset(memory, deferred_string->string_offset, string_terms);
+    sc_list_clear(string_terms);
+    sc_list_destroy(string_terms);
+  }
+  sc_mem_free(deferred_strings);
+
+  // indexed strings are found in terms dictionary, next strings are deferred in new hash table
+  sc_hash_table_destroy(memory->deferred_strings);
+  memory->deferred_strings = sc_hash_table_init(
+      _sc_dictionary_fs_memory_deferred_string_hash,
+      _sc_dictionary_fs_memory_deferred_string_equal,
+      _sc_dictionary_fs_memory_deferred_string_free,
+      null_ptr);
+  sc_monitor_release_write(&memory->resolve_string_offset_monitor);
+
+  return SC_FS_MEMORY_OK;
+}
+
 sc_dictionary_fs_memory_status sc_dictionary_fs_memory_load(sc_dictionary_fs_memory * memory)
 {
   if (memory == null_ptr)
@@ -197,6 +197,29 @@ sc_dictionary_fs_memory_status sc_dictionary_fs_memory_unite_strings_by_terms(
     sc_list const * terms,
     sc_list ** strings);
 
+/*! Begins deferred indexing mode of strings in file system memory. In this mode terms of new strings aren't appended
+ * into terms dictionary when strings are appended, they are appended when the mode ends, string by string in sorted
+ * order of strings. New strings are found by full string in hash table, but they can't be found by substring until
+ * they are indexed, so search by substring indexes them before. The mode is used to load a lot of strings, for
+ * example, to build knowledge base.
+ * @param memory A pointer to file memory
+ * @returns SC_FS_MEMORY_OK, if deferred indexing mode begun.
+ * @note Modes can be nested, strings are indexed when the most outer mode ends.
+ */
+sc_dictionary_fs_memory_status sc_dictionary_fs_memory_deferred_indexing_begin(sc_dictionary_fs_memory * memory);
+
+/*! Ends deferred indexing mode of strings in file system memory and indexes all strings appended in this mode.
+ * @param memory A pointer to file memory
+ * @returns SC_FS_MEMORY_OK, if deferred indexing mode ended, or SC_FS_MEMORY_NO if the mode wasn't begun.
+ */
+sc_dictionary_fs_memory_status sc_dictionary_fs_memory_deferred_indexing_end(sc_dictionary_fs_memory * memory);
+
+/*! Indexes strings appended in deferred indexing mode without ending the mode.
+ * @param memory A pointer to file memory
+ * @returns SC_FS_MEMORY_OK, if are no errors.
+ */
+sc_dictionary_fs_memory_status sc_dictionary_fs_memory_index_deferred_strings(sc_dictionary_fs_memory * memory);
+
 /*! Load file system memory from file system
  * @param memory A pointer to file memory
  * @returns SC_FS_MEMORY_OK, if are no reading and writing errors.
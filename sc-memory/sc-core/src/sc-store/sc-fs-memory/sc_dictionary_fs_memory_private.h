@@ -18,6 +18,8 @@
 #include "sc-store/sc-base/sc_monitor_table_private.h"
 #include "sc-store/sc-base/sc_message.h"
 
+#include "sc-store/sc-container/sc_hash_table.h"
+
 #define SC_FS_EXT ".scdb"
 #define INVALID_STRING_OFFSET LONG_MAX
 
@@ -51,8 +53,18 @@ struct _sc_dictionary_fs_memory
       string_offsets_link_hashes_dictionary;  // dictionary instance with strings offsets and its link hashes
   sc_dictionary *
       link_hashes_string_offsets_dictionary;  // dictionary instance with link hashes and its strings offsets
+
+  sc_uint32 deferred_indexing_depth;  // number of begun and not ended deferred indexing modes
+  sc_hash_table * deferred_strings;   // strings which terms aren't appended into terms dictionary yet
 };
 
+typedef struct _sc_dictionary_fs_memory_deferred_string
+{
+  sc_char * string;
+  sc_uint64 string_size;
+  sc_uint64 string_offset;
+} sc_dictionary_fs_memory_deferred_string;
+
 sc_bool _sc_uchar_dictionary_initialize(sc_dictionary ** dictionary);
 
 sc_bool _sc_number_dictionary_initialize(sc_dictionary ** dictionary);
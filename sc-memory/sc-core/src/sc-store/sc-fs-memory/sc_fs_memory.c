@@ -123,6 +123,16 @@ sc_fs_memory_status sc_fs_memory_unlink_string(sc_addr_hash link_hash)
   return manager->unlink_string(manager->fs_memory, link_hash);
 }
 
+sc_fs_memory_status sc_fs_memory_deferred_indexing_begin()
+{
+  return manager->deferred_indexing_begin(manager->fs_memory);
+}
+
+sc_fs_memory_status sc_fs_memory_deferred_indexing_end()
+{
+  return manager->deferred_indexing_end(manager->fs_memory);
+}
+
 // read, write and save methods
 sc_fs_memory_status _sc_fs_memory_load_sc_memory_segments(sc_storage * storage)
 {
@@ -421,6 +431,9 @@ sc_fs_memory_status sc_fs_memory_save(sc_storage * storage)
 
   if (_sc_fs_memory_save_sc_memory_segments(storage) != SC_FS_MEMORY_OK)
     return SC_FS_MEMORY_WRITE_ERROR;
+  // saved terms dictionary must contain strings which indexing is deferred
+  if (manager->index_deferred_strings(manager->fs_memory) != SC_FS_MEMORY_OK)
+    return SC_FS_MEMORY_WRITE_ERROR;
   if (manager->save(manager->fs_memory) != SC_FS_MEMORY_OK)
     return SC_FS_MEMORY_WRITE_ERROR;
 
@@ -63,6 +63,9 @@ typedef struct _sc_fs_memory_manager
       sc_uint32 const max_length_to_search_as_prefix,
       sc_link_handler * link_handler);
   sc_fs_memory_status (*unlink_string)(sc_fs_memory * memory, sc_addr_hash const link_hash);
+  sc_fs_memory_status (*deferred_indexing_begin)(sc_fs_memory * memory);
+  sc_fs_memory_status (*deferred_indexing_end)(sc_fs_memory * memory);
+  sc_fs_memory_status (*index_deferred_strings)(sc_fs_memory * memory);
 } sc_fs_memory_manager;
 
 /*! Initialize file system memory in specified path.
@@ -158,6 +161,17 @@ sc_fs_memory_status sc_fs_memory_get_strings_by_substring(
     sc_uint32 max_length_to_search_as_prefix,
     sc_link_handler * link_handler);
 
+/*! Begins mode in which sc-link strings aren't indexed to search them by substring until this mode is ended. Such
+ * strings are found by full string as usual.
+ * @returns SC_FS_MEMORY_OK, if mode is begun.
+ */
+sc_fs_memory_status sc_fs_memory_deferred_indexing_begin();
+
+/*! Ends mode begun by `sc_fs_memory_deferred_indexing_begin` and indexes deferred sc-link strings.
+ * @returns SC_FS_MEMORY_NO, if mode isn't begun.
+ */
+sc_fs_memory_status sc_fs_memory_deferred_indexing_end();
+
 /*! Load file system memory from file system
  * @returns SC_TRUE, if file system loaded.
  */
@@ -26,6 +26,9 @@ sc_fs_memory_manager * sc_fs_memory_build()
   manager->get_strings_by_substring = sc_dictionary_fs_memory_get_strings_by_substring_ext;
   manager->get_string_by_link_hash = sc_dictionary_fs_memory_get_string_by_link_hash;
   manager->unlink_string = sc_dictionary_fs_memory_unlink_string;
+  manager->deferred_indexing_begin = sc_dictionary_fs_memory_deferred_indexing_begin;
+  manager->deferred_indexing_end = sc_dictionary_fs_memory_deferred_indexing_end;
+  manager->index_deferred_strings = sc_dictionary_fs_memory_index_deferred_strings;
 #endif
 
   return manager;
@@ -0,0 +1,98 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "sc-core/sc_iterator.h"
+
+#include "sc-core/sc-base/sc_allocator.h"
+
+#include "sc-store/sc-base/sc_monitor_table.h"
+
+#include "sc-store/sc_element.h"
+#include "sc-store/sc_storage.h"
+#include "sc-store/sc_storage_private.h"
+
+#include "sc_memory_context_manager.h"
+#include "sc_memory_context_private.h"
+#include "sc_memory_context_permissions.h"
+
+sc_elements_iterator * sc_elements_iterator_new(sc_memory_context const * ctx, sc_type type)
+{
+  sc_elements_iterator * it = sc_mem_new(sc_elements_iterator, 1);
+
+  it->type = type;
+  it->addr = SC_ADDR_EMPTY;
+  it->ctx = ctx;
+  it->finished = SC_FALSE;
+
+  return it;
+}
+
+void sc_elements_iterator_free(sc_elements_iterator * it)
+{
+  if (it == null_ptr)
+    return;
+
+  sc_mem_free(it);
+}
+
+sc_bool sc_elements_iterator_next(sc_elements_iterator * it)
+{
+  sc_result result;
+  return sc_elements_iterator_next_ext(it, &result);
+}
+
+sc_bool sc_elements_iterator_next_ext(sc_elements_iterator * it, sc_result * result)
+{
+  *result = SC_RESULT_OK;
+  if (it == null_ptr)
+  {
+    *result = SC_RESULT_NO;
+    return SC_FALSE;
+  }
+
+  if (it->finished == SC_TRUE)
+    return SC_FALSE;
+
+  if (_sc_memory_context_is_authenticated(sc_memory_get_context_manager(), it->ctx) == SC_FALSE)
+  {
+    *result = SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED;
+    return SC_FALSE;
+  }
+
+  sc_addr addr = it->addr;
+  while (sc_storage_get_next_element_by_type(it->type, &addr) == SC_RESULT_OK)
+  {
+    sc_monitor * monitor = sc_monitor_table_get_monitor_for_addr(&sc_storage_get()->addr_monitors_table, addr);
+    sc_monitor_acquire_read(monitor);
+
+    // index of sc-elements by types is read without locks, so found sc-element is checked under its monitor
+    sc_element * el = null_ptr;
+    sc_bool const is_found = sc_storage_get_element_by_addr(addr, &el) == SC_RESULT_OK
+                             && sc_iterator_compare_type(el->flags.type, it->type)
+                             && _sc_memory_context_check_local_and_global_permissions(
+                                    sc_memory_get_context_manager(), it->ctx, SC_CONTEXT_PERMISSIONS_READ, addr);
+
+    sc_monitor_release_read(monitor);
+
+    if (is_found)
+    {
+      it->addr = addr;
+      return SC_TRUE;
+    }
+  }
+
+  it->addr = SC_ADDR_EMPTY;
+  it->finished = SC_TRUE;
+  return SC_FALSE;
+}
+
+sc_addr sc_elements_iterator_value(sc_elements_iterator * it)
+{
+  if (it == null_ptr)
+    return SC_ADDR_EMPTY;
+
+  return it->addr;
+}
@@ -0,0 +1,72 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "sc_elements_stat.h"
+
+#include "sc-core/sc-base/sc_allocator.h"
+
+#include "sc-store/sc-base/sc_thread.h"
+
+sc_elements_stat_shard * _sc_elements_stat_get_thread_shard(sc_elements_stat * stat)
+{
+  // threads are allocated on heap, so low bits of their pointers are the same
+  sc_uint64 const thread_hash = (sc_uint64)sc_thread_self() >> 6;
+  return &stat->shards[thread_hash % SC_ELEMENTS_STAT_SHARDS_COUNT];
+}
+
+void _sc_elements_stat_shard_add(sc_elements_stat_shard * shard, sc_type type, gssize delta)
+{
+  if (sc_type_has_subtype(type, sc_type_node))
+  {
+    g_atomic_pointer_add(&shard->node_count, delta);
+    if (sc_type_has_subtype(type, sc_type_node_link))
+      g_atomic_pointer_add(&shard->link_count, delta);
+  }
+  else if (sc_type_has_subtype_in_mask(type, sc_type_connector_mask))
+    g_atomic_pointer_add(&shard->connector_count, delta);
+}
+
+void sc_elements_stat_reset(sc_elements_stat * stat)
+{
+  sc_mem_set(stat, 0, sizeof(sc_elements_stat));
+}
+
+void sc_elements_stat_append(sc_elements_stat * stat, sc_type type)
+{
+  _sc_elements_stat_shard_add(_sc_elements_stat_get_thread_shard(stat), type, 1);
+}
+
+void sc_elements_stat_remove(sc_elements_stat * stat, sc_type type)
+{
+  _sc_elements_stat_shard_add(_sc_elements_stat_get_thread_shard(stat), type, -1);
+}
+
+void sc_elements_stat_add(sc_elements_stat * stat, sc_stat const * other)
+{
+  sc_elements_stat_shard * shard = _sc_elements_stat_get_thread_shard(stat);
+  g_atomic_pointer_add(&shard->node_count, (gssize)other->node_count);
+  g_atomic_pointer_add(&shard->link_count, (gssize)other->link_count);
+  g_atomic_pointer_add(&shard->connector_count, (gssize)other->connector_count);
+}
+
+void sc_elements_stat_get(sc_elements_stat * stat, sc_stat * result)
+{
+  gssize node_count = 0;
+  gssize link_count = 0;
+  gssize connector_count = 0;
+  for (sc_uint32 i = 0; i < SC_ELEMENTS_STAT_SHARDS_COUNT; ++i)
+  {
+    sc_elements_stat_shard * shard = &stat->shards[i];
+    node_count += (gssize)g_atomic_pointer_get(&shard->node_count);
+    link_count += (gssize)g_atomic_pointer_get(&shard->link_count);
+    connector_count += (gssize)g_atomic_pointer_get(&shard->connector_count);
+  }
+
+  // sums can be negative for a moment, if sc-element is erased while its generation is counted by another shard
+  result->node_count = node_count > 0 ? (sc_uint64)node_count : 0;
+  result->link_count = link_count > 0 ? (sc_uint64)link_count : 0;
+  result->connector_count = connector_count > 0 ? (sc_uint64)connector_count : 0;
+}
@@ -0,0 +1,70 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#ifndef _sc_elements_stat_h_
+#define _sc_elements_stat_h_
+
+#include <glib.h>
+
+#include "sc-core/sc_types.h"
+
+//! Number of shards of counters, threads update counters of different shards to not contend for the same counters
+#define SC_ELEMENTS_STAT_SHARDS_COUNT 16
+#define SC_ELEMENTS_STAT_CACHE_LINE_SIZE 64
+
+/*! Counters of sc-elements updated by one or several threads. Counters of shard can be negative if sc-elements are
+ * generated by one thread and erased by another one, only sum of counters of all shards is meaningful.
+ */
+typedef struct _sc_elements_stat_shard
+{
+  gssize node_count;
+  gssize link_count;
+  gssize connector_count;
+  sc_char padding[SC_ELEMENTS_STAT_CACHE_LINE_SIZE - 3 * sizeof(gssize)];
+} sc_elements_stat_shard;
+
+/*! Statistics of sc-elements maintained incrementally when sc-elements are generated, erased or their types are
+ * changed, so it is got without scanning all sc-segments.
+ */
+typedef struct _sc_elements_stat
+{
+  sc_elements_stat_shard shards[SC_ELEMENTS_STAT_SHARDS_COUNT];
+} sc_elements_stat;
+
+/*! Resets all counters of statistics.
+ * @param stat A pointer to statistics.
+ */
+void sc_elements_stat_reset(sc_elements_stat * stat);
+
+/*! Counts sc-element with specified type in statistics.
+ * @param stat A pointer to statistics.
+ * @param type A type of counted sc-element.
+ * @note This function is thread-safe.
+ */
+void sc_elements_stat_append(sc_elements_stat * stat, sc_type type);
+
+/*! Stops to count sc-element with specified type in statistics.
+ * @param stat A pointer to statistics.
+ * @param type A type of sc-element counted earlier.
+ * @note This function is thread-safe.
+ */
+void sc_elements_stat_remove(sc_elements_stat * stat, sc_type type);
+
+/*! Adds counters calculated by scanning sc-elements, for example, after sc-segments are loaded.
+ * @param stat A pointer to statistics.
+ * @param other A pointer to calculated counters.
+ * @note This function is thread-safe.
+ */
+void sc_elements_stat_add(sc_elements_stat * stat, sc_stat const * other);
+
+/*! Gets sums of counters of all shards.
+ * @param stat A pointer to statistics.
+ * @param result A pointer to counters to fill.
+ * @note This function is thread-safe.
+ */
+void sc_elements_stat_get(sc_elements_stat * stat, sc_stat * result);
+
+#endif
@@ -0,0 +1,124 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "sc_elements_types_index.h"
+
+#include "sc-core/sc-base/sc_allocator.h"
+
+sc_elements_types_index * sc_elements_types_index_new()
+{
+  return sc_mem_new(sc_elements_types_index, 1);
+}
+
+void sc_elements_types_index_free(sc_elements_types_index * index)
+{
+  sc_mem_free(index);
+}
+
+void sc_elements_types_index_append(sc_elements_types_index * index, sc_addr_offset offset, sc_type type)
+{
+  sc_uint32 const word_idx = offset / SC_ELEMENTS_TYPES_INDEX_WORD_BITS;
+  guint const bit = 1u << (offset % SC_ELEMENTS_TYPES_INDEX_WORD_BITS);
+
+  for (sc_uint32 i = 0; i < SC_ELEMENTS_TYPES_INDEX_BITMAPS_COUNT; ++i)
+  {
+    if ((type >> i) & 1)
+      g_atomic_int_or(&index->bitmaps[i][word_idx], bit);
+  }
+}
+
+void sc_elements_types_index_remove(sc_elements_types_index * index, sc_addr_offset offset, sc_type type)
+{
+  sc_uint32 const word_idx = offset / SC_ELEMENTS_TYPES_INDEX_WORD_BITS;
+  guint const bit = 1u << (offset % SC_ELEMENTS_TYPES_INDEX_WORD_BITS);
+
+  for (sc_uint32 i = 0; i < SC_ELEMENTS_TYPES_INDEX_BITMAPS_COUNT; ++i)
+  {
+    if ((type >> i) & 1)
+      g_atomic_int_and(&index->bitmaps[i][word_idx], ~bit);
+  }
+}
+
+//! Intersects words of bitmaps in the block, iterations over words of the block are independent and vectorized
+void _sc_elements_types_index_intersect_block(
+    guint const ** bitmaps,
+    sc_uint32 bitmaps_count,
+    sc_bool is_union,
+    sc_uint32 word_idx,
+    sc_uint32 block_size,
+    guint * block)
+{
+  guint const * bitmap = bitmaps[0] + word_idx;
+  for (sc_uint32 i = 0; i < block_size; ++i)
+    block[i] = bitmap[i];
+
+  for (sc_uint32 j = 1; j < bitmaps_count; ++j)
+  {
+    bitmap = bitmaps[j] + word_idx;
+    if (is_union)
+    {
+      for (sc_uint32 i = 0; i < block_size; ++i)
+        block[i] |= bitmap[i];
+    }
+    else
+    {
+      for (sc_uint32 i = 0; i < block_size; ++i)
+        block[i] &= bitmap[i];
+    }
+  }
+}
+
+sc_uint32 sc_elements_types_index_next(
+    sc_elements_types_index const * index,
+    sc_type type,
+    sc_uint32 offset,
+    sc_uint32 end_offset)
+{
+  if (offset >= end_offset)
+    return end_offset;
+
+  guint const * bitmaps[SC_ELEMENTS_TYPES_INDEX_BITMAPS_COUNT];
+  sc_uint32 bitmaps_count = 0;
+
+  // each sc-element is sc-node or sc-connector, so sc-elements of all types are found by union of these bitmaps
+  sc_bool const is_union = type == sc_type_unknown;
+  if (is_union)
+    type = sc_type_node | sc_type_connector;
+
+  for (sc_uint32 i = 0; i < SC_ELEMENTS_TYPES_INDEX_BITMAPS_COUNT; ++i)
+  {
+    if ((type >> i) & 1)
+      bitmaps[bitmaps_count++] = index->bitmaps[i];
+  }
+
+  sc_uint32 word_idx = offset / SC_ELEMENTS_TYPES_INDEX_WORD_BITS;
+  sc_uint32 const end_word_idx =
+      (end_offset + SC_ELEMENTS_TYPES_INDEX_WORD_BITS - 1) / SC_ELEMENTS_TYPES_INDEX_WORD_BITS;
+  guint first_word_mask = ~0u << (offset % SC_ELEMENTS_TYPES_INDEX_WORD_BITS);
+
+  guint block[SC_ELEMENTS_TYPES_INDEX_BLOCK_WORDS_COUNT];
+  while (word_idx < end_word_idx)
+  {
+    sc_uint32 const block_size = MIN(SC_ELEMENTS_TYPES_INDEX_BLOCK_WORDS_COUNT, end_word_idx - word_idx);
+    _sc_elements_types_index_intersect_block(bitmaps, bitmaps_count, is_union, word_idx, block_size, block);
+    block[0] &= first_word_mask;
+    first_word_mask = ~0u;
+
+    for (sc_uint32 i = 0; i < block_size; ++i)
+    {
+      if (block[i] == 0)
+        continue;
+
+      sc_uint32 const found_offset =
+          (word_idx + i) * SC_ELEMENTS_TYPES_INDEX_WORD_BITS + (sc_uint32)g_bit_nth_lsf(block[i], -1);
+      return found_offset < end_offset ? found_offset : end_offset;
+    }
+
+    word_idx += block_size;
+  }
+
+  return end_offset;
+}
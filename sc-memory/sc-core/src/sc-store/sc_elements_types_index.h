@@ -0,0 +1,72 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#ifndef _sc_elements_types_index_h_
+#define _sc_elements_types_index_h_
+
+#include <glib.h>
+
+#include "sc-core/sc_types.h"
+
+//! Number of bitmaps of index, one bitmap for each bit of sc-type
+#define SC_ELEMENTS_TYPES_INDEX_BITMAPS_COUNT (sizeof(sc_type) * 8)
+#define SC_ELEMENTS_TYPES_INDEX_WORD_BITS (sizeof(guint) * 8)
+#define SC_ELEMENTS_TYPES_INDEX_WORDS_COUNT \
+  ((SC_SEGMENT_ELEMENTS_COUNT + SC_ELEMENTS_TYPES_INDEX_WORD_BITS - 1) / SC_ELEMENTS_TYPES_INDEX_WORD_BITS)
+//! Number of words of bitmaps intersected at once while scanning, the block is skipped if intersection is empty
+#define SC_ELEMENTS_TYPES_INDEX_BLOCK_WORDS_COUNT 8
+
+/*! Index of sc-elements of one sc-segment by their types. The index contains a bitmap for each bit of sc-type, the
+ * bit of bitmap with number of sc-element offset is set if type of this sc-element has this bit. So offsets of
+ * sc-elements which types have all bits of the specified type are found by intersection of several bitmaps.
+ */
+typedef struct _sc_elements_types_index
+{
+  guint bitmaps[SC_ELEMENTS_TYPES_INDEX_BITMAPS_COUNT][SC_ELEMENTS_TYPES_INDEX_WORDS_COUNT];
+} sc_elements_types_index;
+
+/*! Creates an empty index of sc-elements by their types.
+ * @returns A pointer to created index.
+ */
+sc_elements_types_index * sc_elements_types_index_new();
+
+/*! Destroys index of sc-elements by their types.
+ * @param index A pointer to destroyed index.
+ */
+void sc_elements_types_index_free(sc_elements_types_index * index);
+
+/*! Adds sc-element with specified offset and type to index.
+ * @param index A pointer to index.
+ * @param offset An offset of sc-element in sc-segment.
+ * @param type A type of sc-element.
+ * @note This function is thread-safe.
+ */
+void sc_elements_types_index_append(sc_elements_types_index * index, sc_addr_offset offset, sc_type type);
+
+/*! Removes sc-element with specified offset and type from index.
+ * @param index A pointer to index.
+ * @param offset An offset of sc-element in sc-segment.
+ * @param type A type of sc-element added to index earlier.
+ * @note This function is thread-safe.
+ */
+void sc_elements_types_index_remove(sc_elements_types_index * index, sc_addr_offset offset, sc_type type);
+
+/*! Finds the first offset of sc-element which type has all bits of the specified type.
+ * @param index A pointer to index.
+ * @param type A type of sc-elements to find. If it is `sc_type_unknown`, then sc-elements of all types are found.
+ * @param offset An offset to start search from, inclusive.
+ * @param end_offset An offset to stop search at, exclusive.
+ * @returns The found offset or `end_offset` if there are no sc-elements of the specified type in range.
+ * @note Index may be changed concurrently, so type of sc-element with found offset should be checked again under
+ * the monitor of sc-element.
+ */
+sc_uint32 sc_elements_types_index_next(
+    sc_elements_types_index const * index,
+    sc_type type,
+    sc_uint32 offset,
+    sc_uint32 end_offset);
+
+#endif
@@ -208,6 +208,7 @@ sc_iterator3 * sc_iterator3_new(
   it->type = type;
   it->ctx = ctx;
   it->finished = SC_FALSE;
+  it->is_outgoing_walk = SC_FALSE;
 
   return it;
 }
@@ -225,8 +226,18 @@ sc_addr _sc_iterator3_get_other_edge_incident_element(sc_element * el, sc_addr i
   return SC_ADDR_IS_EQUAL(incident_element, el->arc.end) ? el->arc.begin : el->arc.end;
 }
 
-sc_bool _sc_iterator3_f_a_a_next(sc_iterator3 * it)
+void _sc_iterator3_store_batch_result(sc_iterator3 const * it, sc_addr * results, sc_uint32 index)
+{
+  if (results == null_ptr)
+    return;
+
+  for (sc_uint32 i = 0; i < 3; ++i)
+    results[index * 3 + i] = it->results[i].is_accessed ? it->results[i].addr : SC_ADDR_EMPTY;
+}
+
+sc_uint32 _sc_iterator3_f_a_a_next_batch(sc_iterator3 * it, sc_addr * results, sc_uint32 max_count)
 {
+  sc_uint32 count = 0;
   sc_addr const arc_begin = it->results[0].addr = it->params[0].addr;
 
   sc_addr arc_addr = SC_ADDR_EMPTY;
@@ -300,6 +311,7 @@ sc_bool _sc_iterator3_f_a_a_next(sc_iterator3 * it)
         sc_type_has_subtype(el->flags.type, sc_type_common_edge)
             ? SC_ADDR_IS_EQUAL(arc_begin, el->arc.end) ? el->arc.next_end_out_arc : el->arc.next_begin_out_arc
             : el->arc.next_begin_out_arc;
+    sc_storage_prefetch_element(next_out_arc);
 
     if (_sc_memory_context_check_local_and_global_permissions(
             sc_memory_get_context_manager(), it->ctx, SC_CONTEXT_PERMISSIONS_READ, arc_addr)
@@ -327,26 +339,34 @@ sc_bool _sc_iterator3_f_a_a_next(sc_iterator3 * it)
     if (is_not_same)
       sc_monitor_release_read(arc_monitor);
 
-    sc_type el_type;
-    result = sc_storage_get_element_type(it->ctx, arc_end, &el_type);
-    if (result != SC_RESULT_OK)
-      goto error;
+    // type of end sc-element isn't needed to count constructions if it isn't filtered
+    sc_type el_type = sc_type_unknown;
+    if (results != null_ptr || it->params[2].type != sc_type_unknown)
+    {
+      result = sc_storage_get_element_type(it->ctx, arc_end, &el_type);
+      if (result != SC_RESULT_OK)
+        goto error;
+    }
 
     if (sc_iterator_compare_type(arc_type, it->params[1].type) && sc_iterator_compare_type(el_type, it->params[2].type))
     {
       // store found result
       it->results[1].addr = arc_addr;
       it->results[1].is_accessed = SC_TRUE;
+      it->results[2].is_accessed = SC_FALSE;
 
-      if (_sc_memory_context_check_local_and_global_permissions(
-              sc_memory_get_context_manager(), it->ctx, SC_CONTEXT_PERMISSIONS_READ, arc_end)
-          == SC_TRUE)
+      if (results != null_ptr
+          && _sc_memory_context_check_local_and_global_permissions(
+                 sc_memory_get_context_manager(), it->ctx, SC_CONTEXT_PERMISSIONS_READ, arc_end)
+                 == SC_TRUE)
       {
         it->results[2].addr = arc_end;
         it->results[2].is_accessed = SC_TRUE;
       }
 
-      goto success;
+      _sc_iterator3_store_batch_result(it, results, count);
+      if (++count == max_count)
+        goto success;
     }
 
     // go to next arc
@@ -357,15 +377,37 @@ sc_bool _sc_iterator3_f_a_a_next(sc_iterator3 * it)
 error:
   sc_monitor_release_read(monitor);
   it->finished = SC_TRUE;
-  return SC_FALSE;
+  return count;
 
 success:
   sc_monitor_release_read(monitor);
-  return SC_TRUE;
+  return count;
 }
 
-sc_bool _sc_iterator3_f_a_f_next(sc_iterator3 * it)
+sc_bool _sc_iterator3_f_a_a_next(sc_iterator3 * it)
+{
+  sc_addr results[3];
+  return _sc_iterator3_f_a_a_next_batch(it, results, 1) == 1;
+}
+
+sc_addr _sc_iterator3_f_a_f_get_next_connector(sc_iterator3 * it, sc_element * el)
+{
+  sc_addr const arc_begin = it->params[0].addr;
+  sc_addr const arc_end = it->params[2].addr;
+
+  if (it->is_outgoing_walk)
+    return sc_type_has_subtype(el->flags.type, sc_type_common_edge)
+               ? SC_ADDR_IS_EQUAL(arc_begin, el->arc.end) ? el->arc.next_end_out_arc : el->arc.next_begin_out_arc
+               : el->arc.next_begin_out_arc;
+
+  return sc_type_has_subtype(el->flags.type, sc_type_common_edge)
+             ? SC_ADDR_IS_EQUAL(arc_end, el->arc.end) ? el->arc.next_end_in_arc : el->arc.next_begin_in_arc
+             : el->arc.next_end_in_arc;
+}
+
+sc_uint32 _sc_iterator3_f_a_f_next_batch(sc_iterator3 * it, sc_addr * results, sc_uint32 max_count)
 {
+  sc_uint32 count = 0;
   sc_addr const arc_begin = it->results[0].addr = it->params[0].addr;
   sc_addr const arc_end = it->results[2].addr = it->params[2].addr;
 
@@ -390,15 +432,22 @@ sc_bool _sc_iterator3_f_a_f_next(sc_iterator3 * it)
     goto error;
   it->results[2].is_accessed = SC_TRUE;
 
-  // try to find first incoming sc-arc
+  // try to find first sc-connector in the shorter list: outgoing sc-connectors of begin sc-element or incoming ones
+  // of end sc-element, so membership of sc-element in large set is checked by few sc-connectors
   sc_element * el = null_ptr;
   if (sc_storage_get_element_by_addr(it->results[1].addr, &el) != SC_RESULT_OK)
   {
+    sc_element * beg_el = null_ptr;
+    result = sc_storage_get_element_by_addr(arc_begin, &beg_el);
+    if (result != SC_RESULT_OK)
+      goto error;
+
     result = sc_storage_get_element_by_addr(arc_end, &el);
     if (result != SC_RESULT_OK)
       goto error;
 
-    arc_addr = el->first_in_arc;
+    it->is_outgoing_walk = beg_el->outgoing_arcs_count < el->incoming_arcs_count;
+    arc_addr = it->is_outgoing_walk ? beg_el->first_out_arc : el->first_in_arc;
   }
   else
   {
@@ -418,15 +467,13 @@ sc_bool _sc_iterator3_f_a_f_next(sc_iterator3 * it)
       goto error;
     }
 
-    arc_addr = sc_type_has_subtype(el->flags.type, sc_type_common_edge)
-                   ? SC_ADDR_IS_EQUAL(arc_end, el->arc.end) ? el->arc.next_end_in_arc : el->arc.next_begin_in_arc
-                   : el->arc.next_end_in_arc;
+    arc_addr = _sc_iterator3_f_a_f_get_next_connector(it, el);
 
     if (is_not_same)
       sc_monitor_release_read(arc_monitor);
   }
 
-  // trying to find incoming sc-arc, that created before iterator, and wasn't deleted
+  // trying to find sc-connector, that created before iterator, and wasn't deleted
   while (SC_ADDR_IS_NOT_EMPTY(arc_addr))
   {
     sc_bool const is_not_same = SC_ADDR_IS_NOT_EQUAL(arc_begin, arc_addr) && SC_ADDR_IS_NOT_EQUAL(arc_end, arc_addr);
@@ -444,10 +491,8 @@ sc_bool _sc_iterator3_f_a_f_next(sc_iterator3 * it)
       goto error;
     }
 
-    sc_addr next_in_arc =
-        sc_type_has_subtype(el->flags.type, sc_type_common_edge)
-            ? SC_ADDR_IS_EQUAL(arc_end, el->arc.end) ? el->arc.next_end_in_arc : el->arc.next_begin_in_arc
-            : el->arc.next_end_in_arc;
+    sc_addr const next_connector = _sc_iterator3_f_a_f_get_next_connector(it, el);
+    sc_storage_prefetch_element(next_connector);
 
     if (_sc_memory_context_check_local_and_global_permissions(
             sc_memory_get_context_manager(), it->ctx, SC_CONTEXT_PERMISSIONS_READ, arc_addr)
@@ -469,38 +514,52 @@ sc_bool _sc_iterator3_f_a_f_next(sc_iterator3 * it)
 
     sc_type arc_type = el->flags.type;
 
-    sc_bool is_begin_same = sc_type_has_subtype(el->flags.type, sc_type_common_edge)
-                                ? SC_ADDR_IS_EQUAL(arc_begin, el->arc.begin) || SC_ADDR_IS_EQUAL(arc_begin, el->arc.end)
-                                : SC_ADDR_IS_EQUAL(arc_begin, el->arc.begin);
+    // sc-connector is incident to one of specified sc-elements, because it is found in list of this sc-element
+    sc_addr const other_addr = it->is_outgoing_walk ? arc_end : arc_begin;
+    sc_addr const other_incident_addr = it->is_outgoing_walk ? el->arc.end : el->arc.begin;
+    sc_bool const is_other_same =
+        sc_type_has_subtype(el->flags.type, sc_type_common_edge)
+            ? SC_ADDR_IS_EQUAL(other_addr, el->arc.begin) || SC_ADDR_IS_EQUAL(other_addr, el->arc.end)
+            : SC_ADDR_IS_EQUAL(other_addr, other_incident_addr);
 
     if (is_not_same)
       sc_monitor_release_read(arc_monitor);
 
-    if (is_begin_same && sc_iterator_compare_type(arc_type, it->params[1].type))
+    if (is_other_same && sc_iterator_compare_type(arc_type, it->params[1].type))
     {
       // store found result
       it->results[1].addr = arc_addr;
       it->results[1].is_accessed = SC_TRUE;
-      goto success;
+
+      _sc_iterator3_store_batch_result(it, results, count);
+      if (++count == max_count)
+        goto success;
     }
 
     // go to next arc
   next:
-    arc_addr = next_in_arc;
+    arc_addr = next_connector;
   }
 
 error:
   sc_monitor_release_read_n(2, beg_monitor, end_monitor);
   it->finished = SC_TRUE;
-  return SC_FALSE;
+  return count;
 
 success:
   sc_monitor_release_read_n(2, beg_monitor, end_monitor);
-  return SC_TRUE;
+  return count;
 }
 
-sc_bool _sc_iterator3_a_a_f_next(sc_iterator3 * it)
+sc_bool _sc_iterator3_f_a_f_next(sc_iterator3 * it)
+{
+  sc_addr results[3];
+  return _sc_iterator3_f_a_f_next_batch(it, results, 1) == 1;
+}
+
+sc_uint32 _sc_iterator3_a_a_f_next_batch(sc_iterator3 * it, sc_addr * results, sc_uint32 max_count)
 {
+  sc_uint32 count = 0;
   sc_addr const arc_end = it->results[2].addr = it->params[2].addr;
 #ifdef SC_OPTIMIZE_SEARCHING_INCOMING_CONNECTORS_FROM_STRUCTURES
   sc_bool const search_structure = sc_type_is_structure_and_arc(it->params[0].type, it->params[1].type);
@@ -589,6 +648,7 @@ sc_bool _sc_iterator3_a_a_f_next(sc_iterator3 * it)
 #else
             : el->arc.next_end_in_arc;
 #endif
+    sc_storage_prefetch_element(next_in_arc);
 
     if (_sc_memory_context_check_local_and_global_permissions(
             sc_memory_get_context_manager(), it->ctx, SC_CONTEXT_PERMISSIONS_READ, arc_addr)
@@ -616,24 +676,30 @@ sc_bool _sc_iterator3_a_a_f_next(sc_iterator3 * it)
     if (is_not_same)
       sc_monitor_release_read(arc_monitor);
 
-    sc_type el_type = 0;
-    sc_storage_get_element_type(it->ctx, arc_begin, &el_type);
+    // type of begin sc-element isn't needed to count constructions if it isn't filtered
+    sc_type el_type = sc_type_unknown;
+    if (results != null_ptr || it->params[0].type != sc_type_unknown)
+      sc_storage_get_element_type(it->ctx, arc_begin, &el_type);
 
     if (sc_iterator_compare_type(arc_type, it->params[1].type) && sc_iterator_compare_type(el_type, it->params[0].type))
     {
       // store found result
       it->results[1].addr = arc_addr;
       it->results[1].is_accessed = SC_TRUE;
+      it->results[0].is_accessed = SC_FALSE;
 
-      if (_sc_memory_context_check_local_and_global_permissions(
-              sc_memory_get_context_manager(), it->ctx, SC_CONTEXT_PERMISSIONS_READ, arc_begin)
-          == SC_TRUE)
+      if (results != null_ptr
+          && _sc_memory_context_check_local_and_global_permissions(
+                 sc_memory_get_context_manager(), it->ctx, SC_CONTEXT_PERMISSIONS_READ, arc_begin)
+                 == SC_TRUE)
       {
         it->results[0].addr = arc_begin;
         it->results[0].is_accessed = SC_TRUE;
       }
 
-      goto success;
+      _sc_iterator3_store_batch_result(it, results, count);
+      if (++count == max_count)
+        goto success;
     }
 
     // go to next arc
@@ -644,11 +710,17 @@ sc_bool _sc_iterator3_a_a_f_next(sc_iterator3 * it)
 error:
   sc_monitor_release_read(monitor);
   it->finished = SC_TRUE;
-  return SC_FALSE;
+  return count;
 
 success:
   sc_monitor_release_read(monitor);
-  return SC_TRUE;
+  return count;
+}
+
+sc_bool _sc_iterator3_a_a_f_next(sc_iterator3 * it)
+{
+  sc_addr results[3];
+  return _sc_iterator3_a_a_f_next_batch(it, results, 1) == 1;
 }
 
 sc_bool _sc_iterator3_a_f_a_next(sc_iterator3 * it)
@@ -894,6 +966,36 @@ error:
   return SC_FALSE;
 }
 
+sc_bool _sc_iterator3_next(sc_iterator3 * it)
+{
+  switch (it->type)
+  {
+  case sc_iterator3_f_a_a:
+    return _sc_iterator3_f_a_a_next(it);
+
+  case sc_iterator3_f_a_f:
+    return _sc_iterator3_f_a_f_next(it);
+
+  case sc_iterator3_a_a_f:
+    return _sc_iterator3_a_a_f_next(it);
+
+  case sc_iterator3_a_f_a:
+    return _sc_iterator3_a_f_a_next(it);
+
+  case sc_iterator3_f_f_a:
+    return _sc_iterator3_f_f_a_next(it);
+
+  case sc_iterator3_a_f_f:
+    return _sc_iterator3_a_f_f_next(it);
+
+  case sc_iterator3_f_f_f:
+    return _sc_iterator3_f_f_f_next(it);
+
+  default:
+    return SC_FALSE;
+  }
+}
+
 sc_bool sc_iterator3_next(sc_iterator3 * it)
 {
   sc_result result;
@@ -928,48 +1030,130 @@ sc_bool sc_iterator3_next_ext(sc_iterator3 * it, sc_result * result)
     return status;
   }
 
+  status = _sc_iterator3_next(it);
+
+  if (status == SC_FALSE)
+  {
+    it->results[0] = SC_ITERATOR_RESULT_EMPTY;
+    it->results[1] = SC_ITERATOR_RESULT_EMPTY;
+    it->results[2] = SC_ITERATOR_RESULT_EMPTY;
+  }
+
+  return status;
+}
+
+sc_uint32 sc_iterator3_next_batch(sc_iterator3 * it, sc_addr * results, sc_uint32 max_count)
+{
+  sc_result result;
+  return sc_iterator3_next_batch_ext(it, results, max_count, &result);
+}
+
+//! Goes to up to `max_count` next results (all results if `max_count` is 0). If `results` is null, then found
+//! constructions are only counted, and sc-elements of them aren't checked and stored.
+sc_uint32 _sc_iterator3_next_n(sc_iterator3 * it, sc_addr * results, sc_uint32 max_count, sc_result * result)
+{
+  sc_uint32 count = 0;
+
+  it->results[0].is_accessed = SC_FALSE;
+  it->results[1].is_accessed = SC_FALSE;
+  it->results[2].is_accessed = SC_FALSE;
+
+  if (it->finished == SC_TRUE)
+  {
+    it->results[0] = SC_ITERATOR_RESULT_EMPTY;
+    it->results[1] = SC_ITERATOR_RESULT_EMPTY;
+    it->results[2] = SC_ITERATOR_RESULT_EMPTY;
+    return count;
+  }
+
+  if (_sc_memory_context_is_authenticated(sc_memory_get_context_manager(), it->ctx) == SC_FALSE)
+  {
+    *result = SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED;
+    return count;
+  }
+
   switch (it->type)
   {
+  // fixed sc-elements are locked only once for all found constructions
   case sc_iterator3_f_a_a:
-    status = _sc_iterator3_f_a_a_next(it);
+    count = _sc_iterator3_f_a_a_next_batch(it, results, max_count);
     break;
 
   case sc_iterator3_f_a_f:
-    status = _sc_iterator3_f_a_f_next(it);
+    count = _sc_iterator3_f_a_f_next_batch(it, results, max_count);
     break;
 
   case sc_iterator3_a_a_f:
-    status = _sc_iterator3_a_a_f_next(it);
+    count = _sc_iterator3_a_a_f_next_batch(it, results, max_count);
     break;
 
-  case sc_iterator3_a_f_a:
-    status = _sc_iterator3_a_f_a_next(it);
-    break;
-
-  case sc_iterator3_f_f_a:
-    status = _sc_iterator3_f_f_a_next(it);
-    break;
-
-  case sc_iterator3_a_f_f:
-    status = _sc_iterator3_a_f_f_next(it);
-    break;
+  default:
+    while ((max_count == 0 || count < max_count) && it->finished == SC_FALSE)
+    {
+      it->results[0].is_accessed = SC_FALSE;
+      it->results[1].is_accessed = SC_FALSE;
+      it->results[2].is_accessed = SC_FALSE;
 
-  case sc_iterator3_f_f_f:
-    status = _sc_iterator3_f_f_f_next(it);
-    break;
+      if (_sc_iterator3_next(it) == SC_FALSE)
+        break;
 
-  default:
+      _sc_iterator3_store_batch_result(it, results, count);
+      ++count;
+    }
     break;
   }
 
-  if (status == SC_FALSE)
+  if (count == 0)
   {
     it->results[0] = SC_ITERATOR_RESULT_EMPTY;
     it->results[1] = SC_ITERATOR_RESULT_EMPTY;
     it->results[2] = SC_ITERATOR_RESULT_EMPTY;
   }
 
-  return status;
+  return count;
+}
+
+sc_uint32 sc_iterator3_next_batch_ext(sc_iterator3 * it, sc_addr * results, sc_uint32 max_count, sc_result * result)
+{
+  *result = SC_RESULT_OK;
+  if (it == null_ptr)
+  {
+    *result = SC_RESULT_NO;
+    return 0;
+  }
+
+  if (results == null_ptr || max_count == 0)
+  {
+    *result = SC_RESULT_ERROR_INVALID_PARAMS;
+    return 0;
+  }
+
+  return _sc_iterator3_next_n(it, results, max_count, result);
+}
+
+sc_uint32 sc_iterator3_count_next(sc_iterator3 * it, sc_uint32 max_count)
+{
+  sc_result result;
+  return sc_iterator3_count_next_ext(it, max_count, &result);
+}
+
+sc_uint32 sc_iterator3_count_next_ext(sc_iterator3 * it, sc_uint32 max_count, sc_result * result)
+{
+  *result = SC_RESULT_OK;
+  if (it == null_ptr)
+  {
+    *result = SC_RESULT_NO;
+    return 0;
+  }
+
+  sc_uint32 const count = _sc_iterator3_next_n(it, null_ptr, max_count, result);
+
+  // sc-elements of counted constructions aren't checked, so they can't be got by iterator
+  it->results[0].is_accessed = SC_FALSE;
+  it->results[1].is_accessed = SC_FALSE;
+  it->results[2].is_accessed = SC_FALSE;
+
+  return count;
 }
 
 sc_addr sc_iterator3_value(sc_iterator3 * it, sc_uint index)
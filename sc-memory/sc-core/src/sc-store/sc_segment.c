@@ -17,6 +17,7 @@ sc_segment * sc_segment_new(sc_addr_seg num)
   segment->last_engaged_offset = 0;
   segment->last_released_offset = 0;
   sc_monitor_init(&segment->monitor);
+  segment->types_index = null_ptr;
 
   return segment;
 }
@@ -24,18 +25,34 @@ sc_segment * sc_segment_new(sc_addr_seg num)
 void sc_segment_free(sc_segment * segment)
 {
   sc_monitor_destroy(&segment->monitor);
+  if (segment->types_index != null_ptr)
+    sc_elements_types_index_free(segment->types_index);
   sc_mem_free(segment);
 }
 
+void sc_segment_index_elements_types(sc_segment * segment)
+{
+  segment->types_index = sc_elements_types_index_new();
+
+  for (sc_addr_offset i = 1; i <= segment->last_engaged_offset; ++i)
+  {
+    sc_element const * element = &segment->elements[i];
+    if ((element->flags.states & SC_STATE_ELEMENT_EXIST) == 0)
+      continue;
+
+    sc_elements_types_index_append(segment->types_index, i, element->flags.type);
+  }
+}
+
 void sc_segment_collect_elements_stat(sc_segment * seg, sc_stat * stat)
 {
-  for (sc_addr_offset i = 0; i < seg->last_engaged_offset; ++i)
+  for (sc_addr_offset i = 1; i <= seg->last_engaged_offset; ++i)
   {
-    sc_element element = seg->elements[i];
-    if ((element.flags.states & SC_STATE_ELEMENT_EXIST) == 0)
+    sc_element const * element = &seg->elements[i];
+    if ((element->flags.states & SC_STATE_ELEMENT_EXIST) == 0)
       continue;
 
-    sc_type type = element.flags.type;
+    sc_type const type = element->flags.type;
     if (sc_type_has_subtype(type, sc_type_node))
     {
       stat->node_count++;
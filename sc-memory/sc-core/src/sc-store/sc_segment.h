@@ -14,6 +14,7 @@
 #include "sc-core/sc_types.h"
 
 #include "sc_element.h"
+#include "sc_elements_types_index.h"
 
 #include "sc-store/sc-base/sc_monitor_private.h"
 
@@ -28,6 +29,7 @@ struct _sc_segment
   sc_addr_offset last_engaged_offset;  // number of sc-element in the segment
   sc_addr_offset last_released_offset;
   sc_monitor monitor;
+  sc_elements_types_index * types_index;  // index of sc-elements by their types, it is null if it is disabled
 };
 
 /*! Create new segment with specified size.
@@ -37,6 +39,11 @@ sc_segment * sc_segment_new(sc_addr_seg num);
 
 void sc_segment_free(sc_segment * segment);
 
+/*! Creates index of sc-elements of segment by their types and adds all existing sc-elements of segment to it.
+ * @param segment A pointer to indexed segment.
+ */
+void sc_segment_index_elements_types(sc_segment * segment);
+
 //! Collects segment elements statistics
 void sc_segment_collect_elements_stat(sc_segment * seg, sc_stat * stat);
 
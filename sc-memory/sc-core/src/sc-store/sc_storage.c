@@ -6,6 +6,8 @@
 
 #include "sc_storage.h"
 
+#include <stdlib.h>
+
 #include "sc-core/sc_event_subscription.h"
 
 #include "sc-core/sc_stream_memory.h"
@@ -21,8 +23,11 @@
 
 #include "sc_storage_private.h"
 #include "sc_memory_private.h"
+#include "sc_helper_private.h"
 
 sc_storage * storage = null_ptr;
+//! It isn't reset when sc-memory is reinitialized, so versions taken before reinitialization are always outdated
+static sc_int32 identifiers_version = 0;
 
 sc_result sc_storage_initialize(sc_memory_params const * params)
 {
@@ -30,6 +35,7 @@ sc_result sc_storage_initialize(sc_memory_params const * params)
     return SC_RESULT_ERROR;
 
   storage = sc_mem_new(sc_storage, 1);
+  g_atomic_int_inc(&identifiers_version);
   storage->max_segments_count = params->max_loaded_segments;
   storage->segments_count = 0;
   storage->last_not_engaged_segment_num = 0;
@@ -45,9 +51,12 @@ sc_result sc_storage_initialize(sc_memory_params const * params)
   sc_message("\tSc-segment elements count: %d", SC_SEGMENT_ELEMENTS_COUNT);
   sc_message("\tSc-storage size: %zd", sizeof(sc_storage));
   sc_message("\tMax segments count: %d", storage->max_segments_count);
+  sc_message("\tIndex sc-elements by types: %s", params->index_elements_by_types ? "On" : "Off");
 
   storage->processes_segments_table = sc_hash_table_init(g_direct_hash, g_direct_equal, null_ptr, null_ptr);
   sc_monitor_init(&storage->processes_monitor);
+  sc_elements_stat_reset(&storage->elements_stat);
+  storage->index_elements_by_types = params->index_elements_by_types;
 
   sc_result result = SC_TRUE;
   if (params->clear == SC_FALSE)
@@ -55,6 +64,17 @@ sc_result sc_storage_initialize(sc_memory_params const * params)
     sc_monitor_acquire_write(&storage->segments_monitor);
     result = sc_fs_memory_load(storage) == SC_FS_MEMORY_OK;
     sc_monitor_release_write(&storage->segments_monitor);
+
+    // loaded sc-elements are counted once, and then statistics is updated by generated and erased sc-elements
+    sc_stat loaded_stat;
+    sc_storage_collect_elements_stat(&loaded_stat);
+    sc_elements_stat_add(&storage->elements_stat, &loaded_stat);
+
+    if (storage->index_elements_by_types)
+    {
+      for (sc_addr_seg i = 0; i < storage->segments_count; ++i)
+        sc_segment_index_elements_types(storage->segments[i]);
+    }
   }
 
   sc_storage_dump_manager_initialize(&storage->dump_manager, params);
@@ -173,6 +193,46 @@ error:
   return result;
 }
 
+void sc_storage_prefetch_element(sc_addr addr)
+{
+  if (storage == null_ptr || addr.seg == 0 || addr.offset == 0 || addr.seg > storage->max_segments_count
+      || addr.offset > SC_SEGMENT_ELEMENTS_COUNT)
+    return;
+
+  sc_segment * segment = storage->segments[addr.seg - 1];
+  if (segment == null_ptr)
+    return;
+
+  SC_PREFETCH_READ(&segment->elements[addr.offset]);
+}
+
+//! Updates statistics and index of sc-elements by types when sc-element type is changed from `old_type` to `new_type`
+void _sc_storage_element_type_change(sc_addr addr, sc_type old_type, sc_type new_type)
+{
+  if (old_type != sc_type_unknown)
+    sc_elements_stat_remove(&storage->elements_stat, old_type);
+  if (new_type != sc_type_unknown)
+    sc_elements_stat_append(&storage->elements_stat, new_type);
+
+  sc_elements_types_index * index = storage->segments[addr.seg - 1]->types_index;
+  if (index == null_ptr)
+    return;
+
+  // new bits are set before old bits are cleared, so concurrent scans don't miss sc-element with changed type
+  sc_elements_types_index_append(index, addr.offset, new_type & ~old_type);
+  sc_elements_types_index_remove(index, addr.offset, old_type & ~new_type);
+}
+
+void _sc_storage_element_type_append(sc_addr addr, sc_type type)
+{
+  _sc_storage_element_type_change(addr, sc_type_unknown, type);
+}
+
+void _sc_storage_element_type_remove(sc_addr addr, sc_type type)
+{
+  _sc_storage_element_type_change(addr, type, sc_type_unknown);
+}
+
 sc_result sc_storage_free_element(sc_addr addr)
 {
   sc_result result = SC_RESULT_ERROR_ADDR_IS_NOT_VALID;
@@ -188,6 +248,7 @@ sc_result sc_storage_free_element(sc_addr addr)
     goto error;
 
   sc_monitor_acquire_write(&segment->monitor);
+  _sc_storage_element_type_remove(addr, element->flags.type);
   sc_addr_offset const last_released_offset = segment->last_released_offset;
   segment->elements[addr.offset] = (sc_element){(sc_element_flags){.type = last_released_offset}};
   segment->last_released_offset = addr.offset;
@@ -235,6 +296,8 @@ sc_segment * _sc_storage_get_new_segment()
     goto error;
 
   segment = storage->segments[storage->segments_count] = sc_segment_new(storage->segments_count + 1);
+  if (storage->index_elements_by_types)
+    sc_segment_index_elements_types(segment);
   ++storage->segments_count;
 
 error:
@@ -460,7 +523,7 @@ end:
   sc_monitor_release_write(&storage->processes_monitor);
 }
 
-sc_result _sc_storage_element_erase(sc_addr addr)
+sc_result _sc_storage_element_unlink(sc_addr addr, sc_bool * is_system_identifier_erased)
 {
   sc_result result;
 
@@ -469,12 +532,19 @@ sc_result _sc_storage_element_erase(sc_addr addr)
 
   sc_element * element;
   result = sc_storage_get_element_by_addr(addr, &element);
-  if (result != SC_RESULT_OK || (element->flags.states & SC_STATE_REQUEST_ERASURE) == SC_STATE_REQUEST_ERASURE)
+  if (result != SC_RESULT_OK)
   {
     sc_monitor_release_write(monitor);
     return result;
   }
 
+  // sc-element is unlinked and freed by another thread
+  if ((element->flags.states & SC_STATE_REQUEST_ERASURE) == SC_STATE_REQUEST_ERASURE)
+  {
+    sc_monitor_release_write(monitor);
+    return SC_RESULT_NO;
+  }
+
   element->flags.states |= SC_STATE_REQUEST_ERASURE;
   sc_type type = element->flags.type;
 
@@ -489,6 +559,11 @@ sc_result _sc_storage_element_erase(sc_addr addr)
     sc_addr begin_addr = element->arc.begin;
     sc_addr end_addr = element->arc.end;
 
+    // system identifier construction is erased with its sc-arc from nrel_system_identifier, it is erased with any
+    // sc-element of construction
+    if (_sc_helper_is_system_identifier_relation(begin_addr))
+      *is_system_identifier_erased = SC_TRUE;
+
     sc_bool const is_not_loop = SC_ADDR_IS_NOT_EQUAL(begin_addr, end_addr);
 
     sc_monitor * beg_monitor = sc_monitor_table_get_monitor_for_addr(&storage->addr_monitors_table, begin_addr);
@@ -659,31 +734,104 @@ sc_result _sc_storage_element_erase(sc_addr addr)
     sc_monitor_release_write_n(2, beg_monitor, end_monitor);
   }
 
-  sc_monitor_acquire_write(monitor);
-  sc_storage_free_element(addr);
-  sc_monitor_release_write(monitor);
+  return result;
+}
 
-  // erase registered events before deletion
-  sc_event_notify_element_deleted(addr);
+sc_int32 _sc_storage_compare_addr_hashes(void const * a, void const * b)
+{
+  sc_addr_hash const first = *(sc_addr_hash const *)a;
+  sc_addr_hash const second = *(sc_addr_hash const *)b;
+  return (first > second) - (first < second);
+}
 
-  return result;
+void _sc_storage_release_segment_elements(sc_segment * segment, sc_addr_hash const * addrs, sc_uint32 count)
+{
+  sc_monitor_acquire_write(&segment->monitor);
+  sc_addr_offset const last_released_offset = segment->last_released_offset;
+  for (sc_uint32 i = 0; i < count; ++i)
+  {
+    sc_addr_offset const offset = SC_ADDR_LOCAL_OFFSET_FROM_INT(addrs[i]);
+    segment->elements[offset].flags.type = segment->last_released_offset;
+    segment->last_released_offset = offset;
+  }
+  sc_monitor_release_write(&segment->monitor);
+
+  if (last_released_offset == 0)
+  {
+    sc_monitor_acquire_write(&storage->segments_monitor);
+    segment->elements[0].flags.type = storage->last_released_segment_num;
+    storage->last_released_segment_num = segment->num;
+    sc_monitor_release_write(&storage->segments_monitor);
+  }
 }
 
-sc_result sc_storage_element_erase(sc_memory_context const * ctx, sc_addr addr)
+/*! Frees unlinked sc-elements. Each sc-element is cleared under its monitor, so it stops to exist for readers, and
+ * then offsets of cleared sc-elements are returned to free lists of their sc-segments once per sc-segment.
+ */
+void _sc_storage_free_elements(sc_addr_hash * addrs, sc_uint32 count)
 {
-  sc_result result;
+  qsort(addrs, count, sizeof(sc_addr_hash), _sc_storage_compare_addr_hashes);
+
+  for (sc_uint32 i = 0; i < count; ++i)
+  {
+    sc_addr const addr = {SC_ADDR_LOCAL_SEG_FROM_INT(addrs[i]), SC_ADDR_LOCAL_OFFSET_FROM_INT(addrs[i])};
+
+    sc_monitor * monitor = sc_monitor_table_get_monitor_for_addr(&storage->addr_monitors_table, addr);
+    sc_monitor_acquire_write(monitor);
+    sc_element * element = &storage->segments[addr.seg - 1]->elements[addr.offset];
+    _sc_storage_element_type_remove(addr, element->flags.type);
+    *element = (sc_element){0};
+    sc_monitor_release_write(monitor);
+
+    // erase registered events before deletion
+    sc_event_notify_element_deleted(addr);
+  }
+
+  sc_uint32 group_begin = 0;
+  for (sc_uint32 i = 1; i <= count; ++i)
+  {
+    if (i < count && SC_ADDR_LOCAL_SEG_FROM_INT(addrs[i]) == SC_ADDR_LOCAL_SEG_FROM_INT(addrs[group_begin]))
+      continue;
 
+    sc_segment * segment = storage->segments[SC_ADDR_LOCAL_SEG_FROM_INT(addrs[group_begin]) - 1];
+    _sc_storage_release_segment_elements(segment, &addrs[group_begin], i - group_begin);
+    group_begin = i;
+  }
+}
+
+sc_result sc_storage_element_erase(sc_memory_context const * ctx, sc_addr addr)
+{
   sc_element * el = null_ptr;
-  result = sc_storage_get_element_by_addr(addr, &el);
+  sc_result const result = sc_storage_get_element_by_addr(addr, &el);
   if (result != SC_RESULT_OK)
-    goto error;
+    return result;
 
+  return sc_storage_elements_erase(ctx, &addr, 1);
+}
+
+sc_result sc_storage_elements_erase(sc_memory_context const * ctx, sc_addr const * addrs, sc_uint32 count)
+{
+  sc_result result;
+  sc_element * el = null_ptr;
+  sc_pointer p_addr;
+
+  // sc-elements and their incident sc-connectors are collected once for all specified sc-elements
   sc_hash_table * cache_table = sc_hash_table_init(g_direct_hash, g_direct_equal, null_ptr, null_ptr);
 
   sc_queue iter_queue;
   sc_queue_init(&iter_queue);
-  sc_pointer p_addr = GUINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(addr));
-  sc_queue_push(&iter_queue, p_addr);
+  for (sc_uint32 i = 0; i < count; ++i)
+  {
+    if (sc_storage_get_element_by_addr(addrs[i], &el) != SC_RESULT_OK)
+      continue;
+
+    p_addr = GUINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(addrs[i]));
+    if (sc_hash_table_get(cache_table, p_addr) != null_ptr)
+      continue;
+
+    sc_hash_table_insert(cache_table, p_addr, el);
+    sc_queue_push(&iter_queue, p_addr);
+  }
 
   sc_queue addrs_with_not_emitted_erase_events;
   sc_queue_init(&addrs_with_not_emitted_erase_events);
@@ -848,20 +996,28 @@ sc_result sc_storage_element_erase(sc_memory_context const * ctx, sc_addr addr)
   sc_queue_destroy(&iter_queue);
   sc_hash_table_destroy(cache_table);
 
+  sc_bool is_system_identifier_erased = SC_FALSE;
+  sc_uint32 unlinked_count = 0;
+  sc_addr_hash * unlinked_addrs = sc_mem_new(sc_addr_hash, addrs_with_not_emitted_erase_events.size + 1);
   while (!sc_queue_empty(&addrs_with_not_emitted_erase_events))
   {
     sc_addr_hash addr_int = (sc_pointer_to_sc_addr_hash)sc_queue_pop(&addrs_with_not_emitted_erase_events);
-    addr.seg = SC_ADDR_LOCAL_SEG_FROM_INT(addr_int);
-    addr.offset = SC_ADDR_LOCAL_OFFSET_FROM_INT(addr_int);
+    sc_addr const addr = {SC_ADDR_LOCAL_SEG_FROM_INT(addr_int), SC_ADDR_LOCAL_OFFSET_FROM_INT(addr_int)};
 
-    _sc_storage_element_erase(addr);
+    if (_sc_storage_element_unlink(addr, &is_system_identifier_erased) == SC_RESULT_OK)
+      unlinked_addrs[unlinked_count++] = addr_int;
   }
 
+  _sc_storage_free_elements(unlinked_addrs, unlinked_count);
+  sc_mem_free(unlinked_addrs);
+
   sc_queue_destroy(&addrs_with_not_emitted_erase_events);
 
-  result = SC_RESULT_OK;
-error:
-  return result;
+  // version is changed after sc-elements are freed, so they aren't checked as valid for the new version
+  if (is_system_identifier_erased)
+    sc_storage_update_identifiers_version();
+
+  return SC_RESULT_OK;
 }
 
 sc_addr sc_storage_node_new(sc_memory_context const * ctx, sc_type type)
@@ -888,6 +1044,7 @@ sc_addr sc_storage_node_new_ext(sc_memory_context const * ctx, sc_type type, sc_
   }
 
   element->flags.type = sc_type_node | type;
+  _sc_storage_element_type_append(addr, element->flags.type);
   *result = SC_RESULT_OK;
   return addr;
 }
@@ -916,6 +1073,7 @@ sc_addr sc_storage_link_new_ext(sc_memory_context const * ctx, sc_type type, sc_
   }
 
   element->flags.type = sc_type_node_link | type;
+  _sc_storage_element_type_append(addr, element->flags.type);
   *result = SC_RESULT_OK;
   return addr;
 }
@@ -1059,6 +1217,7 @@ sc_addr sc_storage_arc_new_ext(
   }
 
   arc_el->flags.type = type;
+  _sc_storage_element_type_append(connector_addr, type);
   arc_el->arc.begin = beg_addr;
   arc_el->arc.end = end_addr;
 
@@ -1293,6 +1452,7 @@ sc_result sc_storage_change_element_subtype(sc_memory_context const * ctx, sc_ad
     goto error;
   }
 
+  _sc_storage_element_type_change(addr, el->flags.type, type);
   el->flags.type = type;
 
 error:
@@ -1580,6 +1740,54 @@ error:
 }
 
 sc_result sc_storage_get_elements_stat(sc_stat * stat)
+{
+  sc_elements_stat_get(&storage->elements_stat, stat);
+  return SC_RESULT_OK;
+}
+
+sc_result sc_storage_get_next_element_by_type(sc_type type, sc_addr * addr)
+{
+  sc_monitor_acquire_read(&storage->segments_monitor);
+  sc_addr_seg const segments_count = storage->segments_count;
+  sc_monitor_release_read(&storage->segments_monitor);
+
+  sc_uint32 segment_idx = SC_ADDR_IS_EMPTY(*addr) ? 0 : addr->seg - 1;
+  sc_uint32 offset = SC_ADDR_IS_EMPTY(*addr) ? 1 : addr->offset + 1;
+  for (; segment_idx < segments_count; ++segment_idx, offset = 1)
+  {
+    sc_segment * segment = storage->segments[segment_idx];
+    if (segment == null_ptr)
+      continue;
+
+    sc_monitor_acquire_read(&segment->monitor);
+    sc_uint32 const end_offset = segment->last_engaged_offset + 1;
+    sc_monitor_release_read(&segment->monitor);
+
+    if (segment->types_index != null_ptr)
+      offset = sc_elements_types_index_next(segment->types_index, type, offset, end_offset);
+    else
+    {
+      for (; offset < end_offset; ++offset)
+      {
+        sc_element const * element = &segment->elements[offset];
+        if ((element->flags.states & SC_STATE_ELEMENT_EXIST) == SC_STATE_ELEMENT_EXIST
+            && sc_type_has_subtype(element->flags.type, type))
+          break;
+      }
+    }
+
+    if (offset < end_offset)
+    {
+      *addr = (sc_addr){segment_idx + 1, offset};
+      return SC_RESULT_OK;
+    }
+  }
+
+  *addr = SC_ADDR_EMPTY;
+  return SC_RESULT_NO;
+}
+
+sc_result sc_storage_collect_elements_stat(sc_stat * stat)
 {
   sc_mem_set(stat, 0, sizeof(sc_stat));
 
@@ -1603,3 +1811,23 @@ sc_result sc_storage_save(sc_memory_context const * ctx)
 {
   return sc_fs_memory_save(storage) == SC_FS_MEMORY_OK ? SC_RESULT_OK : SC_RESULT_ERROR;
 }
+
+sc_result sc_storage_deferred_indexing_begin(sc_memory_context const * ctx)
+{
+  return sc_fs_memory_deferred_indexing_begin() == SC_FS_MEMORY_OK ? SC_RESULT_OK : SC_RESULT_ERROR;
+}
+
+sc_result sc_storage_deferred_indexing_end(sc_memory_context const * ctx)
+{
+  return sc_fs_memory_deferred_indexing_end() == SC_FS_MEMORY_OK ? SC_RESULT_OK : SC_RESULT_ERROR;
+}
+
+void sc_storage_update_identifiers_version()
+{
+  g_atomic_int_inc(&identifiers_version);
+}
+
+sc_uint32 sc_storage_get_identifiers_version()
+{
+  return (sc_uint32)g_atomic_int_get(&identifiers_version);
+}
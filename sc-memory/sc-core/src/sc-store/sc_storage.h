@@ -115,6 +115,23 @@ void sc_storage_end_new_process();
  */
 sc_result sc_storage_element_erase(sc_memory_context const * ctx, sc_addr addr);
 
+/*!
+ * @brief Erases specified sc-elements and all sc-connectors incident to them.
+ *
+ * Incident sc-connectors of all specified sc-elements are collected once, and erased sc-elements are returned to free
+ * lists of their sc-segments once per sc-segment, so it is faster than erasing sc-elements one by one. Sc-elements with
+ * subscribed erase sc-events are erased after these sc-events are processed, as in `sc_storage_element_erase`.
+ *
+ * @param ctx A pointer to the sc-memory context that manages the operation.
+ * @param addrs A pointer to array of sc-addresses of sc-elements to be erased. Not existing sc-elements are skipped.
+ * @param count A number of sc-addresses in array.
+ *
+ * @return Returns SC_RESULT_OK.
+ *
+ * @note This function is thread-safe.
+ */
+sc_result sc_storage_elements_erase(sc_memory_context const * ctx, sc_addr const * addrs, sc_uint32 count);
+
 /*!
  * @brief Generates a new sc-node with the specified type.
  *
@@ -617,7 +634,8 @@ sc_result sc_storage_find_links_contents_by_content_substring(
  * @brief Retrieves statistics for sc-storage elements.
  *
  * This function retrieves statistics for SC-storage elements, including the count
- * of various types of elements (nodes, links, arcs) and their total size in bytes.
+ * of various types of elements (nodes, links, arcs) and their total size in bytes. Statistics is maintained when
+ * sc-elements are generated and erased, so it is got without scanning sc-segments.
  *
  * @param stat Pointer to the `sc_stat` structure where the statistics will be stored.
  *             It should be pre-allocated by the caller.
@@ -631,6 +649,35 @@ sc_result sc_storage_find_links_contents_by_content_substring(
  */
 sc_result sc_storage_get_elements_stat(sc_stat * stat);
 
+/*!
+ * @brief Calculates statistics for sc-storage elements by scanning all sc-segments.
+ *
+ * @param stat Pointer to the `sc_stat` structure where the statistics will be stored.
+ *
+ * @return Returns SC_RESULT_OK.
+ *
+ * @note This function is thread-safe, but it is slow, so it is used to count loaded sc-elements and to verify
+ * statistics retrieved by `sc_storage_get_elements_stat`.
+ */
+sc_result sc_storage_collect_elements_stat(sc_stat * stat);
+
+/*!
+ * @brief Finds the next sc-element which type has all bits of the specified type.
+ *
+ * Sc-elements are found in order of their sc-addresses. If sc-elements are indexed by their types, then bitmaps of
+ * index are intersected instead of reading all sc-elements of sc-segments.
+ *
+ * @param type A type of sc-elements to find. If it is `sc_type_unknown`, then sc-elements of all types are found.
+ * @param addr A pointer to sc-address of sc-element to find the next sc-element after. If it is empty, then the first
+ * sc-element is found. It is set to the found sc-address or to empty sc-address if there are no more sc-elements.
+ *
+ * @return Returns SC_RESULT_OK if sc-element is found, and SC_RESULT_NO otherwise.
+ *
+ * @note Sc-elements may be generated, erased or changed concurrently, so the found sc-element should be checked again
+ * under its monitor.
+ */
+sc_result sc_storage_get_next_element_by_type(sc_type type, sc_addr * addr);
+
 /*!
  * @brief Saves the current state of the sc-storage to persistent storage.
  *
@@ -647,4 +694,48 @@ sc_result sc_storage_get_elements_stat(sc_stat * stat);
  */
 sc_result sc_storage_save(sc_memory_context const * ctx);
 
+/*!
+ * @brief Begins mode in which sc-links contents aren't indexed to search sc-links by content substrings.
+ *
+ * Modes can be nested, and sc-links contents are indexed when the last begun mode is ended. Sc-links are found by
+ * full contents as usual in this mode. This mode speeds up generation of large amount of sc-links.
+ *
+ * @param ctx A pointer to the sc-memory context that manages the operation.
+ *
+ * @return Returns SC_RESULT_OK, if mode is begun.
+ *
+ * @note This function is thread-safe.
+ */
+sc_result sc_storage_deferred_indexing_begin(sc_memory_context const * ctx);
+
+/*!
+ * @brief Ends mode begun by `sc_storage_deferred_indexing_begin`.
+ *
+ * @param ctx A pointer to the sc-memory context that manages the operation.
+ *
+ * @return Returns SC_RESULT_OK, if mode is ended, and SC_RESULT_ERROR, if mode isn't begun.
+ *
+ * @note This function is thread-safe.
+ */
+sc_result sc_storage_deferred_indexing_end(sc_memory_context const * ctx);
+
+/*!
+ * @brief Changes version of sc-elements system identifiers.
+ *
+ * @note This function is thread-safe.
+ */
+void sc_storage_update_identifiers_version();
+
+/*!
+ * @brief Gets version of sc-elements system identifiers.
+ *
+ * Version is changed when constructions of system identifiers are erased, contents of their sc-links are changed or
+ * sc-storage is initialized, so it can be used to invalidate caches of sc-elements resolved by system identifiers.
+ *
+ * @return Returns the current version of system identifiers.
+ *
+ * @note This function is thread-safe.
+ */
+sc_uint32 sc_storage_get_identifiers_version();
+
 #endif
@@ -12,6 +12,7 @@
 #include "sc-store/sc-event/sc_event_private.h"
 
 #include "sc-store/sc_storage_dump_manager.h"
+#include "sc-store/sc_elements_stat.h"
 
 #include "sc-store/sc-base/sc_monitor_table_private.h"
 
@@ -29,6 +30,8 @@ struct _sc_storage
   sc_storage_dump_manager * dump_manager;
   sc_event_emission_manager * events_emission_manager;
   sc_event_subscription_manager * events_subscription_manager;
+  sc_elements_stat elements_stat;
+  sc_bool index_elements_by_types;
 };
 
 struct _sc_storage * sc_storage_get();
@@ -41,6 +44,9 @@ sc_element * sc_storage_allocate_new_element(sc_memory_context const * ctx, sc_a
 
 sc_result sc_storage_get_element_by_addr(sc_addr addr, sc_element ** el);
 
+//! Hints processor to load sc-element by sc-address into cache without reading it
+void sc_storage_prefetch_element(sc_addr addr);
+
 sc_result sc_storage_free_element(sc_addr addr);
 
 #endif
@@ -14,12 +14,20 @@
 #include "sc-core/sc-container/sc_string.h"
 
 #include "sc-store/sc-base/sc_message.h"
+#include "sc-store/sc_storage.h"
 
+#include "sc_helper_private.h"
 #include "sc_memory_private.h"
+#include "sc_memory_context_manager.h"
+#include "sc_memory_context_private.h"
+#include "sc_memory_context_permissions.h"
 
 sc_char ** keynodes_str = null_ptr;
 sc_addr * sc_keynodes = null_ptr;
 
+static sc_helper_identifiers_index_shard identifiers_index[SC_HELPER_IDENTIFIERS_INDEX_SHARDS_COUNT];
+static sc_bool identifiers_index_is_initialized = SC_FALSE;
+
 sc_result resolve_nrel_system_identifier(sc_memory_context const * ctx)
 {
   sc_stream * stream = sc_stream_memory_new(
@@ -110,7 +118,256 @@ void _destroy_keynodes_str()
   sc_mem_free(keynodes_str);
 }
 
-sc_result sc_helper_init(sc_memory_context * ctx)
+sc_bool _sc_helper_is_system_identifier_relation(sc_addr addr)
+{
+  return sc_keynodes != null_ptr && SC_ADDR_IS_NOT_EMPTY(addr)
+         && SC_ADDR_IS_EQUAL(addr, sc_keynodes[SC_KEYNODE_NREL_SYSTEM_IDENTIFIER]);
+}
+
+sc_bool _sc_helper_is_system_identifier_link(sc_memory_context const * ctx, sc_addr link_addr)
+{
+  if (sc_keynodes == null_ptr || SC_ADDR_IS_EMPTY(sc_keynodes[SC_KEYNODE_NREL_SYSTEM_IDENTIFIER]))
+    return SC_FALSE;
+
+  sc_iterator5 * it = sc_iterator5_a_a_f_a_f_new(
+      ctx,
+      0,
+      sc_type_const_common_arc,
+      link_addr,
+      sc_type_const_perm_pos_arc,
+      sc_keynodes[SC_KEYNODE_NREL_SYSTEM_IDENTIFIER]);
+  sc_bool const is_found = sc_iterator5_next(it);
+  sc_iterator5_free(it);
+
+  return is_found;
+}
+
+sc_helper_identifiers_index_shard * _sc_helper_identifiers_index_get_shard(sc_char const * system_idtf)
+{
+  return &identifiers_index[g_str_hash(system_idtf) % SC_HELPER_IDENTIFIERS_INDEX_SHARDS_COUNT];
+}
+
+/*! Reads content of sc-link as a null-terminated string.
+ * @returns A pointer to read string, it must be freed by caller, or null_ptr, if content can't be read.
+ */
+sc_char * _sc_helper_get_link_string(sc_memory_context const * ctx, sc_addr link_addr, sc_uint32 * size)
+{
+  sc_stream * stream = null_ptr;
+  if (sc_storage_get_link_content(ctx, link_addr, &stream) != SC_RESULT_OK)
+    return null_ptr;
+
+  sc_char * string = null_ptr;
+  if (sc_stream_get_data(stream, &string, size) == SC_FALSE)
+  {
+    sc_mem_free(string);
+    string = null_ptr;
+  }
+
+  sc_stream_free(stream);
+  return string;
+}
+
+/*! Checks that sc-elements of fiver still exist and are connected by it, and sc-link of fiver has specified content.
+ * So indexed fiver is valid even if some of its sc-addresses are reused by other sc-elements.
+ */
+sc_bool _sc_helper_is_system_identifier_fiver_valid(
+    sc_memory_context const * ctx,
+    sc_system_identifier_fiver const * fiver,
+    sc_char const * data,
+    sc_uint32 len)
+{
+  if (SC_ADDR_IS_NOT_EQUAL(fiver->addr5, sc_keynodes[SC_KEYNODE_NREL_SYSTEM_IDENTIFIER]))
+    return SC_FALSE;
+
+  sc_addr begin_addr, end_addr;
+  if (sc_storage_get_arc_info(ctx, fiver->addr4, &begin_addr, &end_addr) != SC_RESULT_OK
+      || SC_ADDR_IS_NOT_EQUAL(begin_addr, fiver->addr5) || SC_ADDR_IS_NOT_EQUAL(end_addr, fiver->addr2))
+    return SC_FALSE;
+
+  if (sc_storage_get_arc_info(ctx, fiver->addr2, &begin_addr, &end_addr) != SC_RESULT_OK
+      || SC_ADDR_IS_NOT_EQUAL(begin_addr, fiver->addr1) || SC_ADDR_IS_NOT_EQUAL(end_addr, fiver->addr3))
+    return SC_FALSE;
+
+  sc_uint32 size = 0;
+  sc_char * string = _sc_helper_get_link_string(ctx, fiver->addr3, &size);
+  sc_bool const is_valid = string != null_ptr && size == len && memcmp(string, data, len) == 0;
+  sc_mem_free(string);
+
+  return is_valid;
+}
+
+void _sc_helper_identifiers_index_insert(
+    sc_char const * system_idtf,
+    sc_uint32 len,
+    sc_system_identifier_fiver const * fiver,
+    sc_uint32 version)
+{
+  if (identifiers_index_is_initialized == SC_FALSE)
+    return;
+
+  sc_char * key;
+  sc_str_cpy(key, system_idtf, len);
+
+  sc_helper_identifiers_index_entry * entry = sc_mem_new(sc_helper_identifiers_index_entry, 1);
+  entry->fiver = *fiver;
+  entry->version = (sc_int32)version;
+
+  sc_helper_identifiers_index_shard * shard = _sc_helper_identifiers_index_get_shard(key);
+  sc_monitor_acquire_write(&shard->monitor);
+  sc_hash_table_insert(shard->table, key, entry);
+  sc_monitor_release_write(&shard->monitor);
+}
+
+void _sc_helper_identifiers_index_remove(sc_char const * system_idtf, sc_system_identifier_fiver const * fiver)
+{
+  sc_helper_identifiers_index_shard * shard = _sc_helper_identifiers_index_get_shard(system_idtf);
+  sc_monitor_acquire_write(&shard->monitor);
+
+  // entry may be replaced by valid one while it was checked
+  sc_helper_identifiers_index_entry * entry = sc_hash_table_get(shard->table, system_idtf);
+  if (entry != null_ptr && SC_ADDR_IS_EQUAL(entry->fiver.addr2, fiver->addr2))
+    sc_hash_table_remove(shard->table, system_idtf);
+
+  sc_monitor_release_write(&shard->monitor);
+}
+
+/*! Finds fiver of system identifier in index. Found fiver is checked again only if some system identifier
+ * constructions were erased or contents of their sc-links were changed since its last check.
+ * @returns SC_TRUE, if valid fiver is found in index and sc-memory context can read it; otherwise SC_FALSE, then
+ * fiver should be found by sc-links contents.
+ */
+sc_bool _sc_helper_identifiers_index_find(
+    sc_memory_context const * ctx,
+    sc_char const * data,
+    sc_uint32 len,
+    sc_system_identifier_fiver * out_fiver)
+{
+  if (identifiers_index_is_initialized == SC_FALSE || sc_str_len(data) != len)
+    return SC_FALSE;
+
+  if (_sc_memory_context_is_authenticated(sc_memory_get_context_manager(), ctx) == SC_FALSE)
+    return SC_FALSE;
+
+  // version is got before the check to not take changes made while checking for checked ones
+  sc_int32 const version = (sc_int32)sc_memory_get_identifiers_version();
+
+  sc_helper_identifiers_index_shard * shard = _sc_helper_identifiers_index_get_shard(data);
+  sc_monitor_acquire_read(&shard->monitor);
+  sc_helper_identifiers_index_entry * entry = sc_hash_table_get(shard->table, data);
+  sc_bool const is_found = entry != null_ptr;
+  sc_bool const is_checked = is_found && g_atomic_int_get(&entry->version) == version;
+  if (is_found)
+    *out_fiver = entry->fiver;
+  sc_monitor_release_read(&shard->monitor);
+
+  if (is_found == SC_FALSE)
+    return SC_FALSE;
+
+  if (is_checked == SC_FALSE)
+  {
+    if (_sc_helper_is_system_identifier_fiver_valid(ctx, out_fiver, data, len) == SC_FALSE)
+    {
+      _sc_helper_identifiers_index_remove(data, out_fiver);
+      sc_system_identifier_fiver_make_empty(out_fiver);
+      return SC_FALSE;
+    }
+
+    sc_monitor_acquire_read(&shard->monitor);
+    entry = sc_hash_table_get(shard->table, data);
+    if (entry != null_ptr && SC_ADDR_IS_EQUAL(entry->fiver.addr2, out_fiver->addr2))
+      g_atomic_int_set(&entry->version, version);
+    sc_monitor_release_read(&shard->monitor);
+  }
+
+  // sc-elements found by sc-iterator are checked by permissions of sc-memory context, so indexed ones are checked too
+  sc_memory_context_manager * manager = sc_memory_get_context_manager();
+  sc_addr const fiver_addrs[] = {out_fiver->addr1, out_fiver->addr2, out_fiver->addr3, out_fiver->addr4};
+  for (sc_uint32 i = 0; i < sizeof(fiver_addrs) / sizeof(fiver_addrs[0]); ++i)
+  {
+    if (_sc_memory_context_check_local_and_global_permissions(
+            manager, ctx, SC_CONTEXT_PERMISSIONS_READ, fiver_addrs[i])
+        == SC_FALSE)
+    {
+      sc_system_identifier_fiver_make_empty(out_fiver);
+      return SC_FALSE;
+    }
+  }
+
+  return SC_TRUE;
+}
+
+/*! Initializes index of system identifiers and fills it by all system identifiers of loaded sc-elements.
+ */
+void _sc_helper_identifiers_index_initialize(sc_memory_context const * ctx)
+{
+  for (sc_uint32 i = 0; i < SC_HELPER_IDENTIFIERS_INDEX_SHARDS_COUNT; ++i)
+  {
+    identifiers_index[i].table = sc_hash_table_init(g_str_hash, g_str_equal, sc_mem_free, sc_mem_free);
+    sc_monitor_init(&identifiers_index[i].monitor);
+  }
+
+  sc_uint32 const version = sc_memory_get_identifiers_version();
+  sc_addr const nrel_system_identifier_addr = sc_keynodes[SC_KEYNODE_NREL_SYSTEM_IDENTIFIER];
+
+  regex_t regex;
+  regcomp(&regex, REGEX_SYSTEM_IDTF, REG_EXTENDED);
+
+  sc_uint32 indexed_count = 0;
+  sc_iterator3 * it =
+      sc_iterator3_f_a_a_new(ctx, nrel_system_identifier_addr, sc_type_const_perm_pos_arc, sc_type_const_common_arc);
+  while (sc_iterator3_next(it))
+  {
+    sc_system_identifier_fiver fiver;
+    fiver.addr2 = sc_iterator3_value(it, 2);
+    fiver.addr4 = sc_iterator3_value(it, 1);
+    fiver.addr5 = nrel_system_identifier_addr;
+    if (sc_storage_get_arc_info(ctx, fiver.addr2, &fiver.addr1, &fiver.addr3) != SC_RESULT_OK)
+      continue;
+
+    sc_uint32 size = 0;
+    sc_char * string = _sc_helper_get_link_string(ctx, fiver.addr3, &size);
+    if (string == null_ptr)
+      continue;
+
+    // the first sc-element with duplicated system identifier is kept
+    sc_helper_identifiers_index_shard * shard = _sc_helper_identifiers_index_get_shard(string);
+    if (regexec(&regex, string, 0, NULL, 0) != 0 || sc_hash_table_get(shard->table, string) != null_ptr)
+    {
+      sc_mem_free(string);
+      continue;
+    }
+
+    sc_helper_identifiers_index_entry * entry = sc_mem_new(sc_helper_identifiers_index_entry, 1);
+    entry->fiver = fiver;
+    entry->version = (sc_int32)version;
+    sc_hash_table_insert(shard->table, string, entry);
+    ++indexed_count;
+  }
+  sc_iterator3_free(it);
+
+  regfree(&regex);
+
+  identifiers_index_is_initialized = SC_TRUE;
+  sc_memory_info("Indexed system identifiers: %u", indexed_count);
+}
+
+void _sc_helper_identifiers_index_shutdown()
+{
+  if (identifiers_index_is_initialized == SC_FALSE)
+    return;
+
+  identifiers_index_is_initialized = SC_FALSE;
+  for (sc_uint32 i = 0; i < SC_HELPER_IDENTIFIERS_INDEX_SHARDS_COUNT; ++i)
+  {
+    sc_monitor_acquire_write(&identifiers_index[i].monitor);
+    sc_hash_table_destroy(identifiers_index[i].table);
+    identifiers_index[i].table = null_ptr;
+    sc_monitor_release_write(&identifiers_index[i].monitor);
+    sc_monitor_destroy(&identifiers_index[i].monitor);
+  }
+}
+
+sc_result sc_helper_init(sc_memory_context const * ctx)
 {
   sc_memory_info("Initialize sc-helper");
 
@@ -149,6 +406,9 @@ sc_result sc_helper_init(sc_memory_context * ctx)
   sc_keynodes[SC_KEYNODE_NREL_SYSTEM_IDENTIFIER] = addr;
 
 finish:
+  if (result == SC_RESULT_OK)
+    _sc_helper_identifiers_index_initialize(ctx);
+
   return result;
 }
 
@@ -156,7 +416,10 @@ void sc_helper_shutdown()
 {
   sc_memory_info("Shutdown sc-helper");
 
+  _sc_helper_identifiers_index_shutdown();
+
   sc_mem_free(sc_keynodes);
+  sc_keynodes = null_ptr;
   _destroy_keynodes_str();
 }
 
@@ -208,10 +471,16 @@ sc_result sc_helper_find_element_by_system_identifier_ext(
   sc_stream * stream = null_ptr;
   sc_system_identifier_fiver_make_empty(out_fiver);
 
+  // only valid system identifiers are indexed
+  if (_sc_helper_identifiers_index_find(ctx, data, len, out_fiver) == SC_TRUE)
+    return SC_RESULT_OK;
+
   sc_result result = sc_helper_check_system_identifier(data);
   if (result != SC_RESULT_OK)
     goto error;
 
+  sc_uint32 const version = sc_memory_get_identifiers_version();
+
   sc_list * found_links;
   stream = sc_stream_memory_new(data, sizeof(sc_char) * len, SC_STREAM_FLAG_READ, SC_FALSE);
 
@@ -247,6 +516,7 @@ sc_result sc_helper_find_element_by_system_identifier_ext(
           sc_iterator5_value(it, 2),
           sc_iterator5_value(it, 3),
           sc_iterator5_value(it, 4)};
+      _sc_helper_identifiers_index_insert(data, len, out_fiver, version);
 
       sc_iterator5_free(it);
       sc_iterator_destroy(links_it);
@@ -315,6 +585,9 @@ sc_result sc_helper_set_system_identifier_ext(
   // we doesn't need link data anymore
   sc_stream_free(stream);
 
+  // version is got after sc-link content is set, so fiver isn't indexed as valid if its sc-elements are erased
+  sc_uint32 const version = sc_memory_get_identifiers_version();
+
   // setup new system identifier
   sc_addr arc_addr = sc_memory_arc_new_ext(ctx, sc_type_const_common_arc, addr, idtf_addr, &result);
   if (result != SC_RESULT_OK)
@@ -325,9 +598,13 @@ sc_result sc_helper_set_system_identifier_ext(
   if (result != SC_RESULT_OK)
     goto error;
 
+  sc_system_identifier_fiver const fiver = {
+      addr, arc_addr, idtf_addr, arc_to_arc_addr, sc_keynodes[SC_KEYNODE_NREL_SYSTEM_IDENTIFIER]};
+  if (SC_ADDR_IS_NOT_EMPTY(arc_to_arc_addr))
+    _sc_helper_identifiers_index_insert(data, len, &fiver, version);
+
   if (out_fiver != null_ptr)
-    *out_fiver = (sc_system_identifier_fiver){
-        addr, arc_addr, idtf_addr, arc_to_arc_addr, sc_keynodes[SC_KEYNODE_NREL_SYSTEM_IDENTIFIER]};
+    *out_fiver = fiver;
 
 error:
   return result;
@@ -417,7 +694,7 @@ sc_bool sc_helper_check_arc_ext(
   if (it == null_ptr)
     return SC_FALSE;
 
-  if (sc_iterator3_next_ext(it, result) == SC_TRUE)
+  if (sc_iterator3_count_next_ext(it, 1, result) != 0)
     status = SC_TRUE;
 
   sc_iterator3_free(it);
@@ -8,6 +8,30 @@
 #define _sc_helper_private_h_
 
 #include "sc-core/sc_types.h"
+#include "sc-core/sc_helper.h"
+
+#include "sc-store/sc-base/sc_monitor_private.h"
+#include "sc-store/sc-container/sc_hash_table.h"
+
+//! Number of shards of system identifiers index, each shard is locked separately
+#define SC_HELPER_IDENTIFIERS_INDEX_SHARDS_COUNT 16
+
+/*! Entry of system identifiers index. Fiver of entry is checked again if system identifiers version is changed after
+ * the last check, because some system identifier construction is erased or content of its sc-link is changed.
+ */
+typedef struct _sc_helper_identifiers_index_entry
+{
+  sc_system_identifier_fiver fiver;
+  sc_int32 version;  // version of system identifiers at the last check of fiver, it is accessed atomically
+} sc_helper_identifiers_index_entry;
+
+/*! Shard of system identifiers index. It maps system identifier strings to entries with their fivers.
+ */
+typedef struct _sc_helper_identifiers_index_shard
+{
+  sc_hash_table * table;
+  sc_monitor monitor;
+} sc_helper_identifiers_index_shard;
 
 /*! Initialize helper.
  * @remarks Need to be called once at the beginning of sc-helper usage
@@ -21,4 +45,13 @@ sc_result sc_helper_init(sc_memory_context const * ctx);
  */
 void sc_helper_shutdown();
 
+/*! Checks if sc-element is nrel_system_identifier.
+ * @remarks This function doesn't lock sc-elements, so it can be called by sc-storage while they are locked
+ */
+sc_bool _sc_helper_is_system_identifier_relation(sc_addr addr);
+
+/*! Checks if sc-link is system identifier of some sc-element.
+ */
+sc_bool _sc_helper_is_system_identifier_link(sc_memory_context const * ctx, sc_addr link_addr);
+
 #endif
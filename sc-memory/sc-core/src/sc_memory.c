@@ -286,6 +286,27 @@ sc_result sc_memory_element_free(sc_memory_context * ctx, sc_addr addr)
   return sc_storage_element_erase(ctx, addr);
 }
 
+sc_result sc_memory_elements_free(sc_memory_context * ctx, sc_addr const * addrs, sc_uint32 count)
+{
+  if (_sc_memory_context_is_authenticated(memory->context_manager, ctx) == SC_FALSE)
+    return SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED;
+
+  for (sc_uint32 i = 0; i < count; ++i)
+  {
+    if (_sc_memory_context_check_local_and_global_permissions(
+            memory->context_manager, ctx, SC_CONTEXT_PERMISSIONS_ERASE, addrs[i])
+        == SC_FALSE)
+      return SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_ERASE_PERMISSIONS;
+
+    if (_sc_memory_context_check_global_permissions_to_erase_permissions(
+            memory->context_manager, ctx, addrs[i], SC_CONTEXT_PERMISSIONS_TO_ERASE_PERMISSIONS)
+        == SC_FALSE)
+      return SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_PERMISSIONS_TO_ERASE_PERMISSIONS;
+  }
+
+  return sc_storage_elements_erase(ctx, addrs, count);
+}
+
 sc_addr sc_memory_node_new(sc_memory_context const * ctx, sc_type type)
 {
   sc_result result;
@@ -495,7 +516,12 @@ sc_result sc_memory_set_link_content_ext(
       == SC_FALSE)
     return SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_WRITE_PERMISSIONS;
 
-  return sc_storage_set_link_content(ctx, addr, stream, is_searchable_string);
+  sc_result const result = sc_storage_set_link_content(ctx, addr, stream, is_searchable_string);
+  // version is changed after content is set, so sc-elements with previous content aren't checked as valid for it
+  if (result == SC_RESULT_OK && _sc_helper_is_system_identifier_link(s_memory_default_ctx, addr))
+    sc_storage_update_identifiers_version();
+
+  return result;
 }
 
 sc_result sc_memory_get_link_content(sc_memory_context const * ctx, sc_addr addr, sc_stream ** stream)
@@ -636,6 +662,18 @@ sc_result sc_memory_stat(sc_memory_context const * ctx, sc_stat * statistics)
   return sc_storage_get_elements_stat(statistics);
 }
 
+sc_result sc_memory_collect_stat(sc_memory_context const * ctx, sc_stat * statistics)
+{
+  if (_sc_memory_context_is_authenticated(memory->context_manager, ctx) == SC_FALSE)
+    return SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED;
+
+  if (_sc_memory_context_check_global_permissions(memory->context_manager, ctx, SC_CONTEXT_PERMISSIONS_READ)
+      == SC_FALSE)
+    return SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_READ_PERMISSIONS;
+
+  return sc_storage_collect_elements_stat(statistics);
+}
+
 sc_result sc_memory_save(sc_memory_context const * ctx)
 {
   if (_sc_memory_context_is_authenticated(memory->context_manager, ctx) == SC_FALSE)
@@ -647,3 +685,32 @@ sc_result sc_memory_save(sc_memory_context const * ctx)
 
   return sc_storage_save(ctx);
 }
+
+sc_result sc_memory_deferred_indexing_begin(sc_memory_context const * ctx)
+{
+  if (_sc_memory_context_is_authenticated(memory->context_manager, ctx) == SC_FALSE)
+    return SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED;
+
+  if (_sc_memory_context_check_global_permissions(memory->context_manager, ctx, SC_CONTEXT_PERMISSIONS_WRITE)
+      == SC_FALSE)
+    return SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_WRITE_PERMISSIONS;
+
+  return sc_storage_deferred_indexing_begin(ctx);
+}
+
+sc_result sc_memory_deferred_indexing_end(sc_memory_context const * ctx)
+{
+  if (_sc_memory_context_is_authenticated(memory->context_manager, ctx) == SC_FALSE)
+    return SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED;
+
+  if (_sc_memory_context_check_global_permissions(memory->context_manager, ctx, SC_CONTEXT_PERMISSIONS_WRITE)
+      == SC_FALSE)
+    return SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_WRITE_PERMISSIONS;
+
+  return sc_storage_deferred_indexing_end(ctx);
+}
+
+sc_uint32 sc_memory_get_identifiers_version()
+{
+  return sc_storage_get_identifiers_version();
+}
@@ -40,4 +40,6 @@ void sc_memory_params_clear(sc_memory_params * params)
   params->max_searchable_string_size = DEFAULT_MAX_SEARCHABLE_STRING_SIZE;
   params->term_separators = DEFAULT_TERM_SEPARATORS;
   params->search_by_substring = DEFAULT_SEARCH_BY_SUBSTRING;
+
+  params->index_elements_by_types = DEFAULT_INDEX_ELEMENTS_BY_TYPES;
 }
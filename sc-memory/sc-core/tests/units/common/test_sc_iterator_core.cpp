@@ -196,6 +196,70 @@ TEST_F(ScIterator3CoreTest, sc_iterator3_f_f_f)
   sc_iterator3_free(it);
 }
 
+TEST_F(ScIterator3CoreTest, sc_iterator3_count_next_f_a_a)
+{
+  for (sc_uint32 i = 0; i < 5; ++i)
+  {
+    sc_memory_arc_new(
+        **m_ctx, sc_type_const_perm_pos_arc, m_source, sc_memory_link_new2(**m_ctx, sc_type_const_node_link));
+    sc_memory_arc_new(**m_ctx, sc_type_const_perm_pos_arc, m_source, sc_memory_node_new(**m_ctx, sc_type_const_node));
+    sc_memory_arc_new(**m_ctx, sc_type_const_common_arc, m_source, sc_memory_node_new(**m_ctx, sc_type_const_node));
+  }
+
+  sc_iterator3 * it = sc_iterator3_f_a_a_new(**m_ctx, m_source, sc_type_const_perm_pos_arc, sc_type_const_node_link);
+  EXPECT_EQ(sc_iterator3_count_next(it, 0), 6u);
+  EXPECT_EQ(sc_iterator3_count_next(it, 0), 0u);
+  EXPECT_FALSE(sc_iterator3_next(it));
+  sc_iterator3_free(it);
+
+  it = sc_iterator3_f_a_a_new(**m_ctx, m_source, sc_type_const_perm_pos_arc, 0);
+  EXPECT_EQ(sc_iterator3_count_next(it, 0), 11u);
+  sc_iterator3_free(it);
+
+  it = sc_iterator3_f_a_a_new(**m_ctx, m_source, 0, 0);
+  EXPECT_EQ(sc_iterator3_count_next(it, 4), 4u);
+  EXPECT_EQ(sc_iterator3_count_next(it, 10), 10u);
+  EXPECT_EQ(sc_iterator3_count_next(it, 0), 2u);
+  EXPECT_FALSE(sc_iterator3_next(it));
+  sc_iterator3_free(it);
+}
+
+TEST_F(ScIterator3CoreTest, sc_iterator3_count_next_a_a_f)
+{
+  sc_iterator3 * it = sc_iterator3_a_a_f_new(**m_ctx, sc_type_const_node, sc_type_const_perm_pos_arc, m_target);
+  EXPECT_EQ(sc_iterator3_count_next(it, 1), 1u);
+  EXPECT_EQ(sc_iterator3_count_next(it, 1), 0u);
+  sc_iterator3_free(it);
+
+  it = sc_iterator3_a_a_f_new(**m_ctx, sc_type_const_node_link, sc_type_const_perm_pos_arc, m_target);
+  EXPECT_EQ(sc_iterator3_count_next(it, 1), 0u);
+  sc_iterator3_free(it);
+}
+
+TEST_F(ScIterator3CoreTest, sc_iterator3_count_next_f_a_f)
+{
+  sc_memory_arc_new(**m_ctx, sc_type_const_perm_pos_arc, m_source, m_target);
+  sc_memory_arc_new(**m_ctx, sc_type_const_common_arc, m_source, m_target);
+
+  sc_iterator3 * it = sc_iterator3_f_a_f_new(**m_ctx, m_source, sc_type_const_perm_pos_arc, m_target);
+  EXPECT_EQ(sc_iterator3_count_next(it, 0), 2u);
+  sc_iterator3_free(it);
+
+  it = sc_iterator3_f_a_f_new(**m_ctx, m_source, sc_type_const_perm_pos_arc, m_target);
+  EXPECT_EQ(sc_iterator3_count_next(it, 1), 1u);
+  EXPECT_TRUE(SC_ADDR_IS_EMPTY(sc_iterator3_value(it, 1)));
+  EXPECT_TRUE(sc_iterator3_next(it));
+  EXPECT_FALSE(sc_iterator3_next(it));
+  sc_iterator3_free(it);
+
+  EXPECT_TRUE(sc_helper_check_arc(**m_ctx, m_source, m_target, sc_type_const_common_arc));
+  EXPECT_FALSE(sc_helper_check_arc(**m_ctx, m_target, m_source, sc_type_const_common_arc));
+
+  sc_result result;
+  EXPECT_EQ(sc_iterator3_count_next_ext(nullptr, 0, &result), 0u);
+  EXPECT_EQ(result, SC_RESULT_NO);
+}
+
 TEST_F(ScMemoryTest, sc_iterator3_search_structure)
 {
   sc_addr const structure_addr1 = sc_memory_node_new(**m_ctx, sc_type_node | sc_type_const | sc_type_node_structure);
@@ -488,6 +488,69 @@ TEST_F(ScDictionaryFSMemoryTest, sc_dictionary_fs_memory_get_link_hashes_by_stri
   EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
 }
 
+TEST_F(ScDictionaryFSMemoryTest, sc_dictionary_fs_memory_get_link_hashes_by_deferred_string)
+{
+  sc_dictionary_fs_memory * memory;
+  EXPECT_EQ(sc_dictionary_fs_memory_initialize(&memory, SC_DICTIONARY_FS_MEMORY_PATH), SC_FS_MEMORY_OK);
+
+  {
+    EXPECT_EQ(sc_dictionary_fs_memory_deferred_indexing_begin(memory), SC_FS_MEMORY_OK);
+    EXPECT_EQ(sc_dictionary_fs_memory_deferred_indexing_begin(memory), SC_FS_MEMORY_OK);
+
+    sc_char string1[] = TEXT_EXAMPLE_1;
+    sc_addr_hash hash1 = 112;
+    EXPECT_EQ(sc_dictionary_fs_memory_link_string(memory, hash1, string1, sc_str_len(string1)), SC_FS_MEMORY_OK);
+    sc_addr_hash hash2 = 113;
+    EXPECT_EQ(sc_dictionary_fs_memory_link_string(memory, hash2, string1, sc_str_len(string1)), SC_FS_MEMORY_OK);
+
+    sc_char string2[] = TEXT_EXAMPLE_2;
+    sc_addr_hash hash3 = 518;
+    EXPECT_EQ(sc_dictionary_fs_memory_link_string(memory, hash3, string2, sc_str_len(string2)), SC_FS_MEMORY_OK);
+
+    sc_list * found_link_hashes;
+    sc_list_init(&found_link_hashes);
+    sc_link_handler link_handler;
+    link_handler.check_link_callback = nullptr;
+    link_handler.check_link_callback_data = nullptr;
+    link_handler.request_link_callback = nullptr;
+    link_handler.request_link_callback_data = nullptr;
+    link_handler.push_link_callback = _test_push_link_hash;
+    link_handler.push_link_callback_data = found_link_hashes;
+    link_handler.push_link_content_callback = nullptr;
+    link_handler.push_link_content_callback_data = nullptr;
+    EXPECT_EQ(
+        sc_dictionary_fs_memory_get_link_hashes_by_string(memory, string1, sc_str_len(string1), &link_handler),
+        SC_FS_MEMORY_OK);
+    EXPECT_EQ(found_link_hashes->size, 2u);
+    sc_list_destroy(found_link_hashes);
+
+    // deferred strings are indexed before search by substring
+    sc_char substring[] = "second";
+    sc_list_init(&found_link_hashes);
+    link_handler.push_link_callback_data = found_link_hashes;
+    EXPECT_EQ(
+        sc_dictionary_fs_memory_get_link_hashes_by_substring(memory, substring, sc_str_len(substring), &link_handler),
+        SC_FS_MEMORY_OK);
+    EXPECT_EQ(found_link_hashes->size, 1u);
+    EXPECT_EQ((sc_pointer_to_sc_addr_hash)found_link_hashes->begin->data, hash3);
+    sc_list_destroy(found_link_hashes);
+
+    EXPECT_EQ(sc_dictionary_fs_memory_deferred_indexing_end(memory), SC_FS_MEMORY_OK);
+    EXPECT_EQ(sc_dictionary_fs_memory_deferred_indexing_end(memory), SC_FS_MEMORY_OK);
+    EXPECT_EQ(sc_dictionary_fs_memory_deferred_indexing_end(memory), SC_FS_MEMORY_NO);
+
+    sc_list_init(&found_link_hashes);
+    link_handler.push_link_callback_data = found_link_hashes;
+    EXPECT_EQ(
+        sc_dictionary_fs_memory_get_link_hashes_by_string(memory, string1, sc_str_len(string1), &link_handler),
+        SC_FS_MEMORY_OK);
+    EXPECT_EQ(found_link_hashes->size, 2u);
+    sc_list_destroy(found_link_hashes);
+  }
+
+  EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
+}
+
 TEST_F(ScDictionaryFSMemoryTest, sc_dictionary_fs_memory_get_link_hashes_by_not_searchable_string)
 {
   sc_dictionary_fs_memory * memory;
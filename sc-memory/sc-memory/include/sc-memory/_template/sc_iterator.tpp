@@ -110,6 +110,59 @@ bool ScIterator3<ParamType1, ParamType2, ParamType3>::Next() const
   return status == true;
 }
 
+template <typename ParamType1, typename ParamType2, typename ParamType3>
+size_t ScIterator3<ParamType1, ParamType2, ParamType3>::NextBatch(
+    std::vector<ScAddrTriple> & constructions,
+    size_t maxCount) const
+{
+  constructions.clear();
+
+  std::vector<sc_addr> results(maxCount * 3);
+  sc_result result;
+  sc_uint32 const count =
+      sc_iterator3_next_batch_ext(m_iterator, results.data(), static_cast<sc_uint32>(maxCount), &result);
+
+  switch (result)
+  {
+  case SC_RESULT_NO:
+    SC_THROW_EXCEPTION(utils::ExceptionInvalidParams, "Specified iterator3 is empty to iterate next");
+  case SC_RESULT_ERROR_INVALID_PARAMS:
+    SC_THROW_EXCEPTION(utils::ExceptionInvalidParams, "Specified max count of triples to iterate next must be > 0");
+  case SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED:
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState, "Unable to iterate next triples because sc-memory context is not authorized");
+  default:
+    break;
+  }
+
+  constructions.reserve(count);
+  for (sc_uint32 i = 0; i < count; ++i)
+    constructions.push_back({results[i * 3], results[i * 3 + 1], results[i * 3 + 2]});
+
+  return count;
+}
+
+template <typename ParamType1, typename ParamType2, typename ParamType3>
+size_t ScIterator3<ParamType1, ParamType2, ParamType3>::Count(size_t maxCount) const
+{
+  sc_result result;
+  sc_uint32 const count = sc_iterator3_count_next_ext(
+      m_iterator, maxCount > SC_MAXUINT32 ? SC_MAXUINT32 : static_cast<sc_uint32>(maxCount), &result);
+
+  switch (result)
+  {
+  case SC_RESULT_NO:
+    SC_THROW_EXCEPTION(utils::ExceptionInvalidParams, "Specified iterator3 is empty to count next triples");
+  case SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED:
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState, "Unable to count next triples because sc-memory context is not authorized");
+  default:
+    break;
+  }
+
+  return count;
+}
+
 template <typename ParamType1, typename ParamType2, typename ParamType3>
 ScAddr ScIterator3<ParamType1, ParamType2, ParamType3>::Get(size_t index) const
 {
@@ -194,6 +247,36 @@ bool ScIterator5<ParamType1, ParamType2, ParamType3, ParamType4, ParamType5>::Ne
   return status == true;
 }
 
+template <typename ParamType1, typename ParamType2, typename ParamType3, typename ParamType4, typename ParamType5>
+size_t ScIterator5<ParamType1, ParamType2, ParamType3, ParamType4, ParamType5>::NextBatch(
+    std::vector<ScAddrQuintuple> & constructions,
+    size_t maxCount) const
+{
+  constructions.clear();
+  if (maxCount == 0)
+    SC_THROW_EXCEPTION(utils::ExceptionInvalidParams, "Specified max count of quintuples to iterate next must be > 0");
+
+  while (constructions.size() < maxCount && Next())
+    constructions.push_back(
+        {sc_iterator5_value(m_iterator, 0),
+         sc_iterator5_value(m_iterator, 1),
+         sc_iterator5_value(m_iterator, 2),
+         sc_iterator5_value(m_iterator, 3),
+         sc_iterator5_value(m_iterator, 4)});
+
+  return constructions.size();
+}
+
+template <typename ParamType1, typename ParamType2, typename ParamType3, typename ParamType4, typename ParamType5>
+size_t ScIterator5<ParamType1, ParamType2, ParamType3, ParamType4, ParamType5>::Count(size_t maxCount) const
+{
+  size_t count = 0;
+  while ((maxCount == 0 || count < maxCount) && Next())
+    ++count;
+
+  return count;
+}
+
 template <typename ParamType1, typename ParamType2, typename ParamType3, typename ParamType4, typename ParamType5>
 ScAddr ScIterator5<ParamType1, ParamType2, ParamType3, ParamType4, ParamType5>::Get(size_t index) const
 {
@@ -176,6 +176,14 @@ void ScMemoryContext::ForEach(
     callback(it->Get(0), it->Get(1), it->Get(2), it->Get(3), it->Get(4));
 }
 
+template <typename ElementCallback>
+void ScMemoryContext::ForEachElement(ScType const & elementType, ElementCallback && callback)
+{
+  ScElementsIteratorPtr it = CreateElementsIterator(elementType);
+  while (it->Next())
+    callback(it->Get());
+}
+
 template <
     typename ParamType1,
     typename ParamType2,
@@ -11,6 +11,8 @@
 
 #include "sc_utils.hpp"
 
+#include <vector>
+
 class ScMemoryContext;
 
 /*!
@@ -44,6 +46,29 @@ public:
    */
   _SC_EXTERN virtual bool Next() const = 0;
 
+  /*!
+   * @brief Advances the iterator to up to `maxCount` next constructions at once.
+   *
+   * @param constructions A vector to be filled with found constructions. It is cleared before filling.
+   * @param maxCount Maximum number of constructions to be found.
+   * @return Number of found constructions, 0 if there are no more constructions in sc-memory.
+   * @throws utils::ExceptionInvalidParams if `maxCount` is 0.
+   * @note sc-addresses of sc-elements that context can't read are empty in found constructions.
+   */
+  _SC_EXTERN virtual size_t NextBatch(std::vector<std::array<ScAddr, tripleSize>> & constructions, size_t maxCount)
+      const = 0;
+
+  /*!
+   * @brief Advances the iterator to up to `maxCount` next constructions and counts them without getting their
+   * sc-elements.
+   *
+   * @param maxCount Maximum number of constructions to be counted, 0 to count all next constructions. Use 1 to check
+   * if there is at least one next construction.
+   * @return Number of counted constructions.
+   * @note sc-elements of counted constructions can't be got by the iterator.
+   */
+  _SC_EXTERN virtual size_t Count(size_t maxCount = 0) const = 0;
+
   /*!
    * @brief Gets sc-address of sc-element by its index from found construction.
    *
@@ -142,6 +167,28 @@ public:
    */
   _SC_EXTERN bool Next() const override;
 
+  /*!
+   * @brief Moves the iterator to up to `maxCount` next triples at once.
+   *
+   * Iterators searching sc-connectors of fixed sc-elements lock them only once for all found triples.
+   *
+   * @param constructions A vector to be filled with found triples. It is cleared before filling.
+   * @param maxCount Maximum number of triples to be found.
+   * @return Number of found triples, 0 if there are no more triples in sc-memory.
+   * @throws utils::ExceptionInvalidParams if `maxCount` is 0.
+   */
+  _SC_EXTERN size_t NextBatch(std::vector<ScAddrTriple> & constructions, size_t maxCount) const override;
+
+  /*!
+   * @brief Moves the iterator to up to `maxCount` next triples and counts them without getting their sc-elements.
+   *
+   * Types of not fixed sc-elements are read only if the iterator filters them.
+   *
+   * @param maxCount Maximum number of triples to be counted, 0 to count all next triples.
+   * @return Number of counted triples.
+   */
+  _SC_EXTERN size_t Count(size_t maxCount = 0) const override;
+
   /*!
    * @brief Gets sc-address of sc-element by its index from found triple.
    *
@@ -208,6 +255,24 @@ public:
    */
   _SC_EXTERN bool Next() const override;
 
+  /*!
+   * @brief Moves the iterator to up to `maxCount` next quintuples at once.
+   *
+   * @param constructions A vector to be filled with found quintuples. It is cleared before filling.
+   * @param maxCount Maximum number of quintuples to be found.
+   * @return Number of found quintuples, 0 if there are no more quintuples in sc-memory.
+   * @throws utils::ExceptionInvalidParams if `maxCount` is 0.
+   */
+  _SC_EXTERN size_t NextBatch(std::vector<ScAddrQuintuple> & constructions, size_t maxCount) const override;
+
+  /*!
+   * @brief Moves the iterator to up to `maxCount` next quintuples and counts them.
+   *
+   * @param maxCount Maximum number of quintuples to be counted, 0 to count all next quintuples.
+   * @return Number of counted quintuples.
+   */
+  _SC_EXTERN size_t Count(size_t maxCount = 0) const override;
+
   /*!
    * @brief Gets sc-address of sc-element by its index from iterator quintuple.
    *
@@ -228,3 +293,58 @@ public:
 
 using ScIterator3Ptr = std::shared_ptr<ScIterator<sc_iterator3, 3>>;
 using ScIterator5Ptr = std::shared_ptr<ScIterator<sc_iterator5, 5>>;
+
+/*!
+ * @brief Iterator for all sc-elements of some type in sc-memory.
+ *
+ * This class provides functionality to iterate over sc-elements which types have all bits of the specified type. If
+ * sc-elements are indexed by their types, then sc-elements are found without scanning all sc-segments.
+ */
+class _SC_EXTERN ScElementsIterator
+{
+  friend class ScMemoryContext;
+
+protected:
+  /*!
+   * @brief Constructor for ScElementsIterator.
+   *
+   * @param context sc-memory context.
+   * @param elementType A type of iterated sc-elements.
+   */
+  _SC_EXTERN ScElementsIterator(ScMemoryContext const & context, ScType const & elementType);
+
+public:
+  _SC_EXTERN ~ScElementsIterator();
+
+  ScElementsIterator(ScElementsIterator const & other) = delete;
+
+  ScElementsIterator & operator=(ScElementsIterator const & other) = delete;
+
+  /*!
+   * @brief Checks if the iterator is valid.
+   *
+   * @return true if the iterator is valid, false otherwise.
+   */
+  _SC_EXTERN bool IsValid() const;
+
+  /*!
+   * @brief Moves the iterator to the next sc-element.
+   *
+   * @return true if there is the next sc-element in sc-memory, false otherwise.
+   *
+   * @throws utils::ExceptionInvalidState if the sc-memory context is not authenticated.
+   */
+  _SC_EXTERN bool Next() const;
+
+  /*!
+   * @brief Gets sc-address of found sc-element.
+   *
+   * @return sc-address of found sc-element.
+   */
+  _SC_EXTERN ScAddr Get() const;
+
+private:
+  sc_elements_iterator * m_iterator = nullptr;
+};
+
+using ScElementsIteratorPtr = std::shared_ptr<ScElementsIterator>;
@@ -0,0 +1,133 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "sc_addr.hpp"
+#include "sc_type.hpp"
+
+class ScMemoryContext;
+
+/*!
+ * Compiled knowledge base image. It is a versioned binary file with sections of sc-elements, their system identifiers
+ * and sc-links contents, each section has its checksum. Sc-elements are referenced by their indices in image, so image
+ * doesn't depend on sc-addresses and layout of knowledge base binaries, and it can be loaded into any sc-memory.
+ *
+ * Sc-elements are stored in such order that incident sc-elements of each sc-connector precede it, so image is loaded
+ * in one sequential pass. Sc-elements with system identifiers are followed by sc-link and sc-arcs of their system
+ * identifiers quintuples. Sc-elements which aren't captured, but are incident to captured sc-connectors, are stored as
+ * external ones with their system identifiers.
+ *
+ * @code
+ * ScKBImage image = ScKBImage::Capture(context, elements);
+ * image.Save("kb.image");
+ *
+ * ScKBImage loadedImage;
+ * loadedImage.Load("kb.image");
+ * loadedImage.Generate(context);
+ * @endcode
+ */
+class ScKBImage
+{
+public:
+  static std::string const FILE_MAGIC;
+  static sc_uint32 const VERSION;
+
+  enum class ElementKind : sc_uint8
+  {
+    //! Sc-node or sc-link
+    Node = 0,
+    Connector = 1,
+    //! Sc-element which isn't captured into image and is resolved by its system identifier
+    External = 2,
+    //! Sc-link of system identifier quintuple of previous sc-element with system identifier
+    SystemIdentifierLink = 3,
+    //! Common sc-arc of system identifier quintuple of previous sc-element with system identifier
+    SystemIdentifierArc = 4,
+    //! Membership sc-arc from `nrel_system_identifier` of system identifier quintuple of previous sc-element
+    SystemIdentifierRelationArc = 5
+  };
+
+  struct Element
+  {
+    ElementKind m_kind;
+    ScType m_type;
+    //! Index of source sc-element for sc-connectors
+    sc_uint32 m_source;
+    //! Index of target sc-element for sc-connectors
+    sc_uint32 m_target;
+  };
+
+  /*! Captures sc-elements from sc-memory into image. Sc-elements of system identifiers quintuples of captured
+   * sc-elements are captured with them, even if they aren't specified.
+   * @param context Sc-memory context to read sc-elements.
+   * @param elements Sc-elements to capture. Erased sc-elements are skipped.
+   * @return Image of sc-elements.
+   * @throws utils::ExceptionInvalidState if incident sc-element of captured sc-connector isn't captured and it has no
+   * system identifier.
+   */
+  _SC_EXTERN static ScKBImage Capture(ScMemoryContext & context, ScAddrVector const & elements);
+
+  /*! Generates sc-elements of image in sc-memory. Sc-elements with system identifiers, including external ones, are
+   * found in sc-memory and their types are extended, if they exist, and generated otherwise. Sc-elements are generated
+   * one by one by `context`, as if they were generated by sc-builder.
+   * @param context Sc-memory context to generate sc-elements.
+   * @return Sc-addresses of image sc-elements in order of their indices.
+   * @throws utils::ExceptionInvalidType if type of existing sc-element with system identifier can't be extended.
+   */
+  _SC_EXTERN ScAddrVector Generate(ScMemoryContext & context) const;
+
+  /*! Merges other image into this image. Sc-elements with the same system identifiers are merged into one sc-element.
+   * @param other Image to merge.
+   * @throws utils::ExceptionInvalidType if types of sc-elements with the same system identifier aren't compatible.
+   */
+  _SC_EXTERN void Merge(ScKBImage const & other);
+
+  /*! Saves image into file.
+   * @throws utils::ExceptionInvalidState if file can't be written.
+   */
+  _SC_EXTERN void Save(std::string const & filePath) const;
+
+  /*! Loads image from file, that is previously saved by `Save`.
+   * @throws utils::ExceptionInvalidState if file can't be read, or it has unsupported version, or it is corrupted.
+   */
+  _SC_EXTERN void Load(std::string const & filePath);
+
+  _SC_EXTERN std::vector<Element> const & GetElements() const;
+
+  /*! Gets system identifier of image sc-element.
+   * @return System identifier or empty string if sc-element has no system identifier.
+   */
+  _SC_EXTERN std::string GetSystemIdentifier(sc_uint32 index) const;
+
+  /*! Gets content of image sc-link.
+   * @return Content or empty string if sc-element has no content.
+   */
+  _SC_EXTERN std::string GetLinkContent(sc_uint32 index) const;
+
+private:
+  class Capturer;
+
+  enum class SectionId : sc_uint32
+  {
+    Elements = 1,
+    SystemIdentifiers = 2,
+    LinksContents = 3
+  };
+
+  std::vector<Element> m_elements;
+  std::unordered_map<sc_uint32, std::string> m_systemIdentifiers;
+  std::unordered_map<sc_uint32, std::string> m_linksContents;
+  std::unordered_map<std::string, sc_uint32> m_systemIdentifiersToElements;
+
+  sc_uint32 AppendElement(ElementKind kind, ScType const & type, sc_uint32 source = 0, sc_uint32 target = 0);
+  sc_uint32 AppendIdentifiedElement(ElementKind kind, ScType const & type, std::string const & systemIdentifier);
+  void Clear();
+};
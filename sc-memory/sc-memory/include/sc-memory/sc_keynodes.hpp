@@ -106,6 +106,14 @@ protected:
    * @param context A sc-memory context used for initialization.
    */
   virtual void Initialize(ScMemoryContext * context);
+
+  /*!
+   * @brief Checks whether the keynode is initialized only by resolving its system identifier and sc-type, so it can be
+   * resolved together with other keynodes instead of calling `Initialize`.
+   * @return True for plain keynodes.
+   * @warning Override it to return false in classes that override `Initialize`, otherwise `Initialize` isn't called.
+   */
+  virtual bool IsBatchResolvable() const;
 };
 
 /*!
@@ -177,6 +185,11 @@ private:
    * @param context A sc-memory context used for initialization.
    */
   void Initialize(ScMemoryContext * context) override;
+
+  /*!
+   * @brief Returns false, because sc-template keynodes are initialized after other keynodes used in their sc-templates.
+   */
+  bool IsBatchResolvable() const override;
 };
 
 #include "sc-memory/_template/sc_keynodes.tpp"
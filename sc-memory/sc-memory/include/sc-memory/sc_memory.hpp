@@ -315,6 +315,30 @@ public:
    */
   _SC_EXTERN bool EraseElement(ScAddr const & elementAddr) noexcept(false);
 
+  /*!
+   * @brief Erases sc-elements from the sc-memory.
+   *
+   * This method erases the sc-elements identified by the given sc-addresses and all sc-connectors incident to them.
+   * Incident sc-connectors are collected once for all sc-elements, so it is faster than erasing sc-elements one by one
+   * by `EraseElement`. Not existing sc-elements are skipped.
+   *
+   * @param elementAddrs A vector of sc-addresses of the sc-elements to erase.
+   *
+   * @return true if the sc-elements were successfully erased; otherwise, returns false.
+   *
+   * @throws utils::ExceptionInvalidState if the sc-memory context is not authenticated or does not have erase
+   * permissions for at least one of sc-elements. Sc-elements aren't erased in this case.
+   *
+   * @code
+   * ScMemoryContext context;
+   * ScAddrVector elementAddrs;
+   * for (size_t i = 0; i < 1000; ++i)
+   *   elementAddrs.push_back(context.GenerateNode(ScType::ConstNode));
+   * context.EraseElements(elementAddrs);
+   * @endcode
+   */
+  _SC_EXTERN bool EraseElements(ScAddrVector const & elementAddrs) noexcept(false);
+
   /*!
    * @brief Generates a new sc-node with the specified type.
    *
@@ -1507,6 +1531,43 @@ public:
       ParamType5 const & param5,
       QuintupleCallback && callback);
 
+  /*!
+   * @brief Creates an iterator for iterating over all sc-elements of the specified type.
+   *
+   * Sc-elements which types have all bits of the specified type are iterated in order of their sc-addresses. If
+   * sc-elements are indexed by their types (config option `index_elements_by_types`), then they are found without
+   * scanning all sc-segments.
+   *
+   * @param elementType A sc-type of sc-elements to iterate. If it is `ScType::Unknown`, then all sc-elements are
+   * iterated.
+   *
+   * @returns A shared pointer to iterator for iterating over sc-elements.
+   *
+   * @throws utils::ExceptionInvalidState if the sc-memory context is not authenticated.
+   *
+   * @code
+   * ScElementsIteratorPtr it = context.CreateElementsIterator(ScType::ConstNodeClass);
+   * while (it->Next())
+   * {
+   *   ScAddr const & classAddr = it->Get();
+   * }
+   * @endcode
+   */
+  _SC_EXTERN ScElementsIteratorPtr CreateElementsIterator(ScType const & elementType);
+
+  /*!
+   * @brief Iterates over all sc-elements of the specified type and calls the provided function for each of them.
+   *
+   * @param elementType A sc-type of sc-elements to iterate. If it is `ScType::Unknown`, then all sc-elements are
+   * iterated.
+   * @param callback A function to be called for each sc-element.
+   *
+   * @note callback function should have 1 parameter (ScAddr const & elementAddr).
+   * @throws utils::ExceptionInvalidState if the sc-memory context is not authenticated.
+   */
+  template <typename ElementCallback>
+  _SC_EXTERN void ForEachElement(ScType const & elementType, ElementCallback && callback);
+
   /*!
    * @brief Checks the existence of a sc-connector between two sc-elements with the specified type.
    *
@@ -1673,6 +1734,33 @@ public:
       ScType const & elementType,
       ScSystemIdentifierQuintuple & outQuintuple) noexcept(false);
 
+  /*!
+   * @brief Resolves sc-elements by several system identifiers at once.
+   *
+   * System identifiers are sorted and deduplicated, so each of them is found once. Sc-nodes for all not found system
+   * identifiers are generated after search in one mode of deferred sc-links indexing. If the same system identifier is
+   * specified several times, then sc-node for it is generated with the first specified sc-type.
+   *
+   * @param systemIdentifiers Pairs of system identifiers of sc-elements to resolve and sc-types of sc-nodes to generate
+   * if sc-elements are not found.
+   * @returns System identifier quintuples of resolved sc-elements in order of specified system identifiers. Quintuple
+   * is empty if sc-element is not found and its sc-type is unknown.
+   *
+   * @throws utils::ExceptionInvalidParams if some of the specified system identifiers is invalid or resolving
+   * sc-element type is not ScType::Node subtype.
+   * @throws utils::ExceptionInvalidState if the sc-memory context is not valid or in an invalid state.
+   * @throws utils::ExceptionInvalidState if the sc-memory context is not authenticated or does not have write and erase
+   * permissions.
+   *
+   * @code
+   * ScMemoryContext context;
+   * std::vector<ScSystemIdentifierQuintuple> const & quintuples = context.ResolveElementsSystemIdentifiers(
+   *     {{"example_class", ScType::ConstNodeClass}, {"example_relation", ScType::ConstNodeNonRole}});
+   * @endcode
+   */
+  _SC_EXTERN std::vector<ScSystemIdentifierQuintuple> ResolveElementsSystemIdentifiers(
+      std::vector<std::pair<std::string, ScType>> const & systemIdentifiers) noexcept(false);
+
   /*!
    * @brief Resolves the sc-address of an sc-element by its system identifier.
    *
@@ -2702,6 +2790,28 @@ public:
    */
   _SC_EXTERN bool Save();
 
+  /*!
+   * @brief Begins mode in which sc-links contents aren't indexed to search sc-links by content substrings.
+   *
+   * Modes can be nested, and sc-links contents are indexed when the last begun mode is ended. Sc-links are still found
+   * by their full contents in this mode. Use this mode to generate large amount of sc-links.
+   *
+   * @throws utils::ExceptionInvalidState if the sc-memory context is not authenticated or does not have write
+   * permissions.
+   */
+  _SC_EXTERN void BeginDeferredLinksIndexing();
+
+  /*!
+   * @brief Ends mode begun by `BeginDeferredLinksIndexing` and indexes deferred sc-links contents, if it is the last
+   * begun mode.
+   *
+   * @return true if the mode was ended; otherwise, returns false, if the mode wasn't begun.
+   *
+   * @throws utils::ExceptionInvalidState if the sc-memory context is not authenticated or does not have write
+   * permissions.
+   */
+  _SC_EXTERN bool EndDeferredLinksIndexing();
+
 protected:
   _SC_EXTERN explicit ScMemoryContext(ScAddr const & userAddr) noexcept;
 
@@ -2751,4 +2861,22 @@ private:
   ScMemoryContext & m_context;
 };
 
+class ScMemoryContextDeferredLinksIndexingGuard
+{
+public:
+  _SC_EXTERN explicit ScMemoryContextDeferredLinksIndexingGuard(ScMemoryContext & context)
+    : m_context(context)
+  {
+    m_context.BeginDeferredLinksIndexing();
+  }
+
+  _SC_EXTERN ~ScMemoryContextDeferredLinksIndexingGuard()
+  {
+    m_context.EndDeferredLinksIndexing();
+  }
+
+private:
+  ScMemoryContext & m_context;
+};
+
 #include "sc-memory/_template/sc_memory.tpp"
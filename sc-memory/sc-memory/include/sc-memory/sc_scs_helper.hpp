@@ -7,6 +7,8 @@
 #pragma once
 
 #include <memory>
+#include <string>
+#include <unordered_map>
 
 #include "sc_addr.hpp"
 
@@ -23,18 +25,104 @@ using SCsFileInterfacePtr = std::shared_ptr<SCsFileInterface>;
 
 class ScMemoryContext;
 
+namespace scs
+{
+class Parser;
+}
+
+namespace impl
+{
+class StructGenerator;
+}
+
+/*!
+ * Cache of sc-elements by their system and global identifiers. It is shared by several SCsHelper to resolve identifiers
+ * used in many SCs-texts by hash lookups instead of search of system identifiers and templates search of global
+ * identifiers in sc-memory. SCsHelper appends resolved and generated sc-elements into the cache.
+ *
+ * Cache isn't thread-safe. Sc-elements with identifiers erased from sc-memory aren't removed from the cache, so it
+ * should be loaded again after their erasure.
+ */
+class SCsIdentifiersCache final
+{
+  friend class impl::StructGenerator;
+
+public:
+  /*! Loads all sc-elements with system and global identifiers from sc-memory. Sc-elements with global identifiers are
+   * searched only in the cache after it is loaded, because they can be generated only by SCsHelper.
+   * @param ctx Sc-memory context to search sc-elements.
+   */
+  _SC_EXTERN void Load(ScMemoryContext & ctx);
+
+  _SC_EXTERN void Clear();
+
+  _SC_EXTERN size_t GetSystemIdentifiersNum() const;
+  _SC_EXTERN size_t GetGlobalIdentifiersNum() const;
+
+private:
+  struct Element
+  {
+    ScAddr m_addr;
+    //! Sc-elements of identifier construction except identified sc-element
+    ScAddrVector m_identifierElements;
+  };
+
+  using Elements = std::unordered_map<std::string, Element>;
+
+  Elements m_systemIdentifiers;
+  Elements m_globalIdentifiers;
+  bool m_isLoaded = false;
+};
+
+using SCsIdentifiersCachePtr = std::shared_ptr<SCsIdentifiersCache>;
+
 class SCsHelper final
 {
 public:
-  _SC_EXTERN SCsHelper(ScMemoryContext & ctx, SCsFileInterfacePtr fileInterface);
+  /*! @param ctx Sc-memory context to generate sc-constructions.
+   * @param fileInterface Interface to get contents of files specified in SCs-texts by URLs.
+   * @param identifiersCache Cache of sc-elements by identifiers shared with other SCsHelper. If it is null, then each
+   * SCs-text resolves identifiers in sc-memory.
+   */
+  _SC_EXTERN SCsHelper(
+      ScMemoryContext & ctx,
+      SCsFileInterfacePtr fileInterface,
+      SCsIdentifiersCachePtr identifiersCache = nullptr);
 
   _SC_EXTERN bool GenerateBySCsText(std::string const & scsText, ScAddr const & outputStructure = ScAddr::Empty);
   _SC_EXTERN void GenerateBySCsTextLazy(std::string const & scsText, ScAddr const & outputStructure = ScAddr::Empty);
+
+  /*! Generates sc-constructions from already parsed SCs-text. It allows to parse SCs-texts in several threads and
+   * generate them in sc-memory sequentially.
+   * @param parser Parser that has parsed SCs-text successfully.
+   * @param outputStructure Structure to which all generated sc-elements are appended.
+   * @return If sc-constructions generated without any errors, then returns true; otherwise returns false.
+   */
+  _SC_EXTERN bool GenerateByParsedSCs(scs::Parser const & parser, ScAddr const & outputStructure = ScAddr::Empty);
+
+  /*! Generates sc-constructions from already parsed SCs-text and collects all generated sc-elements. Found by
+   * identifiers sc-elements aren't collected.
+   * @param parser Parser that has parsed SCs-text successfully.
+   * @param outputStructure Structure to which all generated sc-elements are appended.
+   * @param generatedElements Vector to which generated sc-elements are appended in order of their generation.
+   * @return If sc-constructions generated without any errors, then returns true; otherwise returns false.
+   */
+  _SC_EXTERN bool GenerateByParsedSCs(
+      scs::Parser const & parser,
+      ScAddr const & outputStructure,
+      ScAddrVector & generatedElements);
+
   _SC_EXTERN std::string const & GetLastError() const;
 
 private:
+  bool GenerateByParsedSCs(
+      scs::Parser const & parser,
+      ScAddr const & outputStructure,
+      ScAddrVector * generatedElements);
+
   ScMemoryContext & m_ctx;
 
   SCsFileInterfacePtr m_fileInterface;
+  SCsIdentifiersCachePtr m_identifiersCache;
   std::string m_lastError;
 };
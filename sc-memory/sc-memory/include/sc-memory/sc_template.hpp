@@ -455,6 +455,29 @@ public:
       ScTemplateItem const & param4,
       ScTemplateItem const & param5) noexcept(false);
 
+  /*!
+   * @brief Adds triples of object of `ScTemplate` to another one, replacing its sc-variables with names of parameters
+   * by values of these parameters.
+   *
+   * Use it to search sc-constructions by sc-template with parameters: unlike generation, search has no parameters.
+   *
+   * @param params Values of sc-variables by their names.
+   * @param resultTemplate An object of `ScTemplate` to add triples to. It must be empty.
+   * @throws utils::ExceptionInvalidParams if `resultTemplate` isn't empty or value of any parameter is invalid.
+   *
+   * @code
+   * ScTemplate templ;
+   * templ.Triple(ScType::VarNode >> "_node", ScType::VarPermPosArc, ScType::VarNode);
+   *
+   * ScTemplateParams params;
+   * params.Add("_node", nodeAddr);
+   *
+   * ScTemplate substitutedTempl;
+   * templ.Substitute(params, substitutedTempl);
+   * @endcode
+   */
+  _SC_EXTERN void Substitute(ScTemplateParams const & params, ScTemplate & resultTemplate) const noexcept(false);
+
 protected:
   // Begin: calls by memory context
 
@@ -34,6 +34,8 @@ class _SC_EXTERN ScType
   friend class ScMemoryGenerateElementsJsonAction;
   friend class ScMemoryHandleKeynodesJsonAction;
   friend class ScMemoryMakeTemplateJsonAction;
+  friend class ScKBImage;
+  friend class ScBuildManifest;
   friend struct ScTypeHashFunc;
 
 public:
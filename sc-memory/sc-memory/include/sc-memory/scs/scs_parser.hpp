@@ -109,6 +109,7 @@ struct ParsedTriple
 class Parser
 {
   friend class scsParser;
+  friend class FastParser;
 
   // Number of parsed elements, to preallocate container
   static size_t const PARSED_PREALLOC_NUM = 1024;
@@ -120,6 +121,7 @@ public:
   using AliasHandles = std::map<std::string, ElementHandle>;
 
   _SC_EXTERN Parser();
+  _SC_EXTERN virtual ~Parser() = default;
 
   _SC_EXTERN bool Parse(std::string const & str);
   _SC_EXTERN ParsedElement const & GetParsedElement(ElementHandle const & handle) const;
@@ -139,6 +141,11 @@ public:
   }
 
 protected:
+  /*! Parses SCs-text by ANTLR-parser only. Parse tries to parse SCs-text by hand-written parser before, and it uses
+   * ANTLR-parser if SCs-text contains unsupported constructions or errors.
+   */
+  _SC_EXTERN bool ParseByANTLR(std::string const & str);
+
   ParsedElement & GetParsedElementRef(ElementHandle const & handle);
 
   bool IsElementTypeOutgoingBaseArc(ParsedElement const & element) const;
@@ -161,6 +168,9 @@ protected:
   void ProcessAssign(std::string const & alias, ElementHandle const & value);
 
 private:
+  bool IsEmpty() const;
+  void Clear();
+
   ParsedElementVector & GetContainerByElementVisibilityRef(Visibility visibility);
   ParsedElementVector const & GetContainerByElementVisibility(Visibility visibility) const;
   ElementHandle AppendElement(
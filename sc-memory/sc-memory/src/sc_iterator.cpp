@@ -160,3 +160,43 @@ sc_iterator5 * CreateIterator5<sc_type, sc_type, sc_type, sc_type, sc_addr>(
 {
   return sc_iterator5_a_a_a_a_f_new(*context, p1, p2, p3, p4, p5);
 }
+
+ScElementsIterator::ScElementsIterator(ScMemoryContext const & context, ScType const & elementType)
+  : m_iterator(sc_elements_iterator_new(*context, *elementType))
+{
+}
+
+ScElementsIterator::~ScElementsIterator()
+{
+  sc_elements_iterator_free(m_iterator);
+  m_iterator = nullptr;
+}
+
+bool ScElementsIterator::IsValid() const
+{
+  return m_iterator != nullptr;
+}
+
+bool ScElementsIterator::Next() const
+{
+  sc_result result;
+  bool const status = sc_elements_iterator_next_ext(m_iterator, &result);
+
+  switch (result)
+  {
+  case SC_RESULT_NO:
+    SC_THROW_EXCEPTION(utils::ExceptionInvalidParams, "Specified elements iterator is empty to iterate next");
+  case SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED:
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState, "Unable to iterate next sc-element because sc-memory context is not authorized");
+  default:
+    break;
+  }
+
+  return status;
+}
+
+ScAddr ScElementsIterator::Get() const
+{
+  return ScAddr(sc_elements_iterator_value(m_iterator));
+}
@@ -0,0 +1,625 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "sc-memory/sc_kb_image.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <string_view>
+
+#include "sc-memory/sc_memory.hpp"
+#include "sc-memory/sc_keynodes.hpp"
+
+std::string const ScKBImage::FILE_MAGIC = "sc-kb-image";
+sc_uint32 const ScKBImage::VERSION = 1;
+
+namespace
+{
+
+sc_uint64 CalculateChecksum(std::string_view const & data)
+{
+  // FNV-1a hash is enough to detect corrupted sections, and it is stable between platforms and builds
+  sc_uint64 hash = 14695981039346656037ull;
+  for (char const symbol : data)
+  {
+    hash ^= static_cast<unsigned char>(symbol);
+    hash *= 1099511628211ull;
+  }
+
+  return hash;
+}
+
+// Numbers are written in little-endian byte order regardless of platform
+template <typename TNumber>
+void WriteNumber(std::string & buffer, TNumber value)
+{
+  for (size_t i = 0; i < sizeof(TNumber); ++i)
+    buffer.push_back(static_cast<char>((static_cast<sc_uint64>(value) >> (8 * i)) & 0xFF));
+}
+
+void WriteString(std::string & buffer, std::string const & value)
+{
+  WriteNumber<sc_uint32>(buffer, static_cast<sc_uint32>(value.size()));
+  buffer.append(value);
+}
+
+class Reader
+{
+public:
+  explicit Reader(std::string_view const & data)
+    : m_data(data)
+    , m_offset(0)
+  {
+  }
+
+  template <typename TNumber>
+  TNumber ReadNumber()
+  {
+    std::string_view const & bytes = Read(sizeof(TNumber));
+
+    sc_uint64 value = 0;
+    for (size_t i = 0; i < sizeof(TNumber); ++i)
+      value |= static_cast<sc_uint64>(static_cast<unsigned char>(bytes[i])) << (8 * i);
+
+    return static_cast<TNumber>(value);
+  }
+
+  std::string ReadString()
+  {
+    return std::string(Read(ReadNumber<sc_uint32>()));
+  }
+
+  std::string_view Read(size_t size)
+  {
+    if (size > m_data.size() - m_offset)
+      SC_THROW_EXCEPTION(utils::ExceptionInvalidState, "Knowledge base image is truncated.");
+
+    std::string_view const bytes = m_data.substr(m_offset, size);
+    m_offset += size;
+    return bytes;
+  }
+
+  bool IsEnd() const
+  {
+    return m_offset == m_data.size();
+  }
+
+private:
+  std::string_view m_data;
+  size_t m_offset;
+};
+
+void WriteSection(std::string & buffer, sc_uint32 id, std::string const & payload)
+{
+  WriteNumber<sc_uint32>(buffer, id);
+  WriteNumber<sc_uint64>(buffer, payload.size());
+  WriteNumber<sc_uint64>(buffer, CalculateChecksum(payload));
+  buffer.append(payload);
+}
+
+void WriteStrings(std::string & buffer, std::unordered_map<sc_uint32, std::string> const & strings)
+{
+  // strings are sorted by indices of sc-elements to save the same image for the same sc-elements
+  std::vector<std::pair<sc_uint32, std::string const *>> sortedStrings;
+  sortedStrings.reserve(strings.size());
+  for (auto const & [index, value] : strings)
+    sortedStrings.emplace_back(index, &value);
+  std::sort(sortedStrings.begin(), sortedStrings.end());
+
+  WriteNumber<sc_uint64>(buffer, sortedStrings.size());
+  for (auto const & [index, value] : sortedStrings)
+  {
+    WriteNumber<sc_uint32>(buffer, index);
+    WriteString(buffer, *value);
+  }
+}
+
+void ReadStrings(Reader & reader, size_t elementsNum, std::unordered_map<sc_uint32, std::string> & strings)
+{
+  sc_uint64 const stringsNum = reader.ReadNumber<sc_uint64>();
+  for (sc_uint64 i = 0; i < stringsNum; ++i)
+  {
+    sc_uint32 const index = reader.ReadNumber<sc_uint32>();
+    if (index >= elementsNum)
+      SC_THROW_EXCEPTION(utils::ExceptionInvalidState, "Knowledge base image refers to unknown sc-element " << index);
+
+    strings[index] = reader.ReadString();
+  }
+}
+
+bool IsSystemIdentifierPart(ScKBImage::ElementKind kind)
+{
+  return kind == ScKBImage::ElementKind::SystemIdentifierLink || kind == ScKBImage::ElementKind::SystemIdentifierArc
+         || kind == ScKBImage::ElementKind::SystemIdentifierRelationArc;
+}
+
+//! Offset of system identifier quintuple part from sc-element with this system identifier
+sc_uint32 GetSystemIdentifierPartOffset(ScKBImage::ElementKind kind)
+{
+  return static_cast<sc_uint32>(kind) - static_cast<sc_uint32>(ScKBImage::ElementKind::SystemIdentifierLink) + 1;
+}
+
+void ExtendElementType(ScType & type, ScType const & newType, std::string const & systemIdentifier)
+{
+  if (type == newType || newType.CanExtendTo(type))
+    return;
+
+  if (!type.CanExtendTo(newType))
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidType,
+        "Can't extend type `" << std::string(type) << "` to type `" << std::string(newType) << "` for element `"
+                              << systemIdentifier << "`.");
+
+  type = newType;
+}
+
+}  // namespace
+
+class ScKBImage::Capturer
+{
+public:
+  Capturer(ScMemoryContext & context, ScKBImage & image)
+    : m_context(context)
+    , m_image(image)
+  {
+  }
+
+  void operator()(ScAddrVector const & elements)
+  {
+    for (ScAddr const & addr : elements)
+    {
+      if (m_context.IsElement(addr))
+        m_capturedElements.insert(addr);
+    }
+
+    // sc-elements of system identifiers quintuples are captured with sc-elements identified by them
+    for (ScAddr const & addr : m_capturedElements)
+    {
+      if (m_context.GetElementType(addr).IsConnector())
+        continue;
+
+      std::string const & systemIdentifier = m_context.GetElementSystemIdentifier(addr);
+      if (systemIdentifier.empty())
+        continue;
+
+      m_systemIdentifiers[addr] = systemIdentifier;
+      ScSystemIdentifierQuintuple quintuple;
+      m_context.SearchElementBySystemIdentifier(systemIdentifier, quintuple);
+      m_systemIdentifierParts[quintuple.addr2] = addr;
+      m_systemIdentifierParts[quintuple.addr3] = addr;
+      m_systemIdentifierParts[quintuple.addr4] = addr;
+    }
+
+    for (ScAddr const & addr : elements)
+    {
+      if (m_capturedElements.find(addr) != m_capturedElements.cend())
+        Capture(addr);
+    }
+  }
+
+private:
+  ScMemoryContext & m_context;
+  ScKBImage & m_image;
+
+  ScAddrUnorderedSet m_capturedElements;
+  ScAddrToValueUnorderedMap<std::string> m_systemIdentifiers;
+  ScAddrToValueUnorderedMap<ScAddr> m_systemIdentifierParts;
+  ScAddrToValueUnorderedMap<sc_uint32> m_indices;
+
+  sc_uint32 Capture(ScAddr const & addr)
+  {
+    auto const it = m_indices.find(addr);
+    if (it != m_indices.cend())
+      return it->second;
+
+    auto const partIt = m_systemIdentifierParts.find(addr);
+    if (partIt != m_systemIdentifierParts.cend())
+    {
+      Capture(partIt->second);
+      return GetIndex(addr);
+    }
+
+    ScType const & type = m_context.GetElementType(addr);
+    if (type.IsConnector())
+    {
+      auto const [sourceAddr, targetAddr] = m_context.GetConnectorIncidentElements(addr);
+      sc_uint32 const source = CaptureIncidentElement(sourceAddr);
+      sc_uint32 const target = CaptureIncidentElement(targetAddr);
+      return m_indices[addr] = m_image.AppendElement(ElementKind::Connector, type, source, target);
+    }
+
+    auto const systemIdentifierIt = m_systemIdentifiers.find(addr);
+    sc_uint32 const index = systemIdentifierIt == m_systemIdentifiers.cend()
+                                ? m_image.AppendElement(ElementKind::Node, type)
+                                : AppendIdentifiedElement(ElementKind::Node, addr, systemIdentifierIt->second);
+    m_indices[addr] = index;
+
+    std::string content;
+    if (type.IsLink() && m_context.GetLinkContent(addr, content))
+      m_image.m_linksContents[index] = content;
+
+    return index;
+  }
+
+  sc_uint32 CaptureIncidentElement(ScAddr const & addr)
+  {
+    if (m_capturedElements.find(addr) != m_capturedElements.cend()
+        || m_systemIdentifierParts.find(addr) != m_systemIdentifierParts.cend())
+      return Capture(addr);
+
+    auto const it = m_indices.find(addr);
+    if (it != m_indices.cend())
+      return it->second;
+
+    // not captured sc-element is found by its system identifier when image is loaded
+    ScAddr const & ownerAddr = ResolveSystemIdentifierOwner(addr);
+    std::string const & systemIdentifier =
+        m_context.GetElementSystemIdentifier(ownerAddr.IsValid() ? ownerAddr : addr);
+    if (systemIdentifier.empty())
+      SC_THROW_EXCEPTION(
+          utils::ExceptionInvalidState,
+          "Sc-element `" << addr.Hash() << "` can't be captured into knowledge base image, because it isn't specified "
+                         << "to capture and it has no system identifier.");
+
+    if (ownerAddr.IsValid())
+    {
+      AppendIdentifiedElement(ElementKind::External, ownerAddr, systemIdentifier);
+      return GetIndex(addr);
+    }
+
+    return m_indices[addr] = AppendIdentifiedElement(ElementKind::External, addr, systemIdentifier);
+  }
+
+  sc_uint32 GetIndex(ScAddr const & addr) const
+  {
+    auto const it = m_indices.find(addr);
+    if (it == m_indices.cend())
+      SC_THROW_EXCEPTION(
+          utils::ExceptionInvalidState,
+          "Sc-element `" << addr.Hash() << "` of system identifier quintuple can't be captured into knowledge base "
+                         << "image, because sc-element has several system identifiers.");
+
+    return it->second;
+  }
+
+  //! Finds sc-element, which system identifier quintuple contains specified sc-element
+  ScAddr ResolveSystemIdentifierOwner(ScAddr const & addr) const
+  {
+    ScType const & type = m_context.GetElementType(addr);
+    if (type.IsLink())
+    {
+      ScIterator5Ptr const it = m_context.CreateIterator5(
+          ScType::Unknown,
+          ScType::ConstCommonArc,
+          addr,
+          ScType::ConstPermPosArc,
+          ScKeynodes::nrel_system_identifier);
+      return it->Next() ? it->Get(0) : ScAddr::Empty;
+    }
+
+    if (type == ScType::ConstCommonArc
+        && m_context.CheckConnector(ScKeynodes::nrel_system_identifier, addr, ScType::ConstPermPosArc))
+      return m_context.GetArcSourceElement(addr);
+
+    if (type == ScType::ConstPermPosArc && m_context.GetArcSourceElement(addr) == ScKeynodes::nrel_system_identifier)
+    {
+      ScAddr const & arcAddr = m_context.GetArcTargetElement(addr);
+      if (m_context.GetElementType(arcAddr) == ScType::ConstCommonArc)
+        return m_context.GetArcSourceElement(arcAddr);
+    }
+
+    return ScAddr::Empty;
+  }
+
+  sc_uint32 AppendIdentifiedElement(ElementKind kind, ScAddr const & addr, std::string const & systemIdentifier)
+  {
+    ScSystemIdentifierQuintuple quintuple;
+    m_context.SearchElementBySystemIdentifier(systemIdentifier, quintuple);
+
+    sc_uint32 const index = m_image.AppendIdentifiedElement(kind, m_context.GetElementType(addr), systemIdentifier);
+    m_indices[addr] = index;
+    m_indices[quintuple.addr3] = m_image.AppendElement(
+        ElementKind::SystemIdentifierLink, m_context.GetElementType(quintuple.addr3), index);
+    m_indices[quintuple.addr2] =
+        m_image.AppendElement(ElementKind::SystemIdentifierArc, m_context.GetElementType(quintuple.addr2), index);
+    m_indices[quintuple.addr4] = m_image.AppendElement(
+        ElementKind::SystemIdentifierRelationArc, m_context.GetElementType(quintuple.addr4), index);
+
+    return index;
+  }
+};
+
+ScKBImage ScKBImage::Capture(ScMemoryContext & context, ScAddrVector const & elements)
+{
+  ScKBImage image;
+  Capturer capture(context, image);
+  capture(elements);
+  return image;
+}
+
+ScAddrVector ScKBImage::Generate(ScMemoryContext & context) const
+{
+  ScAddrVector addrs;
+  addrs.reserve(m_elements.size());
+
+  ScSystemIdentifierQuintuple quintuple;
+  for (sc_uint32 index = 0; index < m_elements.size(); ++index)
+  {
+    Element const & element = m_elements[index];
+    switch (element.m_kind)
+    {
+    case ElementKind::Connector:
+      addrs.push_back(context.GenerateConnector(element.m_type, addrs[element.m_source], addrs[element.m_target]));
+      break;
+
+    case ElementKind::Node:
+    case ElementKind::External:
+    {
+      std::string const & systemIdentifier = GetSystemIdentifier(index);
+      if (!systemIdentifier.empty() && context.SearchElementBySystemIdentifier(systemIdentifier, quintuple))
+      {
+        ScType const & oldType = context.GetElementType(quintuple.addr1);
+        ScType newType = oldType;
+        ExtendElementType(newType, element.m_type, systemIdentifier);
+        if (newType != oldType)
+          context.SetElementSubtype(quintuple.addr1, newType);
+
+        addrs.push_back(quintuple.addr1);
+        break;
+      }
+
+      ScAddr const & addr =
+          element.m_type.IsLink() ? context.GenerateLink(element.m_type) : context.GenerateNode(element.m_type);
+      auto const it = m_linksContents.find(index);
+      if (it != m_linksContents.cend())
+        context.SetLinkContent(addr, it->second);
+
+      if (!systemIdentifier.empty())
+        context.SetElementSystemIdentifier(systemIdentifier, addr, quintuple);
+
+      addrs.push_back(addr);
+      break;
+    }
+
+    case ElementKind::SystemIdentifierLink:
+      addrs.push_back(quintuple.addr3);
+      break;
+
+    case ElementKind::SystemIdentifierArc:
+      addrs.push_back(quintuple.addr2);
+      break;
+
+    case ElementKind::SystemIdentifierRelationArc:
+      addrs.push_back(quintuple.addr4);
+      break;
+    }
+  }
+
+  return addrs;
+}
+
+void ScKBImage::Merge(ScKBImage const & other)
+{
+  sc_uint32 const elementsNum = static_cast<sc_uint32>(m_elements.size());
+  std::vector<sc_uint32> indices(other.m_elements.size());
+
+  for (sc_uint32 index = 0; index < other.m_elements.size(); ++index)
+  {
+    Element const & element = other.m_elements[index];
+    if (element.m_kind == ElementKind::Connector)
+    {
+      indices[index] = AppendElement(
+          ElementKind::Connector, element.m_type, indices[element.m_source], indices[element.m_target]);
+      continue;
+    }
+
+    if (IsSystemIdentifierPart(element.m_kind))
+    {
+      // sc-element with this system identifier is appended or merged already
+      sc_uint32 const ownerIndex = indices[element.m_source];
+      indices[index] = ownerIndex < elementsNum ? ownerIndex + GetSystemIdentifierPartOffset(element.m_kind)
+                                                : AppendElement(element.m_kind, element.m_type, ownerIndex);
+      continue;
+    }
+
+    std::string const & systemIdentifier = other.GetSystemIdentifier(index);
+    auto const it = m_systemIdentifiersToElements.find(systemIdentifier);
+    if (systemIdentifier.empty())
+      indices[index] = AppendElement(element.m_kind, element.m_type);
+    else if (it == m_systemIdentifiersToElements.cend())
+      indices[index] = AppendIdentifiedElement(element.m_kind, element.m_type, systemIdentifier);
+    else
+    {
+      indices[index] = it->second;
+
+      Element & existingElement = m_elements[it->second];
+      ExtendElementType(existingElement.m_type, element.m_type, systemIdentifier);
+      if (element.m_kind == ElementKind::External || existingElement.m_kind != ElementKind::External)
+        continue;
+
+      // external sc-element becomes captured one, if it is captured in other image
+      existingElement.m_kind = ElementKind::Node;
+    }
+
+    auto const contentIt = other.m_linksContents.find(index);
+    if (contentIt != other.m_linksContents.cend())
+      m_linksContents[indices[index]] = contentIt->second;
+  }
+}
+
+void ScKBImage::Save(std::string const & filePath) const
+{
+  std::string elements;
+  elements.reserve(sizeof(sc_uint64) + m_elements.size() * 11);
+  WriteNumber<sc_uint64>(elements, m_elements.size());
+  for (Element const & element : m_elements)
+  {
+    WriteNumber<sc_uint8>(elements, static_cast<sc_uint8>(element.m_kind));
+    WriteNumber<sc_uint16>(elements, static_cast<sc_type>(element.m_type));
+    WriteNumber<sc_uint32>(elements, element.m_source);
+    WriteNumber<sc_uint32>(elements, element.m_target);
+  }
+
+  std::string systemIdentifiers;
+  WriteStrings(systemIdentifiers, m_systemIdentifiers);
+
+  std::string linksContents;
+  WriteStrings(linksContents, m_linksContents);
+
+  std::string buffer = FILE_MAGIC;
+  WriteNumber<sc_uint32>(buffer, VERSION);
+  WriteNumber<sc_uint32>(buffer, 3);
+  WriteSection(buffer, static_cast<sc_uint32>(SectionId::Elements), elements);
+  WriteSection(buffer, static_cast<sc_uint32>(SectionId::SystemIdentifiers), systemIdentifiers);
+  WriteSection(buffer, static_cast<sc_uint32>(SectionId::LinksContents), linksContents);
+
+  std::ofstream file(filePath, std::ios::binary | std::ios::trunc);
+  if (!file.is_open() || !file.write(buffer.data(), static_cast<std::streamsize>(buffer.size())))
+    SC_THROW_EXCEPTION(utils::ExceptionInvalidState, "Can't write knowledge base image into file " << filePath);
+}
+
+void ScKBImage::Load(std::string const & filePath)
+{
+  Clear();
+
+  // image is read by one sequential read and parsed in memory
+  std::ifstream file(filePath, std::ios::binary);
+  if (!file.is_open())
+    SC_THROW_EXCEPTION(utils::ExceptionInvalidState, "Can't open knowledge base image file " << filePath);
+  std::string const buffer{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+
+  Reader reader{buffer};
+  if (reader.Read(FILE_MAGIC.size()) != FILE_MAGIC)
+    SC_THROW_EXCEPTION(utils::ExceptionInvalidState, "File " << filePath << " isn't a knowledge base image.");
+
+  sc_uint32 const version = reader.ReadNumber<sc_uint32>();
+  if (version != VERSION)
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState,
+        "Knowledge base image " << filePath << " has version " << version << ", but version " << VERSION
+                                << " is supported only.");
+
+  sc_uint32 const sectionsNum = reader.ReadNumber<sc_uint32>();
+  std::unordered_map<sc_uint32, std::string_view> sections;
+  for (sc_uint32 i = 0; i < sectionsNum; ++i)
+  {
+    sc_uint32 const id = reader.ReadNumber<sc_uint32>();
+    sc_uint64 const size = reader.ReadNumber<sc_uint64>();
+    sc_uint64 const checksum = reader.ReadNumber<sc_uint64>();
+    std::string_view const & payload = reader.Read(size);
+    if (CalculateChecksum(payload) != checksum)
+      SC_THROW_EXCEPTION(
+          utils::ExceptionInvalidState,
+          "Section " << id << " of knowledge base image " << filePath << " is corrupted.");
+
+    // unknown sections are skipped to load images with additional sections
+    sections[id] = payload;
+  }
+
+  Reader elementsReader{sections[static_cast<sc_uint32>(SectionId::Elements)]};
+  sc_uint64 const elementsNum = elementsReader.ReadNumber<sc_uint64>();
+  m_elements.reserve(std::min<sc_uint64>(elementsNum, buffer.size()));
+  for (sc_uint64 index = 0; index < elementsNum; ++index)
+  {
+    Element element;
+    element.m_kind = static_cast<ElementKind>(elementsReader.ReadNumber<sc_uint8>());
+    element.m_type = ScType(elementsReader.ReadNumber<sc_uint16>());
+    element.m_source = elementsReader.ReadNumber<sc_uint32>();
+    element.m_target = elementsReader.ReadNumber<sc_uint32>();
+
+    // sc-elements are checked to be loaded in one pass
+    bool isValid;
+    switch (element.m_kind)
+    {
+    case ElementKind::Node:
+    case ElementKind::External:
+      isValid = !element.m_type.IsConnector();
+      break;
+    case ElementKind::Connector:
+      isValid = element.m_type.IsConnector() && element.m_source < index && element.m_target < index;
+      break;
+    case ElementKind::SystemIdentifierLink:
+    case ElementKind::SystemIdentifierArc:
+    case ElementKind::SystemIdentifierRelationArc:
+      isValid = element.m_source + GetSystemIdentifierPartOffset(element.m_kind) == index;
+      break;
+    default:
+      isValid = false;
+    }
+
+    if (!isValid)
+      SC_THROW_EXCEPTION(
+          utils::ExceptionInvalidState,
+          "Sc-element " << index << " of knowledge base image " << filePath << " is invalid.");
+
+    m_elements.push_back(element);
+  }
+
+  Reader systemIdentifiersReader{sections[static_cast<sc_uint32>(SectionId::SystemIdentifiers)]};
+  ReadStrings(systemIdentifiersReader, m_elements.size(), m_systemIdentifiers);
+  for (auto const & [index, systemIdentifier] : m_systemIdentifiers)
+    m_systemIdentifiersToElements[systemIdentifier] = index;
+
+  for (sc_uint32 index = 0; index < m_elements.size(); ++index)
+  {
+    Element const & element = m_elements[index];
+    sc_uint32 const identifiedIndex = IsSystemIdentifierPart(element.m_kind) ? element.m_source : index;
+    bool const isIdentified = m_systemIdentifiers.find(identifiedIndex) != m_systemIdentifiers.cend();
+    if ((element.m_kind == ElementKind::External || IsSystemIdentifierPart(element.m_kind)) && !isIdentified)
+      SC_THROW_EXCEPTION(
+          utils::ExceptionInvalidState,
+          "Sc-element " << index << " of knowledge base image " << filePath << " has no system identifier.");
+  }
+
+  Reader linksContentsReader{sections[static_cast<sc_uint32>(SectionId::LinksContents)]};
+  ReadStrings(linksContentsReader, m_elements.size(), m_linksContents);
+
+  if (!reader.IsEnd() || !elementsReader.IsEnd() || !systemIdentifiersReader.IsEnd() || !linksContentsReader.IsEnd())
+    SC_THROW_EXCEPTION(utils::ExceptionInvalidState, "Knowledge base image " << filePath << " has unexpected data.");
+}
+
+std::vector<ScKBImage::Element> const & ScKBImage::GetElements() const
+{
+  return m_elements;
+}
+
+std::string ScKBImage::GetSystemIdentifier(sc_uint32 index) const
+{
+  auto const it = m_systemIdentifiers.find(index);
+  return it == m_systemIdentifiers.cend() ? "" : it->second;
+}
+
+std::string ScKBImage::GetLinkContent(sc_uint32 index) const
+{
+  auto const it = m_linksContents.find(index);
+  return it == m_linksContents.cend() ? "" : it->second;
+}
+
+sc_uint32 ScKBImage::AppendElement(ElementKind kind, ScType const & type, sc_uint32 source, sc_uint32 target)
+{
+  sc_uint32 const index = static_cast<sc_uint32>(m_elements.size());
+  m_elements.push_back({kind, type, source, target});
+  return index;
+}
+
+sc_uint32 ScKBImage::AppendIdentifiedElement(
+    ElementKind kind,
+    ScType const & type,
+    std::string const & systemIdentifier)
+{
+  sc_uint32 const index = AppendElement(kind, type);
+  m_systemIdentifiers[index] = systemIdentifier;
+  m_systemIdentifiersToElements[systemIdentifier] = index;
+  return index;
+}
+
+void ScKBImage::Clear()
+{
+  m_elements.clear();
+  m_systemIdentifiers.clear();
+  m_linksContents.clear();
+  m_systemIdentifiersToElements.clear();
+}
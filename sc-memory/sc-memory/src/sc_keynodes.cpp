@@ -10,6 +10,24 @@
 
 #include "sc-memory/sc_structure.hpp"
 
+namespace
+{
+
+void AppendQuintupleToContextStructure(ScMemoryContext * context, ScSystemIdentifierQuintuple const & quintuple)
+{
+  ScAddr const & contextStructureAddr = context->GetContextStructure();
+  if (!context->IsElement(contextStructureAddr))
+    return;
+
+  for (ScAddr const & addr : {quintuple.addr1, quintuple.addr2, quintuple.addr3, quintuple.addr4})
+  {
+    if (!context->CheckConnector(contextStructureAddr, addr, ScType::ConstPermPosArc))
+      context->GenerateConnector(ScType::ConstPermPosArc, contextStructureAddr, addr);
+  }
+}
+
+}  // namespace
+
 void internal::ScKeynodesRegister::Remember(ScKeynode * keynode)
 {
   m_notInitializedKeynodes.push_back(keynode);
@@ -23,7 +41,31 @@ void internal::ScKeynodesRegister::Forget(ScKeynode * keynode)
 
 void internal::ScKeynodesRegister::Register(ScMemoryContext * context)
 {
+  // keynodes with own initialization are initialized after other keynodes, because they may use them
+  std::vector<ScKeynode *> keynodes;
+  std::vector<ScKeynode *> otherKeynodes;
+  std::vector<std::pair<std::string, ScType>> systemIdentifiers;
   for (auto * keynode : m_notInitializedKeynodes)
+  {
+    if (!keynode->IsBatchResolvable())
+    {
+      otherKeynodes.push_back(keynode);
+      continue;
+    }
+
+    keynodes.push_back(keynode);
+    systemIdentifiers.emplace_back(keynode->m_sysIdtf, keynode->m_type);
+  }
+
+  std::vector<ScSystemIdentifierQuintuple> const & quintuples =
+      context->ResolveElementsSystemIdentifiers(systemIdentifiers);
+  for (size_t i = 0; i < keynodes.size(); ++i)
+  {
+    keynodes[i]->m_realAddr = quintuples[i].addr1.GetRealAddr();
+    AppendQuintupleToContextStructure(context, quintuples[i]);
+  }
+
+  for (auto * keynode : otherKeynodes)
     keynode->Initialize(context);
 
   m_initializedKeynodes.splice(m_initializedKeynodes.cend(), m_notInitializedKeynodes);
@@ -60,24 +102,16 @@ std::ostream & operator<<(std::ostream & os, ScKeynode const & keynode)
 
 void ScKeynode::Initialize(ScMemoryContext * context)
 {
-  ScAddr const & contextStructureAddr = context->GetContextStructure();
-  auto const & AppendToContextStructure = [&](ScAddr const & addr)
-  {
-    if (!context->CheckConnector(contextStructureAddr, addr, ScType::ConstPermPosArc))
-      context->GenerateConnector(ScType::ConstPermPosArc, contextStructureAddr, addr);
-  };
-
   ScSystemIdentifierQuintuple quintuple;
   context->ResolveElementSystemIdentifier(std::string(m_sysIdtf), m_type, quintuple);
   this->m_realAddr = quintuple.addr1.GetRealAddr();
 
-  if (context->IsElement(contextStructureAddr))
-  {
-    AppendToContextStructure(quintuple.addr1);
-    AppendToContextStructure(quintuple.addr2);
-    AppendToContextStructure(quintuple.addr3);
-    AppendToContextStructure(quintuple.addr4);
-  }
+  AppendQuintupleToContextStructure(context, quintuple);
+}
+
+bool ScKeynode::IsBatchResolvable() const
+{
+  return true;
 }
 
 ScTemplateKeynode::ScTemplateKeynode(std::string_view const & sysIdtf) noexcept
@@ -102,13 +136,6 @@ void ScTemplateKeynode::Initialize(ScMemoryContext * context)
 {
   this->Clear();
 
-  ScAddr const & contextStructureAddr = context->GetContextStructure();
-  auto const & AppendToContextStructure = [&](ScAddr const & addr)
-  {
-    if (!context->CheckConnector(contextStructureAddr, addr, ScType::ConstPermPosArc))
-      context->GenerateConnector(ScType::ConstPermPosArc, contextStructureAddr, addr);
-  };
-
   ScSystemIdentifierQuintuple quintuple;
   std::string const & sysIdtf = std::string(m_sysIdtf);
   if (!context->SearchElementBySystemIdentifier(sysIdtf, quintuple))
@@ -125,13 +152,12 @@ void ScTemplateKeynode::Initialize(ScMemoryContext * context)
     context->BuildTemplate(*this, *this);
   }
 
-  if (context->IsElement(contextStructureAddr))
-  {
-    AppendToContextStructure(quintuple.addr1);
-    AppendToContextStructure(quintuple.addr2);
-    AppendToContextStructure(quintuple.addr3);
-    AppendToContextStructure(quintuple.addr4);
-  }
+  AppendQuintupleToContextStructure(context, quintuple);
+}
+
+bool ScTemplateKeynode::IsBatchResolvable() const
+{
+  return false;
 }
 
 size_t const kKeynodeRrelListNum = 20;
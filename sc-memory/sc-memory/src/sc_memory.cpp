@@ -6,6 +6,9 @@
 
 #include "sc-memory/sc_memory.hpp"
 
+#include <algorithm>
+#include <numeric>
+
 #include "sc-memory/sc_keynodes.hpp"
 #include "sc-memory/sc_utils.hpp"
 #include "sc-memory/sc_stream.hpp"
@@ -342,6 +345,40 @@ bool ScMemoryContext::EraseElement(ScAddr const & elementAddr)
   return result == SC_RESULT_OK;
 }
 
+bool ScMemoryContext::EraseElements(ScAddrVector const & elementAddrs)
+{
+  CHECK_CONTEXT;
+
+  std::vector<sc_addr> addrs;
+  addrs.reserve(elementAddrs.size());
+  for (ScAddr const & elementAddr : elementAddrs)
+    addrs.push_back(*elementAddr);
+
+  sc_result const result = sc_memory_elements_free(m_context, addrs.data(), static_cast<sc_uint32>(addrs.size()));
+
+  switch (result)
+  {
+  case SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED:
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState, "Not able to erase sc-elements because sc-memory context is not authorized.");
+
+  case SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_ERASE_PERMISSIONS:
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState,
+        "Not able to erase sc-elements because sc-memory context hasn't erase permissions.");
+
+  case SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_PERMISSIONS_TO_ERASE_PERMISSIONS:
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState,
+        "Not able to erase sc-elements because sc-memory context hasn't permissions to erase permissions.");
+
+  default:
+    break;
+  }
+
+  return result == SC_RESULT_OK;
+}
+
 ScAddr ScMemoryContext::GenerateNode(ScType const & nodeType)
 {
   CHECK_CONTEXT;
@@ -951,6 +988,12 @@ std::vector<std::string> ScMemoryContext::FindLinksContentsByContentSubstring(
   return {linkContentSet.cbegin(), linkContentSet.cend()};
 }
 
+ScElementsIteratorPtr ScMemoryContext::CreateElementsIterator(ScType const & elementType)
+{
+  CHECK_CONTEXT;
+  return ScElementsIteratorPtr(new ScElementsIterator(*this, elementType));
+}
+
 bool ScMemoryContext::CheckConnector(
     ScAddr const & sourcElementAddr,
     ScAddr const & targetElementAddr,
@@ -1026,6 +1069,60 @@ bool ScMemoryContext::ResolveElementSystemIdentifier(
   return result;
 }
 
+std::vector<ScSystemIdentifierQuintuple> ScMemoryContext::ResolveElementsSystemIdentifiers(
+    std::vector<std::pair<std::string, ScType>> const & systemIdentifiers)
+{
+  CHECK_CONTEXT;
+
+  // stable sort keeps the first specified sc-type of each system identifier first
+  std::vector<size_t> order(systemIdentifiers.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(
+      order.begin(),
+      order.end(),
+      [&](size_t left, size_t right)
+      {
+        return systemIdentifiers[left].first < systemIdentifiers[right].first;
+      });
+
+  std::vector<ScSystemIdentifierQuintuple> quintuples(systemIdentifiers.size());
+  std::vector<size_t> notFoundIndices;
+  for (size_t i = 0; i < order.size(); ++i)
+  {
+    size_t const index = order[i];
+    if (i > 0 && systemIdentifiers[order[i - 1]].first == systemIdentifiers[index].first)
+      continue;
+
+    if (!SearchElementBySystemIdentifier(systemIdentifiers[index].first, quintuples[index])
+        && !systemIdentifiers[index].second.IsUnknown())
+      notFoundIndices.push_back(index);
+  }
+
+  if (!notFoundIndices.empty())
+  {
+    ScMemoryContextDeferredLinksIndexingGuard guard(*this);
+    for (size_t const index : notFoundIndices)
+    {
+      auto const & [systemIdentifier, elementType] = systemIdentifiers[index];
+      ScAddr const & elementAddr = GenerateNode(elementType);
+      if (!SetElementSystemIdentifier(systemIdentifier, elementAddr, quintuples[index]))
+      {
+        EraseElement(elementAddr);
+        quintuples[index] =
+            (ScSystemIdentifierQuintuple){ScAddr::Empty, ScAddr::Empty, ScAddr::Empty, ScAddr::Empty, ScAddr::Empty};
+      }
+    }
+  }
+
+  for (size_t i = 1; i < order.size(); ++i)
+  {
+    if (systemIdentifiers[order[i - 1]].first == systemIdentifiers[order[i]].first)
+      quintuples[order[i]] = quintuples[order[i - 1]];
+  }
+
+  return quintuples;
+}
+
 bool ScMemoryContext::HelperResolveSystemIdtf(
     std::string const & systemIdentifier,
     ScType const & elementType,
@@ -1420,4 +1517,48 @@ bool ScMemoryContext::Save()
   return result == SC_RESULT_OK;
 }
 
+void ScMemoryContext::BeginDeferredLinksIndexing()
+{
+  CHECK_CONTEXT;
+  sc_result const result = sc_memory_deferred_indexing_begin(m_context);
+  switch (result)
+  {
+  case SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED:
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState,
+        "Not able to begin deferred sc-links indexing because sc-memory context is not authorized.");
+
+  case SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_WRITE_PERMISSIONS:
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState,
+        "Not able to begin deferred sc-links indexing because sc-memory context hasn't write permissions.");
+
+  default:
+    break;
+  }
+}
+
+bool ScMemoryContext::EndDeferredLinksIndexing()
+{
+  CHECK_CONTEXT;
+  sc_result const result = sc_memory_deferred_indexing_end(m_context);
+  switch (result)
+  {
+  case SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED:
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState,
+        "Not able to end deferred sc-links indexing because sc-memory context is not authorized.");
+
+  case SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_WRITE_PERMISSIONS:
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState,
+        "Not able to end deferred sc-links indexing because sc-memory context hasn't write permissions.");
+
+  default:
+    break;
+  }
+
+  return result == SC_RESULT_OK;
+}
+
 SC_PRAGMA_DISABLE_DEPRECATION_WARNINGS_END
@@ -24,10 +24,17 @@ class StructGenerator
   friend class ::SCsHelper;
 
 protected:
-  StructGenerator(ScMemoryContext & ctx, SCsFileInterfacePtr fileInterface, ScAddr const & outputStructure)
+  StructGenerator(
+      ScMemoryContext & ctx,
+      SCsFileInterfacePtr fileInterface,
+      SCsIdentifiersCache * identifiersCache,
+      ScAddr const & outputStructure,
+      ScAddrVector * generatedElements = nullptr)
     : m_ctx(ctx)
     , m_fileInterface(std::move(fileInterface))
+    , m_identifiersCache(identifiersCache)
     , m_outputStructure(outputStructure)
+    , m_generatedElements(generatedElements)
   {
   }
 
@@ -61,6 +68,7 @@ protected:
                                                      << std::string(connectorType) << "`.");
 
           ScAddr const connectorAddr = m_ctx.GenerateConnector(connectorType, sourceResult.first, targetResult.first);
+          AppendToGeneratedElements(connectorAddr);
           m_idtfCache.insert({connectorIdtf, connectorAddr});
 
           if (m_outputStructure.IsValid())
@@ -87,10 +95,17 @@ private:
     for (ScAddr const & addr : addrVector)
     {
       if (!m_ctx.CheckConnector(m_outputStructure, addr, ScType::ConstPermPosArc))
-        m_ctx.GenerateConnector(ScType::ConstPermPosArc, m_outputStructure, addr);
+        AppendToGeneratedElements(m_ctx.GenerateConnector(ScType::ConstPermPosArc, m_outputStructure, addr));
     }
   }
 
+  template <class... Args>
+  void AppendToGeneratedElements(Args const &... addrs)
+  {
+    if (m_generatedElements != nullptr)
+      m_generatedElements->insert(m_generatedElements->end(), {addrs...});
+  }
+
   ScAddrVector SetSCsGlobalIdtf(std::string const & idtf, ScAddr const & addr)
   {
     // Generate construction manually. To avoid recursive call of ScMemoryContextEventsPendingGuard
@@ -100,6 +115,7 @@ private:
 
     ScAddr const arcAddr = m_ctx.GenerateConnector(ScType::ConstCommonArc, addr, linkAddr);
     ScAddr const relAddr = m_ctx.GenerateConnector(ScType::ConstPermPosArc, ScKeynodes::nrel_scs_global_idtf, arcAddr);
+    AppendToGeneratedElements(linkAddr, arcAddr, relAddr);
 
     return {linkAddr, arcAddr, relAddr};
   }
@@ -134,6 +150,49 @@ private:
     return result;
   }
 
+  ScAddr FindByIdentifier(scs::ParsedElement const & el, ScAddrVector & identifierElements) const
+  {
+    std::string const & idtf = el.GetIdtf();
+    bool const isSystem = el.GetVisibility() == scs::Visibility::System;
+    if (m_identifiersCache != nullptr)
+    {
+      auto const & elements =
+          isSystem ? m_identifiersCache->m_systemIdentifiers : m_identifiersCache->m_globalIdentifiers;
+      auto const it = elements.find(idtf);
+      if (it != elements.cend())
+      {
+        identifierElements = it->second.m_identifierElements;
+        return it->second.m_addr;
+      }
+
+      // sc-elements with global identifiers are generated only by SCsHelper, so loaded cache contains all of them
+      if (!isSystem && m_identifiersCache->m_isLoaded)
+        return ScAddr::Empty;
+    }
+
+    if (!isSystem)
+      return FindBySCsGlobalIdtf(idtf);
+
+    ScSystemIdentifierQuintuple quintuple;
+    m_ctx.SearchElementBySystemIdentifier(idtf, quintuple);
+    identifierElements = {quintuple.addr2, quintuple.addr3, quintuple.addr4, quintuple.addr5};
+    return quintuple.addr1;
+  }
+
+  void AppendToIdentifiersCache(
+      scs::ParsedElement const & el,
+      ScAddr const & addr,
+      ScAddrVector const & identifierElements)
+  {
+    if (m_identifiersCache == nullptr)
+      return;
+
+    if (el.GetVisibility() == scs::Visibility::System)
+      m_identifiersCache->m_systemIdentifiers.insert({el.GetIdtf(), {addr, identifierElements}});
+    else if (el.GetVisibility() == scs::Visibility::Global)
+      m_identifiersCache->m_globalIdentifiers.insert({el.GetIdtf(), {addr, {}}});
+  }
+
   std::pair<ScAddr, ScAddrVector> ResolveElement(scs::ParsedElement const & el)
   {
     ScAddrVector result;
@@ -145,15 +204,8 @@ private:
     else
     {
       // try to find existing
-      if (el.GetVisibility() == scs::Visibility::System)
-      {
-        ScSystemIdentifierQuintuple quintuple;
-        m_ctx.SearchElementBySystemIdentifier(el.GetIdtf(), quintuple);
-        resultAddr = quintuple.addr1;
-        result = {quintuple.addr2, quintuple.addr3, quintuple.addr4, quintuple.addr5};
-      }
-      else if (el.GetVisibility() == scs::Visibility::Global)
-        resultAddr = FindBySCsGlobalIdtf(el.GetIdtf());
+      if (el.GetVisibility() == scs::Visibility::System || el.GetVisibility() == scs::Visibility::Global)
+        resultAddr = FindByIdentifier(el, result);
 
       // generate new one
       if (!resultAddr.IsValid())
@@ -172,6 +224,7 @@ private:
           }
           else
             resultAddr = m_ctx.GenerateNode(type);
+          AppendToGeneratedElements(resultAddr);
         }
         else
           SC_THROW_EXCEPTION(
@@ -185,6 +238,7 @@ private:
           ScSystemIdentifierQuintuple quintuple;
           m_ctx.SetElementSystemIdentifier(el.GetIdtf(), resultAddr, quintuple);
           result = {quintuple.addr2, quintuple.addr3, quintuple.addr4, quintuple.addr5};
+          AppendToGeneratedElements(quintuple.addr2, quintuple.addr3, quintuple.addr4);
         }
         else if (el.GetVisibility() == scs::Visibility::Global)
           result = SetSCsGlobalIdtf(el.GetIdtf(), resultAddr);
@@ -207,6 +261,7 @@ private:
 
       // anyway save in cache
       m_idtfCache.insert({idtf, resultAddr});
+      AppendToIdentifiersCache(el, resultAddr, result);
     }
 
     return {resultAddr, result};
@@ -291,17 +346,72 @@ private:
 private:
   ScMemoryContext & m_ctx;
   SCsFileInterfacePtr m_fileInterface;
+  SCsIdentifiersCache * m_identifiersCache;
   ScAddr m_outputStructure;
+  ScAddrVector * m_generatedElements;
 
   std::unordered_map<std::string, ScAddr> m_idtfCache;
 };
 
 }  // namespace impl
 
-SCsHelper::SCsHelper(ScMemoryContext & ctx, SCsFileInterfacePtr fileInterface)
+void SCsIdentifiersCache::Load(ScMemoryContext & ctx)
+{
+  Clear();
+
+  std::string identifier;
+  ScIterator3Ptr const systemIdentifiersIt =
+      ctx.CreateIterator3(ScKeynodes::nrel_system_identifier, ScType::ConstPermPosArc, ScType::ConstCommonArc);
+  while (systemIdentifiersIt->Next())
+  {
+    ScAddr const & arcAddr = systemIdentifiersIt->Get(2);
+    auto const [elementAddr, linkAddr] = ctx.GetConnectorIncidentElements(arcAddr);
+    if (!ctx.GetElementType(linkAddr).IsLink() || !ctx.GetLinkContent(linkAddr, identifier))
+      continue;
+
+    m_systemIdentifiers.insert(
+        {identifier,
+         {elementAddr, {linkAddr, arcAddr, systemIdentifiersIt->Get(1), ScKeynodes::nrel_system_identifier}}});
+  }
+
+  ScIterator3Ptr const globalIdentifiersIt =
+      ctx.CreateIterator3(ScKeynodes::nrel_scs_global_idtf, ScType::ConstPermPosArc, ScType::ConstCommonArc);
+  while (globalIdentifiersIt->Next())
+  {
+    auto const [elementAddr, linkAddr] = ctx.GetConnectorIncidentElements(globalIdentifiersIt->Get(2));
+    if (!ctx.GetElementType(linkAddr).IsLink() || !ctx.GetLinkContent(linkAddr, identifier))
+      continue;
+
+    m_globalIdentifiers.insert({identifier, {elementAddr, {}}});
+  }
+
+  m_isLoaded = true;
+}
+
+void SCsIdentifiersCache::Clear()
+{
+  m_systemIdentifiers.clear();
+  m_globalIdentifiers.clear();
+  m_isLoaded = false;
+}
+
+size_t SCsIdentifiersCache::GetSystemIdentifiersNum() const
+{
+  return m_systemIdentifiers.size();
+}
+
+size_t SCsIdentifiersCache::GetGlobalIdentifiersNum() const
+{
+  return m_globalIdentifiers.size();
+}
+
+SCsHelper::SCsHelper(
+    ScMemoryContext & ctx,
+    SCsFileInterfacePtr fileInterface,
+    SCsIdentifiersCachePtr identifiersCache)
   : m_ctx(ctx)
   , m_fileInterface(std::move(fileInterface))
-
+  , m_identifiersCache(std::move(identifiersCache))
 {
 }
 
@@ -322,7 +432,7 @@ bool SCsHelper::GenerateBySCsText(std::string const & scsText, ScAddr const & ou
     }
     else
     {
-      impl::StructGenerator generate(m_ctx, m_fileInterface, outputStructure);
+      impl::StructGenerator generate(m_ctx, m_fileInterface, m_identifiersCache.get(), outputStructure);
       generate(parser);
     }
   }
@@ -344,11 +454,53 @@ void SCsHelper::GenerateBySCsTextLazy(std::string const & scsText, ScAddr const
     SC_THROW_EXCEPTION(utils::ExceptionParseError, parser.GetParseError());
   else
   {
-    impl::StructGenerator generate(m_ctx, m_fileInterface, outputStructure);
+    impl::StructGenerator generate(m_ctx, m_fileInterface, m_identifiersCache.get(), outputStructure);
     generate(parser);
   }
 }
 
+bool SCsHelper::GenerateByParsedSCs(scs::Parser const & parser, ScAddr const & outputStructure)
+{
+  return GenerateByParsedSCs(parser, outputStructure, nullptr);
+}
+
+bool SCsHelper::GenerateByParsedSCs(
+    scs::Parser const & parser,
+    ScAddr const & outputStructure,
+    ScAddrVector & generatedElements)
+{
+  return GenerateByParsedSCs(parser, outputStructure, &generatedElements);
+}
+
+bool SCsHelper::GenerateByParsedSCs(
+    scs::Parser const & parser,
+    ScAddr const & outputStructure,
+    ScAddrVector * generatedElements)
+{
+  m_lastError = "";
+  bool result = true;
+
+  ScMemoryContextEventsPendingGuard guard(m_ctx);
+
+  try
+  {
+    impl::StructGenerator generate(
+        m_ctx,
+        m_fileInterface,
+        m_identifiersCache.get(),
+        outputStructure,
+        generatedElements);
+    generate(parser);
+  }
+  catch (utils::ScException const & ex)
+  {
+    m_lastError = ex.Description();
+    result = false;
+  }
+
+  return result;
+}
+
 std::string const & SCsHelper::GetLastError() const
 {
   return m_lastError;
@@ -77,5 +77,5 @@ ScSet & ScSet::operator>>(ScAddr const & elAddr)
 bool ScSet::IsEmpty() const
 {
   ScIterator3Ptr const iter = m_context->CreateIterator3(*this, ScType::ConstPermPosArc, ScType::Unknown);
-  return !iter->Next();
+  return iter->Count(1) == 0;
 }
@@ -431,6 +431,26 @@ ScTemplate & ScTemplate::Quintuple(
   return *this;
 }
 
+void ScTemplate::Substitute(ScTemplateParams const & params, ScTemplate & resultTemplate) const noexcept(false)
+{
+  if (!resultTemplate.IsEmpty())
+    SC_THROW_EXCEPTION(utils::ExceptionInvalidParams, "Sc-template to substitute parameters into must be empty");
+
+  ScAddr value;
+  for (ScTemplateTriple const * triple : m_templateTriples)
+  {
+    std::array<ScTemplateItem, 3> values = triple->m_values;
+    for (ScTemplateItem & item : values)
+    {
+      // Replacements of substituted sc-variables are resolved by `Triple` itself
+      if (item.IsAssign() && item.HasName() && params.Get(item.m_name, value))
+        item.SetAddr(value, item.m_name.c_str());
+    }
+
+    resultTemplate.Triple(values[0], values[1], values[2]);
+  }
+}
+
 ScTemplate::ScTemplateTripleType ScTemplate::GetPriority(ScTemplateTriple * triple)
 {
   ScTemplateItem const & item1 = triple->m_values[0];
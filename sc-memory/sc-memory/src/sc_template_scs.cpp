@@ -6,11 +6,16 @@
 
 #include "sc-memory/sc_template.hpp"
 
+#include <array>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+
 #include "sc-memory/sc_memory.hpp"
 
 #include "sc-memory/scs/scs_parser.hpp"
 
-#include "sc-memory/utils/sc_keynode_cache.hpp"
+#include "sc-memory/utils/sc_cache.hpp"
 
 class ScTemplateBuilderFromScs
 {
@@ -18,69 +23,165 @@ public:
   ScTemplateBuilderFromScs(std::string const & translatableSCsTemplate, ScMemoryContext & ctx)
     : m_translatableSCsTemplate(translatableSCsTemplate)
     , m_ctx(ctx)
-    , m_parser()
   {
   }
 
   void operator()(ScTemplate * templ)
   {
-    if (!m_parser.Parse(m_translatableSCsTemplate))
-      SC_THROW_EXCEPTION(utils::ExceptionParseError, m_parser.GetParseError());
+    std::shared_ptr<Triples const> triples = FindTriples(m_translatableSCsTemplate);
+    if (triples == nullptr)
+    {
+      triples = Parse(m_translatableSCsTemplate);
+      SaveTriples(m_translatableSCsTemplate, triples);
+    }
 
-    BuildImpl(templ);
+    // sc-elements are resolved by each build, because they should be checked by permissions of sc-memory context and
+    // they may be changed by other sc-memory contexts since the previous build
+    BuildImpl(templ, *triples, Resolve(*triples));
   }
 
 protected:
-  void BuildImpl(ScTemplate * templ) const
+  //! Item of parsed SCs-template. It doesn't depend on sc-memory state.
+  struct Item
+  {
+    std::string m_idtf;
+    ScType m_type;
+    bool m_isUnnamed;
+    //! Item is replacement of the first item with the same identifier
+    bool m_isReplacement;
+    //! Index of sc-address resolved by item identifier, it is valid if item isn't replacement
+    size_t m_keynodeIndex;
+  };
+
+  struct Triples
+  {
+    std::vector<std::array<Item, 3>> m_items;
+    //! Unique identifiers of items which aren't replacements
+    std::vector<std::string> m_keynodesIdtfs;
+  };
+
+  //! Pow of two for number of parsed SCs-templates cached by all sc-memory contexts
+  static uint32_t const LOG_TRANSLATIONS_CACHE_SIZE = 10;
+
+  static std::mutex & GetTranslationsMutex()
   {
-    utils::ScKeynodeCache keynodes(m_ctx);
+    static std::mutex mutex;
+    return mutex;
+  }
+
+  static utils::Cache<std::string, std::shared_ptr<Triples const>> & GetTranslations()
+  {
+    static utils::Cache<std::string, std::shared_ptr<Triples const>> translations(LOG_TRANSLATIONS_CACHE_SIZE);
+    return translations;
+  }
+
+  static std::shared_ptr<Triples const> FindTriples(std::string const & translatableSCsTemplate)
+  {
+    std::lock_guard<std::mutex> lock(GetTranslationsMutex());
+    bool found = false;
+    std::shared_ptr<Triples const> & triples = GetTranslations().Find(translatableSCsTemplate, found);
+    // value of evicted translation is reused by cache for specified template, so it should be reset
+    if (!found)
+      triples = nullptr;
+    return triples;
+  }
+
+  static void SaveTriples(std::string const & translatableSCsTemplate, std::shared_ptr<Triples const> const & triples)
+  {
+    std::lock_guard<std::mutex> lock(GetTranslationsMutex());
+    bool found = false;
+    GetTranslations().Find(translatableSCsTemplate, found) = triples;
+  }
+
+  static std::shared_ptr<Triples const> Parse(std::string const & translatableSCsTemplate)
+  {
+    scs::Parser parser;
+    if (!parser.Parse(translatableSCsTemplate))
+      SC_THROW_EXCEPTION(utils::ExceptionParseError, parser.GetParseError());
+
+    auto triples = std::make_shared<Triples>();
     std::unordered_set<std::string> passed;
+    std::unordered_map<std::string, size_t> keynodesIndices;
 
-    auto const MakeTemplItem = [&passed, &keynodes](scs::ParsedElement const & el, ScTemplateItem & outValue) -> void
+    auto const MakeItem = [&](scs::ParsedElement const & el) -> Item
     {
       std::string const & idtf = el.GetIdtf();
       bool const isUnnamed = scs::TypeResolver::IsUnnamed(idtf);
-      bool const isPassed = passed.find(idtf) != passed.cend();
+      bool const isReplacement = !isUnnamed && passed.find(idtf) != passed.cend();
+      passed.insert(idtf);
 
-      if (!isUnnamed && isPassed)
-        outValue.SetReplacement(idtf.c_str());
-      else
+      Item item{idtf, el.GetType(), isUnnamed, isReplacement, 0};
+      if (!isReplacement)
       {
-        sc_char const * alias = isUnnamed ? nullptr : idtf.c_str();
-        ScAddr const addr = keynodes.GetKeynode(idtf);
-        if (addr.IsValid())
-          outValue.SetAddr(addr, alias);
-        else if (el.GetType().IsVar())
-          outValue.SetType(el.GetType(), alias);
-        else
-          SC_THROW_EXCEPTION(
-              utils::ExceptionInvalidState,
-              "Specified element with system identifier `" << idtf << "` can't be found.");
+        auto const it = keynodesIndices.insert({idtf, triples->m_keynodesIdtfs.size()});
+        if (it.second)
+          triples->m_keynodesIdtfs.push_back(idtf);
+        item.m_keynodeIndex = it.first->second;
       }
-
-      passed.insert(idtf);
+      return item;
     };
 
-    m_parser.ForEachTripleForGeneration(
+    parser.ForEachTripleForGeneration(
         [&](scs::ParsedElement const & source,
             scs::ParsedElement const & connector,
             scs::ParsedElement const & target) -> void
         {
-          ScTemplateItem sourceItem, connectorItem, targetItem;
+          // items are made in order of triple elements, it is order of their identifiers passing
+          Item sourceItem = MakeItem(source);
+          Item connectorItem = MakeItem(connector);
+          Item targetItem = MakeItem(target);
+          triples->m_items.push_back({std::move(sourceItem), std::move(connectorItem), std::move(targetItem)});
+        });
 
-          MakeTemplItem(source, sourceItem);
-          MakeTemplItem(connector, connectorItem);
-          MakeTemplItem(target, targetItem);
+    return triples;
+  }
 
-          templ->Triple(sourceItem, connectorItem, targetItem);
-        });
+  ScAddrVector Resolve(Triples const & triples) const
+  {
+    ScAddrVector keynodes;
+    keynodes.reserve(triples.m_keynodesIdtfs.size());
+    for (std::string const & idtf : triples.m_keynodesIdtfs)
+      keynodes.push_back(m_ctx.ResolveElementSystemIdentifier(idtf));
+    return keynodes;
+  }
+
+  static void BuildImpl(ScTemplate * templ, Triples const & triples, ScAddrVector const & keynodes)
+  {
+    auto const MakeTemplItem = [&keynodes](Item const & item, ScTemplateItem & outValue) -> void
+    {
+      if (item.m_isReplacement)
+      {
+        outValue.SetReplacement(item.m_idtf.c_str());
+        return;
+      }
+
+      sc_char const * alias = item.m_isUnnamed ? nullptr : item.m_idtf.c_str();
+      ScAddr const & addr = keynodes[item.m_keynodeIndex];
+      if (addr.IsValid())
+        outValue.SetAddr(addr, alias);
+      else if (item.m_type.IsVar())
+        outValue.SetType(item.m_type, alias);
+      else
+        SC_THROW_EXCEPTION(
+            utils::ExceptionInvalidState,
+            "Specified element with system identifier `" << item.m_idtf << "` can't be found.");
+    };
+
+    for (auto const & triple : triples.m_items)
+    {
+      ScTemplateItem sourceItem, connectorItem, targetItem;
+
+      MakeTemplItem(triple[0], sourceItem);
+      MakeTemplItem(triple[1], connectorItem);
+      MakeTemplItem(triple[2], targetItem);
+
+      templ->Triple(sourceItem, connectorItem, targetItem);
+    }
   }
 
 private:
   std::string const & m_translatableSCsTemplate;
   ScMemoryContext & m_ctx;
-
-  scs::Parser m_parser;
 };
 
 void ScTemplate::TranslateFrom(ScMemoryContext & ctx, std::string const & translatableSCsTemplate)
@@ -0,0 +1,764 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "scs_fast_parser.hpp"
+
+#include <algorithm>
+#include <string_view>
+#include <unordered_set>
+
+#include "sc-memory/sc_debug.hpp"
+
+namespace
+{
+
+// Connectors of SCs-grammar. Connectors `<` and `>` also denote begin and end of sc.s-vectors, but sc.s-vector begins
+// at place of sc.s-element, where connector isn't expected, so parser stops at it.
+std::unordered_set<std::string_view> const CONNECTORS = {
+    "?<=>",
+    "?=>",
+    "<=?",
+    "<=>",
+    "_<=>",
+    "=>",
+    "<=",
+    "_=>",
+    "<=_",
+    "?.?>",
+    "<?.?",
+    "..?>",
+    "<?..",
+    ".?>",
+    "<?.",
+    "_.?>",
+    "<?._",
+    "?.>",
+    "<.?",
+    "?.|>",
+    "<|.?",
+    "?/>",
+    "</?",
+    ".>",
+    "<.",
+    ".|>",
+    "<|.",
+    "/>",
+    "</",
+    "_.>",
+    "<._",
+    "_.|>",
+    "<|._",
+    "_/>",
+    "</_",
+    "?-?>",
+    "<?-?",
+    "?..?>",
+    "<?..?",
+    "?~?>",
+    "<?~?",
+    "?%?>",
+    "<?%?",
+    "?->",
+    "<-?",
+    "?-|>",
+    "<|-?",
+    "-?>",
+    "<?-",
+    "_-?>",
+    "<?-_",
+    "?..>",
+    "<..?",
+    "?~>",
+    "<~?",
+    "?%>",
+    "<%?",
+    "?..|>",
+    "<|..?",
+    "?~|>",
+    "<|~?",
+    "?%|>",
+    "<|%?",
+    "~?>",
+    "<?~",
+    "%?>",
+    "<?%",
+    "_..?>",
+    "<?.._",
+    "_~?>",
+    "<?~_",
+    "_%?>",
+    "<?%_",
+    "->",
+    "<-",
+    "_->",
+    "<-_",
+    "-|>",
+    "<|-",
+    "_-|>",
+    "<|-_",
+    "..>",
+    "<..",
+    "_..>",
+    "<.._",
+    "~>",
+    "<~",
+    "_~>",
+    "<~_",
+    "%>",
+    "<%",
+    "_%>",
+    "<%_",
+    "..|>",
+    "<|..",
+    "_..|>",
+    "<|.._",
+    "~|>",
+    "<|~",
+    "_~|>",
+    "<|~_",
+    "%|>",
+    "<|%",
+    "_%|>",
+    "<|%_",
+    "_<=",
+    "_<-",
+    "_<|-",
+    "_<~",
+    "_<|~",
+    ">",
+    "<",
+    "<>"};
+
+// Prefixes of sc.s-elements identifiers of level 1. They are keywords of SCs-grammar, so they can't be used as
+// sc.s-connectors attributes.
+std::unordered_set<std::string_view> const LEVEL_1_PREFIXES = {
+    "sc_common_edge",
+    "sc_common_arc",
+    "sc_membership_arc",
+    "sc_main_arc",
+    "sc_node",
+    "sc_link",
+    "sc_link_class",
+    "sc_node_tuple",
+    "sc_node_structure",
+    "sc_node_class",
+    "sc_node_role_relation",
+    "sc_node_non_role_relation",
+    "sc_node_superclass",
+    "sc_node_material",
+    "sc_edge",
+    "sc_edge_ucommon",
+    "sc_arc_common",
+    "sc_edge_dcommon",
+    "sc_arc_main",
+    "sc_edge_main",
+    "sc_arc_access",
+    "sc_edge_access",
+    "sc_node_not_binary_tuple",
+    "sc_node_struct",
+    "sc_node_not_relation",
+    "sc_node_norole_relation"};
+
+bool IsIdtfSymbol(char symbol)
+{
+  return (symbol >= 'a' && symbol <= 'z') || (symbol >= 'A' && symbol <= 'Z') || (symbol >= '0' && symbol <= '9')
+         || symbol == '_' || symbol == '.';
+}
+
+bool IsAliasSymbol(char symbol)
+{
+  return IsIdtfSymbol(symbol) && symbol != '.';
+}
+
+bool IsEscapedContentSymbol(char symbol)
+{
+  return symbol == '[' || symbol == ']' || symbol == '\\' || symbol == '*';
+}
+
+}  // namespace
+
+namespace scs
+{
+
+FastParser::FastParser(Parser & parser, std::string const & text)
+  : m_parser(parser)
+  , m_text(text)
+  , m_position(0)
+  , m_line(1)
+  , m_column(0)
+  , m_firstToken(0)
+  , m_tokensNum(0)
+{
+}
+
+bool FastParser::Parse()
+{
+  try
+  {
+    while (Peek().m_type != TokenType::End)
+      ParseSentence();
+  }
+  catch (utils::ExceptionParseError const &)
+  {
+    return false;
+  }
+
+  return true;
+}
+
+FastParser::Token const & FastParser::Peek(size_t index)
+{
+  while (m_tokensNum <= index)
+  {
+    m_tokens[(m_firstToken + m_tokensNum) % LOOKAHEAD_SIZE] = ReadToken();
+    ++m_tokensNum;
+  }
+
+  return m_tokens[(m_firstToken + index) % LOOKAHEAD_SIZE];
+}
+
+FastParser::Token FastParser::Take()
+{
+  Token const token = Peek();
+  m_firstToken = (m_firstToken + 1) % LOOKAHEAD_SIZE;
+  --m_tokensNum;
+  return token;
+}
+
+FastParser::Token FastParser::Expect(TokenType type)
+{
+  if (Peek().m_type != type)
+    SC_THROW_EXCEPTION(utils::ExceptionParseError, "Unexpected token at line " << Peek().m_line);
+
+  return Take();
+}
+
+std::string FastParser::GetText(Token const & token) const
+{
+  return m_text.substr(token.m_begin, token.m_end - token.m_begin);
+}
+
+// Lexer
+
+void FastParser::Advance(size_t length)
+{
+  // Lines and columns are counted the same way as ANTLR counts them, because they are used in identifiers of sc.s-sets
+  for (size_t const end = m_position + length; m_position < end; ++m_position)
+  {
+    char const symbol = m_text[m_position];
+    if (symbol == '\n')
+    {
+      ++m_line;
+      m_column = 0;
+    }
+    else if ((static_cast<unsigned char>(symbol) & 0xC0) != 0x80)
+      ++m_column;
+  }
+}
+
+void FastParser::SkipHidden()
+{
+  while (m_position < m_text.size())
+  {
+    char const symbol = m_text[m_position];
+    if (symbol == ' ' || symbol == '\t' || symbol == '\r' || symbol == '\n')
+      Advance(1);
+    else if (IsUnicodeLineTerminator(m_position))
+      Advance(3);
+    else if (m_text.compare(m_position, 2, "//") == 0)
+    {
+      size_t const end = m_text.find('\n', m_position);
+      if (end == std::string::npos)
+        SC_THROW_EXCEPTION(utils::ExceptionParseError, "Line comment isn't ended at line " << m_line);
+      Advance(end + 1 - m_position);
+    }
+    else if (m_text.compare(m_position, 2, "/*") == 0)
+    {
+      size_t const end = m_text.find("*/", m_position + 2);
+      if (end == std::string::npos)
+        SC_THROW_EXCEPTION(utils::ExceptionParseError, "Multiline comment isn't ended at line " << m_line);
+      Advance(end + 2 - m_position);
+    }
+    else
+      break;
+  }
+}
+
+bool FastParser::IsUnicodeLineTerminator(size_t position) const
+{
+  // Line separator and paragraph separator are hidden symbols as well as whitespaces
+  return m_text.compare(position, 3, "\xE2\x80\xA8") == 0 || m_text.compare(position, 3, "\xE2\x80\xA9") == 0;
+}
+
+size_t FastParser::MatchConnector(size_t position) const
+{
+  // Lexer chooses the longest token
+  size_t const maxSize = std::min(MAX_CONNECTOR_SIZE, m_text.size() - position);
+  for (size_t size = maxSize; size > 0; --size)
+  {
+    if (CONNECTORS.count(std::string_view(m_text.data() + position, size)))
+      return size;
+  }
+
+  return 0;
+}
+
+size_t FastParser::MatchContent(size_t position, bool isLinkClass) const
+{
+  size_t end = position + (isLinkClass ? 2 : 1);
+  bool isFirstSymbol = true;
+  while (true)
+  {
+    if (end >= m_text.size())
+      SC_THROW_EXCEPTION(utils::ExceptionParseError, "Content isn't ended at line " << m_line);
+
+    char const symbol = m_text[end];
+    if (symbol == ']')
+      break;
+
+    if (symbol == '\\')
+    {
+      if (end + 1 >= m_text.size() || !IsEscapedContentSymbol(m_text[end + 1]))
+        SC_THROW_EXCEPTION(utils::ExceptionParseError, "Invalid escaped symbol in content at line " << m_line);
+      end += 2;
+    }
+    else if (symbol == '[' || (isFirstSymbol && symbol == '*'))
+      SC_THROW_EXCEPTION(utils::ExceptionParseError, "Invalid symbol in content at line " << m_line);
+    else
+      ++end;
+
+    isFirstSymbol = false;
+  }
+
+  if (isLinkClass)
+  {
+    if (end + 1 >= m_text.size() || m_text[end + 1] != '!')
+      SC_THROW_EXCEPTION(utils::ExceptionParseError, "Link class content isn't ended at line " << m_line);
+    ++end;
+  }
+
+  return end + 1 - position;
+}
+
+FastParser::Token FastParser::ReadToken()
+{
+  SkipHidden();
+
+  Token token{TokenType::End, m_position, m_position, m_line, m_column};
+  if (m_position >= m_text.size())
+    return token;
+
+  char const symbol = m_text[m_position];
+  char const nextSymbol = m_position + 1 < m_text.size() ? m_text[m_position + 1] : '\0';
+  size_t size = 1;
+
+  if (IsIdtfSymbol(symbol))
+  {
+    size_t idtfSize = 1;
+    while (m_position + idtfSize < m_text.size() && IsIdtfSymbol(m_text[m_position + idtfSize]))
+      ++idtfSize;
+
+    size_t const connectorSize = MatchConnector(m_position);
+    if (connectorSize > idtfSize)
+    {
+      token.m_type = TokenType::Connector;
+      size = connectorSize;
+    }
+    else
+    {
+      size = idtfSize;
+      std::string_view const idtf(m_text.data() + m_position, size);
+      if (idtf == "_")
+        token.m_type = TokenType::Underscore;
+      else if (idtf == "...")
+        token.m_type = TokenType::Unnamed;
+      else if (LEVEL_1_PREFIXES.count(idtf))
+        token.m_type = TokenType::ElementType;
+      else
+        token.m_type = TokenType::Idtf;
+    }
+  }
+  else if (symbol == '@')
+  {
+    while (m_position + size < m_text.size() && IsAliasSymbol(m_text[m_position + size]))
+      ++size;
+    if (size == 1)
+      SC_THROW_EXCEPTION(utils::ExceptionParseError, "Empty alias at line " << m_line);
+    token.m_type = TokenType::Alias;
+  }
+  else if (symbol == '[' && nextSymbol == '*')
+  {
+    token.m_type = TokenType::ContourBegin;
+    size = 2;
+  }
+  else if (symbol == '[' || (symbol == '!' && nextSymbol == '['))
+  {
+    token.m_type = TokenType::Content;
+    size = MatchContent(m_position, symbol == '!');
+  }
+  else if (symbol == '"')
+  {
+    size_t const end = m_text.find('"', m_position + 1);
+    if (end == std::string::npos || m_text.find('\\', m_position + 1) < end)
+      SC_THROW_EXCEPTION(utils::ExceptionParseError, "Unsupported url at line " << m_line);
+    token.m_type = TokenType::Url;
+    size = end + 1 - m_position;
+  }
+  else if (symbol == '(')
+  {
+    token.m_type = nextSymbol == '*' ? TokenType::InternalSentencesBegin : TokenType::OpenParenthesis;
+    size = nextSymbol == '*' ? 2 : 1;
+  }
+  else if (symbol == '*' && (nextSymbol == ')' || nextSymbol == ']'))
+  {
+    token.m_type = nextSymbol == ')' ? TokenType::InternalSentencesEnd : TokenType::ContourEnd;
+    size = 2;
+  }
+  else if (symbol == ';')
+  {
+    token.m_type = nextSymbol == ';' ? TokenType::SentenceEnd : TokenType::Semicolon;
+    size = nextSymbol == ';' ? 2 : 1;
+  }
+  else if (symbol == ':')
+  {
+    token.m_type = nextSymbol == ':' ? TokenType::VarAttr : TokenType::ConstAttr;
+    size = nextSymbol == ':' ? 2 : 1;
+  }
+  else if (symbol == ')')
+    token.m_type = TokenType::CloseParenthesis;
+  else if (symbol == '{')
+    token.m_type = TokenType::SetBegin;
+  else if (symbol == '}')
+    token.m_type = TokenType::SetEnd;
+  else if (symbol == '|')
+    token.m_type = TokenType::Bar;
+  else if (symbol == '#')
+    token.m_type = TokenType::Sharp;
+  else
+  {
+    size = MatchConnector(m_position);
+    if (size != 0)
+      token.m_type = TokenType::Connector;
+    else if (symbol == '=')
+    {
+      token.m_type = TokenType::Equal;
+      size = 1;
+    }
+    else
+      SC_THROW_EXCEPTION(utils::ExceptionParseError, "Unsupported token at line " << m_line);
+  }
+
+  Advance(size);
+  token.m_end = m_position;
+  return token;
+}
+
+bool FastParser::IsIdtfBegin(TokenType type) const
+{
+  switch (type)
+  {
+  case TokenType::Idtf:
+  case TokenType::ElementType:
+  case TokenType::Unnamed:
+  case TokenType::Alias:
+  case TokenType::Underscore:
+  case TokenType::Content:
+  case TokenType::Url:
+  case TokenType::OpenParenthesis:
+  case TokenType::ContourBegin:
+  case TokenType::SetBegin:
+    return true;
+  default:
+    return false;
+  }
+}
+
+// Parser
+
+void FastParser::ParseSentence()
+{
+  TokenType const first = Peek(0).m_type;
+  TokenType const second = Peek(1).m_type;
+
+  bool const isContent = first == TokenType::Content || first == TokenType::Url;
+  bool const isVarContent = first == TokenType::Underscore && second == TokenType::Content;
+  bool const isIdtfSystem = first == TokenType::Idtf || first == TokenType::ElementType || first == TokenType::Unnamed;
+
+  if ((first == TokenType::ElementType && second == TokenType::Sharp) || (isContent && second == TokenType::Bar)
+      || (isVarContent && Peek(2).m_type == TokenType::Bar))
+    ParseSentenceLevel1();
+  else if (first == TokenType::Alias && second == TokenType::Equal)
+  {
+    std::string const & alias = GetText(Take());
+    Take();
+    m_parser.ProcessAssign(alias, ParseIdtfCommon());
+  }
+  else if (isIdtfSystem && second == TokenType::Equal)
+  {
+    ElementHandle const element = m_parser.ProcessIdentifier(GetText(Take()));
+    Take();
+
+    TokenType const type = Peek().m_type;
+    if (type == TokenType::Content || type == TokenType::Underscore)
+      ParseContent(element);
+    else if (type == TokenType::Url)
+      ParseUrl(element);
+    else if (type == TokenType::ContourBegin)
+    {
+      ParseContour(element);
+      while (Peek().m_type == TokenType::Semicolon)
+      {
+        Take();
+        ParseInternalSentence(element);
+      }
+    }
+    else
+      SC_THROW_EXCEPTION(utils::ExceptionParseError, "Unexpected assignment at line " << Peek().m_line);
+  }
+  else
+    ParseListItems(ParseIdtfCommon());
+
+  Expect(TokenType::SentenceEnd);
+}
+
+void FastParser::ParseSentenceLevel1()
+{
+  ElementHandle const source = ParseIdtfLevel1();
+  Expect(TokenType::Bar);
+  ElementHandle const connector = ParseIdtfLevel1();
+  Expect(TokenType::Bar);
+  ElementHandle const target = ParseIdtfLevel1();
+
+  m_parser.ProcessTriple(source, connector, target);
+}
+
+void FastParser::ParseListItems(ElementHandle const & source)
+{
+  ParseListItem(source);
+  while (Peek().m_type == TokenType::Semicolon)
+  {
+    Take();
+    ParseListItem(source);
+  }
+}
+
+void FastParser::ParseListItem(ElementHandle const & source)
+{
+  std::string const & connectorDesignation = GetText(Expect(TokenType::Connector));
+  Attrs const & attrs = ParseAttrs();
+  std::vector<ElementHandle> const & targets = ParseIdtfList();
+
+  for (ElementHandle const & target : targets)
+  {
+    ElementHandle const connector = m_parser.ProcessConnector(connectorDesignation);
+    m_parser.ProcessTriple(source, connector, target);
+    AppendAttrs(attrs, connector);
+  }
+}
+
+void FastParser::ParseInternalSentence(ElementHandle const & source)
+{
+  if (Peek().m_type == TokenType::InternalSentencesBegin)
+    ParseInternalSentenceList(source);
+  else
+    ParseListItem(source);
+}
+
+void FastParser::ParseInternalSentenceList(ElementHandle const & source)
+{
+  Expect(TokenType::InternalSentencesBegin);
+  do
+  {
+    ParseInternalSentence(source);
+    Expect(TokenType::SentenceEnd);
+  } while (Peek().m_type != TokenType::InternalSentencesEnd);
+  Take();
+}
+
+FastParser::Attrs FastParser::ParseAttrs()
+{
+  Attrs attrs;
+  while (Peek(1).m_type == TokenType::ConstAttr || Peek(1).m_type == TokenType::VarAttr)
+  {
+    Token const & attr = Expect(TokenType::Idtf);
+    bool const isConst = Take().m_type == TokenType::ConstAttr;
+    attrs.emplace_back(m_parser.ProcessIdentifier(GetText(attr)), isConst);
+  }
+
+  return attrs;
+}
+
+std::vector<ElementHandle> FastParser::ParseIdtfList()
+{
+  std::vector<ElementHandle> items;
+  while (true)
+  {
+    items.push_back(ParseIdtfCommon());
+    if (Peek().m_type == TokenType::InternalSentencesBegin)
+      ParseInternalSentenceList(items.back());
+
+    // `;` followed by sc.s-connector begins next item of sc.s-sentence
+    if (Peek(0).m_type != TokenType::Semicolon || !IsIdtfBegin(Peek(1).m_type))
+      break;
+    Take();
+  }
+
+  return items;
+}
+
+ElementHandle FastParser::ParseIdtfLevel1()
+{
+  TokenType const type = Peek().m_type;
+  if (type == TokenType::Content || type == TokenType::Underscore)
+    return ParseContent();
+  if (type == TokenType::Url)
+    return ParseUrl();
+
+  std::string const & elementType = GetText(Expect(TokenType::ElementType));
+  Expect(TokenType::Sharp);
+  return m_parser.ProcessIdentifierLevel1(elementType, GetText(Expect(TokenType::Idtf)));
+}
+
+ElementHandle FastParser::ParseIdtfCommon()
+{
+  switch (Peek().m_type)
+  {
+  case TokenType::OpenParenthesis:
+    return ParseIdtfConnector();
+  case TokenType::SetBegin:
+    return ParseIdtfSet();
+  case TokenType::ContourBegin:
+    return ParseContour();
+  case TokenType::Underscore:
+  case TokenType::Content:
+    return ParseContent();
+  case TokenType::Url:
+    return ParseUrl();
+  default:
+    return ParseIdtfAtomic();
+  }
+}
+
+ElementHandle FastParser::ParseIdtfAtomic()
+{
+  Token const & token = Take();
+  switch (token.m_type)
+  {
+  case TokenType::Alias:
+  {
+    ElementHandle const element = m_parser.ResolveAlias(GetText(token));
+    if (!element.IsValid())
+      SC_THROW_EXCEPTION(utils::ExceptionParseError, "Unknown alias at line " << token.m_line);
+    return element;
+  }
+  case TokenType::Idtf:
+  case TokenType::ElementType:
+  case TokenType::Unnamed:
+    return m_parser.ProcessIdentifier(GetText(token));
+  default:
+    SC_THROW_EXCEPTION(utils::ExceptionParseError, "Unexpected token at line " << token.m_line);
+  }
+}
+
+ElementHandle FastParser::ParseIdtfConnector()
+{
+  Expect(TokenType::OpenParenthesis);
+  ElementHandle const source =
+      Peek().m_type == TokenType::OpenParenthesis ? ParseIdtfConnector() : ParseIdtfAtomic();
+  std::string const & connectorDesignation = GetText(Expect(TokenType::Connector));
+  Attrs const & attrs = ParseAttrs();
+  ElementHandle const target =
+      Peek().m_type == TokenType::OpenParenthesis ? ParseIdtfConnector() : ParseIdtfAtomic();
+  Expect(TokenType::CloseParenthesis);
+
+  ElementHandle const connector = m_parser.ProcessConnector(connectorDesignation);
+  m_parser.ProcessTriple(source, connector, target);
+  AppendAttrs(attrs, connector);
+  return connector;
+}
+
+ElementHandle FastParser::ParseIdtfSet()
+{
+  Expect(TokenType::SetBegin);
+
+  Token const & first = Peek();
+  std::string const & setIdtf = "..set_" + std::to_string(first.m_line) + "_" + std::to_string(first.m_column);
+  ElementHandle const set = m_parser.ProcessIdentifierLevel1("sc_node_tuple", setIdtf);
+
+  while (true)
+  {
+    Attrs const & attrs = ParseAttrs();
+    ElementHandle const element = ParseIdtfCommon();
+
+    ElementHandle const arc = m_parser.ProcessConnector("->");
+    m_parser.ProcessTriple(set, arc, element);
+    AppendAttrs(attrs, arc);
+
+    if (Peek().m_type == TokenType::InternalSentencesBegin)
+      ParseInternalSentenceList(element);
+
+    if (Peek().m_type != TokenType::Semicolon)
+      break;
+    Take();
+  }
+
+  Expect(TokenType::SetEnd);
+  return set;
+}
+
+ElementHandle FastParser::ParseContent(ElementHandle const & link)
+{
+  bool isVar = false;
+  if (Peek().m_type == TokenType::Underscore)
+  {
+    Take();
+    isVar = true;
+  }
+
+  std::string const & content = GetText(Expect(TokenType::Content));
+  return link.IsValid() ? m_parser.ProcessLink(link, content) : m_parser.ProcessContent(content, isVar);
+}
+
+ElementHandle FastParser::ParseUrl(ElementHandle const & link)
+{
+  std::string const & url = GetText(Expect(TokenType::Url));
+  return link.IsValid() ? m_parser.ProcessLink(link, url, true) : m_parser.ProcessFileURL(url);
+}
+
+ElementHandle FastParser::ParseContour(ElementHandle const & contour)
+{
+  Expect(TokenType::ContourBegin);
+
+  ElementHandle const handle = contour.IsValid() ? contour : m_parser.ProcessEmptyContour();
+  m_parser.ProcessContourBegin();
+
+  while (Peek().m_type != TokenType::ContourEnd)
+  {
+    // sc.s-sentences beginning with sc.s-connector have sc.s-contour as source
+    if (Peek().m_type == TokenType::Connector)
+    {
+      ParseListItems(handle);
+      Expect(TokenType::SentenceEnd);
+    }
+    else
+      ParseSentence();
+  }
+  Take();
+
+  m_parser.ProcessContourEnd(handle);
+  return handle;
+}
+
+void FastParser::AppendAttrs(Attrs const & attrs, ElementHandle const & connector)
+{
+  for (auto const & [attr, isConst] : attrs)
+  {
+    ElementHandle const attrConnector = m_parser.ProcessConnector(isConst ? "->" : "_->");
+    m_parser.ProcessTriple(attr, attrConnector, connector);
+  }
+}
+
+}  // namespace scs
@@ -0,0 +1,124 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#pragma once
+
+#include <array>
+#include <string>
+#include <vector>
+
+#include "sc-memory/scs/scs_parser.hpp"
+
+namespace scs
+{
+
+/*!
+ * Hand-written parser of SCs-text. It reads SCs-text token by token without building of tokens stream and parse tree,
+ * and calls the same methods of scs::Parser in the same order as ANTLR-parser calls them, so parsed sc.s-elements and
+ * triples are the same. It supports all sc.s-sentences except sc.s-vectors. It doesn't report errors: if SCs-text
+ * contains sc.s-vectors or errors, then it stops, and SCs-text should be parsed by ANTLR-parser.
+ */
+class FastParser
+{
+public:
+  FastParser(Parser & parser, std::string const & text);
+
+  /*! Parses SCs-text.
+   * @return If SCs-text is parsed, then returns true; otherwise returns false, and state of scs::Parser should be reset.
+   */
+  bool Parse();
+
+private:
+  enum class TokenType : uint8_t
+  {
+    End,
+    Idtf,
+    ElementType,
+    Unnamed,
+    Alias,
+    Underscore,
+    Content,
+    Url,
+    Connector,
+    Equal,
+    Semicolon,
+    SentenceEnd,
+    ConstAttr,
+    VarAttr,
+    Bar,
+    Sharp,
+    OpenParenthesis,
+    CloseParenthesis,
+    InternalSentencesBegin,
+    InternalSentencesEnd,
+    ContourBegin,
+    ContourEnd,
+    SetBegin,
+    SetEnd
+  };
+
+  struct Token
+  {
+    TokenType m_type;
+    size_t m_begin;
+    size_t m_end;
+    size_t m_line;
+    size_t m_column;
+  };
+
+  using Attrs = std::vector<std::pair<ElementHandle, bool>>;
+
+  // Number of tokens which are needed to choose sc.s-sentence
+  static size_t const LOOKAHEAD_SIZE = 3;
+  static size_t const MAX_CONNECTOR_SIZE = 5;
+
+  Parser & m_parser;
+  std::string const & m_text;
+
+  size_t m_position;
+  size_t m_line;
+  size_t m_column;
+
+  std::array<Token, LOOKAHEAD_SIZE> m_tokens;
+  size_t m_firstToken;
+  size_t m_tokensNum;
+
+  Token const & Peek(size_t index = 0);
+  Token Take();
+  Token Expect(TokenType type);
+  std::string GetText(Token const & token) const;
+
+  Token ReadToken();
+  void SkipHidden();
+  void Advance(size_t length);
+  bool IsUnicodeLineTerminator(size_t position) const;
+  size_t MatchConnector(size_t position) const;
+  size_t MatchContent(size_t position, bool isLinkClass) const;
+
+  bool IsIdtfBegin(TokenType type) const;
+
+  void ParseSentence();
+  void ParseSentenceLevel1();
+  void ParseListItems(ElementHandle const & source);
+  void ParseListItem(ElementHandle const & source);
+  void ParseInternalSentence(ElementHandle const & source);
+  void ParseInternalSentenceList(ElementHandle const & source);
+  Attrs ParseAttrs();
+  std::vector<ElementHandle> ParseIdtfList();
+
+  ElementHandle ParseIdtfLevel1();
+  ElementHandle ParseIdtfCommon();
+  ElementHandle ParseIdtfAtomic();
+  ElementHandle ParseIdtfConnector();
+  ElementHandle ParseIdtfSet();
+  ElementHandle ParseContent(ElementHandle const & link = ElementHandle());
+  ElementHandle ParseUrl(ElementHandle const & link = ElementHandle());
+  ElementHandle ParseContour(ElementHandle const & contour = ElementHandle());
+
+  void AppendAttrs(Attrs const & attrs, ElementHandle const & connector);
+};
+
+}  // namespace scs
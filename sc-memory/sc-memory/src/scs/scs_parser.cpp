@@ -27,6 +27,8 @@
 #include "scsLexer.h"
 #include "scsParser.h"
 
+#include "scs_fast_parser.hpp"
+
 #include <iostream>
 
 namespace
@@ -277,6 +279,20 @@ Parser::Parser()
 }
 
 bool Parser::Parse(std::string const & str)
+{
+  // Hand-written parser is used if nothing is parsed before, because it can't restore previous state after fail
+  if (IsEmpty())
+  {
+    if (FastParser(*this, str).Parse())
+      return true;
+
+    Clear();
+  }
+
+  return ParseByANTLR(str);
+}
+
+bool Parser::ParseByANTLR(std::string const & str)
 {
   bool result = true;
 
@@ -370,6 +386,26 @@ Parser::AliasHandles const & Parser::GetAliases() const
   return m_aliasHandles;
 }
 
+bool Parser::IsEmpty() const
+{
+  return m_parsedElements.empty() && m_parsedElementsLocal.empty() && m_aliasHandles.empty() && m_idtfCounter == 0;
+}
+
+void Parser::Clear()
+{
+  m_parsedElements.clear();
+  m_parsedElementsLocal.clear();
+  m_contourElementsStack = {};
+  m_contourTriplesStack = {};
+  m_parsedTriples.clear();
+  m_idtfToParsedElement.clear();
+  m_aliasHandles.clear();
+  m_elementTypeOutgoingBaseArcs.clear();
+  m_elementTypeNotOutgoingBaseArcsToElementTypes.clear();
+  m_lastError.clear();
+  m_idtfCounter = 0;
+}
+
 std::string Parser::GenerateNodeIdtf()
 {
   return std::string("..node_") + std::to_string(m_idtfCounter++);
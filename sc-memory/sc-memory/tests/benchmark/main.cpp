@@ -21,6 +21,8 @@
 #include "units/template_search_complex.hpp"
 #include "units/template_search_smoke.hpp"
 
+#include "units/scs_parse.hpp"
+
 #include <atomic>
 #include <chrono>
 
@@ -545,5 +547,14 @@ BENCHMARK_TEMPLATE(BM_Template, TestScCodeExtended)
 ->Unit(benchmark::TimeUnit::kMicrosecond)
 ->Arg(5)->Arg(50)->Arg(500);
 
+// SCs-text parsing by hand-written parser vs ANTLR-parser
+BENCHMARK_TEMPLATE(BM_Template, TestSCsParseFast)
+->Unit(benchmark::TimeUnit::kMillisecond)
+->Arg(1000)->Arg(10000);
+
+BENCHMARK_TEMPLATE(BM_Template, TestSCsParseANTLR)
+->Unit(benchmark::TimeUnit::kMillisecond)
+->Arg(1000)->Arg(10000);
+
 
 BENCHMARK_MAIN();
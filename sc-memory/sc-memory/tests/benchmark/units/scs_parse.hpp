@@ -0,0 +1,61 @@
+/*
+* This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+* Distributed under the MIT License
+* (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+*/
+
+#pragma once
+
+#include <sc-memory/scs/scs_parser.hpp>
+
+#include <string>
+
+class TestSCsParse
+{
+public:
+  void Initialize(size_t sentencesNum)
+  {
+    for (size_t i = 0; i < sentencesNum; ++i)
+    {
+      std::string const & idtf = "concept_" + std::to_string(i);
+      m_text += idtf + "\n  <- sc_node_class;\n  => nrel_main_idtf: [Concept " + std::to_string(i)
+                + "] (* <- lang_en;; *);\n  -> rrel_key_sc_element: {element_" + std::to_string(i) + "; _var_"
+                + std::to_string(i) + "};\n  <= nrel_inclusion: (" + idtf + " -> set_" + std::to_string(i)
+                + ");;\n";
+    }
+  }
+
+  void Shutdown()
+  {
+    m_text.clear();
+  }
+
+protected:
+  class Parser : public scs::Parser
+  {
+  public:
+    using scs::Parser::ParseByANTLR;
+  };
+
+  std::string m_text;
+};
+
+class TestSCsParseFast : public TestSCsParse
+{
+public:
+  bool Run()
+  {
+    Parser parser;
+    return parser.Parse(m_text);
+  }
+};
+
+class TestSCsParseANTLR : public TestSCsParse
+{
+public:
+  bool Run()
+  {
+    Parser parser;
+    return parser.ParseByANTLR(m_text);
+  }
+};
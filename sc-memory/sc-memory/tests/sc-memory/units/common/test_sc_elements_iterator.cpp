@@ -0,0 +1,126 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include <sc-memory/test/sc_test.hpp>
+
+#include <algorithm>
+
+#include <sc-memory/sc_memory.hpp>
+
+class ScElementsIteratorTest : public ScMemoryTest
+{
+protected:
+  ScAddrSet CollectElements(ScType const & elementType)
+  {
+    ScAddrSet elementAddrs;
+    m_ctx->ForEachElement(
+        elementType,
+        [&](ScAddr const & elementAddr)
+        {
+          EXPECT_EQ(m_ctx->GetElementType(elementAddr).BitAnd(*elementType), *elementType);
+          EXPECT_TRUE(elementAddrs.insert(elementAddr).second);
+        });
+    return elementAddrs;
+  }
+
+  void ReinitializeWithoutIndex()
+  {
+    m_ctx->Destroy();
+    ScMemoryTest::Shutdown();
+
+    sc_memory_params params;
+    sc_memory_params_clear(&params);
+
+    params.dump_memory = SC_FALSE;
+    params.dump_memory_statistics = SC_FALSE;
+
+    params.clear = SC_TRUE;
+    params.storage = "repo";
+    params.index_elements_by_types = SC_FALSE;
+
+    ScMemory::LogMute();
+    ScMemory::Initialize(params);
+    ScMemory::LogUnmute();
+
+    m_ctx = std::make_unique<ScAgentContext>();
+  }
+
+  void TestIterateElementsOfType()
+  {
+    ScAddrSet const & initialClassAddrs = CollectElements(ScType::ConstNodeClass);
+
+    ScAddrSet classAddrs;
+    for (size_t i = 0; i < 100; ++i)
+    {
+      classAddrs.insert(m_ctx->GenerateNode(ScType::ConstNodeClass));
+      ScAddr const & nodeAddr = m_ctx->GenerateNode(ScType::ConstNode);
+      m_ctx->GenerateConnector(ScType::ConstPermPosArc, *classAddrs.begin(), nodeAddr);
+    }
+
+    ScAddrSet foundClassAddrs = CollectElements(ScType::ConstNodeClass);
+    for (ScAddr const & classAddr : initialClassAddrs)
+      EXPECT_EQ(foundClassAddrs.erase(classAddr), 1u);
+    EXPECT_EQ(foundClassAddrs, classAddrs);
+
+    // sc-element is found by new type after its subtype is changed and is not found after it is erased
+    ScAddr const & nodeAddr = m_ctx->GenerateNode(ScType::ConstNode);
+    EXPECT_EQ(CollectElements(ScType::ConstNodeStructure).count(nodeAddr), 0u);
+    EXPECT_TRUE(m_ctx->SetElementSubtype(nodeAddr, ScType::ConstNodeStructure));
+    EXPECT_EQ(CollectElements(ScType::ConstNodeStructure).count(nodeAddr), 1u);
+
+    ScAddr const & classAddr = *classAddrs.begin();
+    EXPECT_TRUE(m_ctx->EraseElement(classAddr));
+    EXPECT_EQ(CollectElements(ScType::ConstNodeClass).count(classAddr), 0u);
+
+    ScMemoryContext::ScMemoryStatistics const & stat = m_ctx->CalculateStatistics();
+    EXPECT_EQ(CollectElements(ScType::Node).size(), stat.m_nodesNum);
+    EXPECT_EQ(CollectElements(ScType::NodeLink).size(), stat.m_linksNum);
+    EXPECT_EQ(CollectElements(ScType::Connector).size(), stat.m_connectorsNum);
+    EXPECT_EQ(CollectElements(ScType::Unknown).size(), stat.m_nodesNum + stat.m_connectorsNum);
+  }
+};
+
+TEST_F(ScElementsIteratorTest, IterateElementsOfType)
+{
+  TestIterateElementsOfType();
+}
+
+TEST_F(ScElementsIteratorTest, IterateElementsOfTypeWithoutIndex)
+{
+  ReinitializeWithoutIndex();
+  TestIterateElementsOfType();
+}
+
+TEST_F(ScElementsIteratorTest, IterateElementsOfTypeInSeveralSegments)
+{
+  ScAddrVector linkAddrs;
+  for (size_t i = 0; i < SC_SEGMENT_ELEMENTS_COUNT + 100; ++i)
+  {
+    m_ctx->GenerateNode(ScType::ConstNode);
+    if (i % 1000 == 0)
+      linkAddrs.push_back(m_ctx->GenerateLink(ScType::ConstNodeLink));
+  }
+
+  ScAddrVector foundLinkAddrs;
+  ScElementsIteratorPtr it = m_ctx->CreateElementsIterator(ScType::ConstNodeLink);
+  while (it->Next())
+    foundLinkAddrs.push_back(it->Get());
+  EXPECT_FALSE(it->Next());
+
+  // sc-elements are found in order of their sc-addresses
+  ScAddrVector expectedLinkAddrs = foundLinkAddrs;
+  std::sort(
+      expectedLinkAddrs.begin(),
+      expectedLinkAddrs.end(),
+      [](ScAddr const & left, ScAddr const & right)
+      {
+        return (*left).seg < (*right).seg || ((*left).seg == (*right).seg && (*left).offset < (*right).offset);
+      });
+  EXPECT_EQ(foundLinkAddrs, expectedLinkAddrs);
+
+  for (ScAddr const & linkAddr : linkAddrs)
+    EXPECT_NE(std::find(foundLinkAddrs.cbegin(), foundLinkAddrs.cend(), linkAddr), foundLinkAddrs.cend());
+}
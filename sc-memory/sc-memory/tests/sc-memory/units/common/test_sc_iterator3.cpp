@@ -100,6 +100,46 @@ TEST_F(ScIterator3Test, FAF2)
   EXPECT_EQ(iter3->Get(2), ScAddr::Empty);
 }
 
+TEST_F(ScIterator3Test, FAFByOutgoingConnectorsOfSource)
+{
+  // target has more incoming sc-arcs than source has outgoing ones
+  for (size_t i = 0; i < 5; ++i)
+    m_ctx->GenerateConnector(ScType::ConstPermPosArc, m_ctx->GenerateNode(ScType::ConstNode), m_target);
+  ScAddr const & otherConnector = m_ctx->GenerateConnector(ScType::ConstPermPosArc, m_source, m_target);
+  m_ctx->GenerateConnector(ScType::ConstCommonEdge, m_target, m_source);
+
+  ScAddrSet connectors;
+  ScIterator3Ptr const iter3 = m_ctx->CreateIterator3(m_source, ScType::ConstPermPosArc, m_target);
+  while (iter3->Next())
+  {
+    EXPECT_EQ(iter3->Get(0), m_source);
+    EXPECT_EQ(iter3->Get(2), m_target);
+    connectors.insert(iter3->Get(1));
+  }
+  EXPECT_EQ(connectors, ScAddrSet({m_connector, otherConnector}));
+
+  EXPECT_TRUE(m_ctx->CheckConnector(m_source, m_target, ScType::ConstCommonEdge));
+  EXPECT_FALSE(m_ctx->CheckConnector(m_target, m_source, ScType::ConstPermPosArc));
+}
+
+TEST_F(ScIterator3Test, FAFByIncomingConnectorsOfTarget)
+{
+  // source has more outgoing sc-arcs than target has incoming ones
+  for (size_t i = 0; i < 5; ++i)
+    m_ctx->GenerateConnector(ScType::ConstPermPosArc, m_source, m_ctx->GenerateNode(ScType::ConstNode));
+  ScAddr const & otherConnector = m_ctx->GenerateConnector(ScType::ConstPermPosArc, m_source, m_target);
+  m_ctx->GenerateConnector(ScType::ConstCommonEdge, m_target, m_source);
+
+  ScAddrSet connectors;
+  ScIterator3Ptr const iter3 = m_ctx->CreateIterator3(m_source, ScType::ConstPermPosArc, m_target);
+  while (iter3->Next())
+    connectors.insert(iter3->Get(1));
+  EXPECT_EQ(connectors, ScAddrSet({m_connector, otherConnector}));
+
+  EXPECT_TRUE(m_ctx->CheckConnector(m_source, m_target, ScType::ConstCommonEdge));
+  EXPECT_FALSE(m_ctx->CheckConnector(m_target, m_source, ScType::ConstPermPosArc));
+}
+
 TEST_F(ScIterator3Test, FAA)
 {
   ScIterator3Ptr const iter3 = m_ctx->CreateIterator3(m_source, ScType::ConstPermPosArc, ScType::Node);
@@ -276,6 +316,103 @@ TEST_F(ScIterator3Test, FFF)
   EXPECT_EQ(iter3->Get(2), ScAddr::Empty);
 }
 
+TEST_F(ScIterator3Test, FAANextBatch)
+{
+  size_t const connectorsCount = 10;
+  for (size_t i = 1; i < connectorsCount; ++i)
+    m_ctx->GenerateConnector(ScType::ConstPermPosArc, m_source, m_ctx->GenerateNode(ScType::ConstNode));
+
+  std::vector<ScAddrTriple> expectedTriples;
+  ScIterator3Ptr const iter3 = m_ctx->CreateIterator3(m_source, ScType::ConstPermPosArc, ScType::Node);
+  while (iter3->Next())
+    expectedTriples.push_back(iter3->Get());
+  EXPECT_EQ(expectedTriples.size(), connectorsCount);
+
+  std::vector<ScAddrTriple> foundTriples;
+  std::vector<ScAddrTriple> batch;
+  ScIterator3Ptr const batchIter3 = m_ctx->CreateIterator3(m_source, ScType::ConstPermPosArc, ScType::Node);
+  EXPECT_EQ(batchIter3->NextBatch(batch, 3), 3u);
+  foundTriples.insert(foundTriples.cend(), batch.cbegin(), batch.cend());
+  EXPECT_EQ(batchIter3->NextBatch(batch, 3), 3u);
+  foundTriples.insert(foundTriples.cend(), batch.cbegin(), batch.cend());
+  EXPECT_EQ(batchIter3->NextBatch(batch, 3), 3u);
+  foundTriples.insert(foundTriples.cend(), batch.cbegin(), batch.cend());
+  EXPECT_EQ(batchIter3->NextBatch(batch, 3), 1u);
+  foundTriples.insert(foundTriples.cend(), batch.cbegin(), batch.cend());
+  EXPECT_EQ(batchIter3->NextBatch(batch, 3), 0u);
+  EXPECT_TRUE(batch.empty());
+
+  EXPECT_EQ(foundTriples, expectedTriples);
+  EXPECT_FALSE(batchIter3->Next());
+}
+
+TEST_F(ScIterator3Test, AAFNextBatch)
+{
+  ScAddr const & otherSource = m_ctx->GenerateNode(ScType::ConstNode);
+  ScAddr const & otherConnector = m_ctx->GenerateConnector(ScType::ConstPermPosArc, otherSource, m_target);
+  m_ctx->GenerateConnector(ScType::ConstCommonArc, m_ctx->GenerateNode(ScType::ConstNode), m_target);
+
+  std::vector<ScAddrTriple> triples;
+  ScIterator3Ptr const iter3 = m_ctx->CreateIterator3(ScType::Node, ScType::ConstPermPosArc, m_target);
+  EXPECT_EQ(iter3->NextBatch(triples, 10), 2u);
+  EXPECT_EQ(triples.size(), 2u);
+
+  for (ScAddrTriple const & triple : triples)
+  {
+    EXPECT_EQ(triple[2], m_target);
+    EXPECT_TRUE(
+        (triple[0] == m_source && triple[1] == m_connector)
+        || (triple[0] == otherSource && triple[1] == otherConnector));
+  }
+  EXPECT_NE(triples[0][1], triples[1][1]);
+
+  EXPECT_EQ(iter3->NextBatch(triples, 10), 0u);
+  EXPECT_TRUE(triples.empty());
+}
+
+TEST_F(ScIterator3Test, FAFNextBatch)
+{
+  ScIterator3Ptr const iter3 = m_ctx->CreateIterator3(m_source, ScType::ConstPermPosArc, m_target);
+
+  std::vector<ScAddrTriple> triples;
+  EXPECT_EQ(iter3->NextBatch(triples, 10), 1u);
+  EXPECT_EQ(triples[0], ScAddrTriple({m_source, m_connector, m_target}));
+  EXPECT_EQ(iter3->NextBatch(triples, 10), 0u);
+}
+
+TEST_F(ScIterator3Test, NextBatchWithZeroMaxCount)
+{
+  ScIterator3Ptr const iter3 = m_ctx->CreateIterator3(m_source, ScType::ConstPermPosArc, ScType::Node);
+
+  std::vector<ScAddrTriple> triples;
+  EXPECT_THROW(iter3->NextBatch(triples, 0), utils::ExceptionInvalidParams);
+  EXPECT_TRUE(iter3->Next());
+}
+
+TEST_F(ScIterator3Test, Count)
+{
+  for (size_t i = 0; i < 3; ++i)
+  {
+    m_ctx->GenerateConnector(ScType::ConstPermPosArc, m_source, m_ctx->GenerateNode(ScType::ConstNode));
+    m_ctx->GenerateConnector(ScType::ConstCommonArc, m_source, m_ctx->GenerateNode(ScType::ConstNode));
+  }
+
+  EXPECT_EQ(m_ctx->CreateIterator3(m_source, ScType::ConstPermPosArc, ScType::Unknown)->Count(), 4u);
+  EXPECT_EQ(m_ctx->CreateIterator3(m_source, ScType::ConstPermPosArc, ScType::ConstNode)->Count(), 3u);
+  EXPECT_EQ(m_ctx->CreateIterator3(m_source, ScType::Unknown, ScType::Unknown)->Count(), 7u);
+  EXPECT_EQ(m_ctx->CreateIterator3(ScType::Unknown, ScType::ConstPermPosArc, m_target)->Count(), 1u);
+  EXPECT_EQ(m_ctx->CreateIterator3(ScType::ConstNodeLink, ScType::ConstPermPosArc, m_target)->Count(), 0u);
+  EXPECT_EQ(m_ctx->CreateIterator3(m_source, ScType::ConstPermPosArc, m_target)->Count(), 1u);
+
+  ScIterator3Ptr const iter3 = m_ctx->CreateIterator3(m_source, ScType::Unknown, ScType::Unknown);
+  EXPECT_EQ(iter3->Count(1), 1u);
+  EXPECT_THROW(iter3->Get(1), utils::ExceptionInvalidState);
+  EXPECT_EQ(iter3->Count(5), 5u);
+  EXPECT_TRUE(iter3->Next());
+  EXPECT_FALSE(iter3->Next());
+  EXPECT_EQ(iter3->Count(), 0u);
+}
+
 class ScEdgeTest : public ScMemoryTest
 {
 protected:
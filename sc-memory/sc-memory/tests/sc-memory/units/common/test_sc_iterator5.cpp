@@ -109,6 +109,29 @@ TEST_F(ScIterator5Test, AAFAA)
   EXPECT_EQ(iter5->Get(4), ScAddr::Empty);
 }
 
+TEST_F(ScIterator5Test, AAFAANextBatch)
+{
+  ScIterator5Ptr const iter5 =
+      m_ctx->CreateIterator5(ScType::Node, ScType::ConstPermPosArc, m_target, ScType::ConstPermPosArc, ScType::Node);
+
+  std::vector<ScAddrQuintuple> quintuples;
+  EXPECT_EQ(iter5->NextBatch(quintuples, 10), 1u);
+  EXPECT_EQ(quintuples[0], ScAddrQuintuple({m_source, m_connector, m_target, m_attrConnector, m_attr}));
+
+  EXPECT_EQ(iter5->NextBatch(quintuples, 10), 0u);
+  EXPECT_TRUE(quintuples.empty());
+  EXPECT_THROW(iter5->NextBatch(quintuples, 0), utils::ExceptionInvalidParams);
+}
+
+TEST_F(ScIterator5Test, AAFAACount)
+{
+  ScIterator5Ptr const iter5 =
+      m_ctx->CreateIterator5(ScType::Node, ScType::ConstPermPosArc, m_target, ScType::ConstPermPosArc, ScType::Node);
+
+  EXPECT_EQ(iter5->Count(), 1u);
+  EXPECT_EQ(iter5->Count(), 0u);
+}
+
 TEST_F(ScIterator5Test, AAFAA2)
 {
   ScIterator5Ptr const iter5 = m_ctx->CreateIterator5(
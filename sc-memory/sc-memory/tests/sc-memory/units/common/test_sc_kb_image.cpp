@@ -0,0 +1,204 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include <sc-memory/test/sc_test.hpp>
+
+#include <fstream>
+
+#include <sc-memory/sc_memory.hpp>
+#include <sc-memory/sc_kb_image.hpp>
+
+namespace
+{
+
+std::string const IMAGE_PATH = "test_sc_kb_image.image";
+
+class ScKBImageTest : public ScMemoryTest
+{
+protected:
+  void TearDown() override
+  {
+    ScMemoryTest::TearDown();
+    std::remove(IMAGE_PATH.c_str());
+  }
+
+  void Restart()
+  {
+    m_ctx->Destroy();
+    ScMemoryTest::Shutdown();
+    ScMemoryTest::Initialize();
+    m_ctx = std::make_unique<ScAgentContext>();
+  }
+};
+
+}  // namespace
+
+TEST_F(ScKBImageTest, SaveLoadGenerate)
+{
+  ScAddr const & classAddr = m_ctx->GenerateNode(ScType::ConstNodeClass);
+  m_ctx->SetElementSystemIdentifier("test_kb_image_class", classAddr);
+  ScAddr const & nodeAddr = m_ctx->GenerateNode(ScType::ConstNode);
+  ScAddr const & linkAddr = m_ctx->GenerateLink(ScType::ConstNodeLink);
+  m_ctx->SetLinkContent(linkAddr, "test_kb_image_content");
+  ScAddr const & nodeArcAddr = m_ctx->GenerateConnector(ScType::ConstPermPosArc, classAddr, nodeAddr);
+  ScAddr const & linkArcAddr = m_ctx->GenerateConnector(ScType::ConstPermPosArc, classAddr, linkAddr);
+  ScAddr const & keynodeArcAddr = m_ctx->GenerateConnector(ScType::ConstPermPosArc, ScKeynodes::action, classAddr);
+
+  ScKBImage const & image =
+      ScKBImage::Capture(*m_ctx, {keynodeArcAddr, nodeArcAddr, linkArcAddr, classAddr, nodeAddr, linkAddr});
+  image.Save(IMAGE_PATH);
+
+  // class with its system identifier quintuple, node, link, external keynode with its quintuple and 3 sc-arcs
+  EXPECT_EQ(image.GetElements().size(), 13u);
+
+  Restart();
+
+  ScKBImage loadedImage;
+  loadedImage.Load(IMAGE_PATH);
+  EXPECT_EQ(loadedImage.GetElements().size(), image.GetElements().size());
+
+  ScAddrVector const & addrs = loadedImage.Generate(*m_ctx);
+  EXPECT_EQ(addrs.size(), loadedImage.GetElements().size());
+
+  ScAddr const & loadedClassAddr = m_ctx->SearchElementBySystemIdentifier("test_kb_image_class");
+  EXPECT_TRUE(loadedClassAddr.IsValid());
+  EXPECT_EQ(m_ctx->GetElementType(loadedClassAddr), ScType::ConstNodeClass);
+  EXPECT_TRUE(m_ctx->CheckConnector(ScKeynodes::action, loadedClassAddr, ScType::ConstPermPosArc));
+
+  size_t linksNum = 0;
+  ScIterator3Ptr const it3 = m_ctx->CreateIterator3(loadedClassAddr, ScType::ConstPermPosArc, ScType::Unknown);
+  while (it3->Next())
+  {
+    ScAddr const & targetAddr = it3->Get(2);
+    if (m_ctx->GetElementType(targetAddr).IsLink())
+    {
+      std::string content;
+      EXPECT_TRUE(m_ctx->GetLinkContent(targetAddr, content));
+      EXPECT_EQ(content, "test_kb_image_content");
+      ++linksNum;
+    }
+    else
+      EXPECT_EQ(m_ctx->GetElementType(targetAddr), ScType::ConstNode);
+  }
+  EXPECT_EQ(linksNum, 1u);
+  EXPECT_EQ(m_ctx->GetElementEdgesAndOutgoingArcsCount(loadedClassAddr), 3u);
+}
+
+TEST_F(ScKBImageTest, CaptureSystemIdentifierQuintuple)
+{
+  ScAddr const & nodeAddr = m_ctx->GenerateNode(ScType::ConstNode);
+  m_ctx->SetElementSystemIdentifier("test_kb_image_identified_node", nodeAddr);
+
+  ScKBImage const & image = ScKBImage::Capture(*m_ctx, {nodeAddr});
+  std::vector<ScKBImage::Element> const & elements = image.GetElements();
+  ASSERT_EQ(elements.size(), 4u);
+
+  EXPECT_EQ(elements[0].m_kind, ScKBImage::ElementKind::Node);
+  EXPECT_EQ(elements[0].m_type, ScType::ConstNode);
+  EXPECT_EQ(image.GetSystemIdentifier(0), "test_kb_image_identified_node");
+  EXPECT_EQ(elements[1].m_kind, ScKBImage::ElementKind::SystemIdentifierLink);
+  EXPECT_TRUE(elements[1].m_type.IsLink());
+  EXPECT_EQ(elements[2].m_kind, ScKBImage::ElementKind::SystemIdentifierArc);
+  EXPECT_EQ(elements[2].m_type, ScType::ConstCommonArc);
+  EXPECT_EQ(elements[3].m_kind, ScKBImage::ElementKind::SystemIdentifierRelationArc);
+  EXPECT_EQ(elements[3].m_type, ScType::ConstPermPosArc);
+
+  Restart();
+
+  ScAddrVector const & addrs = image.Generate(*m_ctx);
+  ASSERT_EQ(addrs.size(), elements.size());
+  for (size_t i = 0; i < addrs.size(); ++i)
+    EXPECT_EQ(m_ctx->GetElementType(addrs[i]), elements[i].m_type);
+}
+
+TEST_F(ScKBImageTest, CaptureNotIdentifiedIncidentElement)
+{
+  ScAddr const & nodeAddr = m_ctx->GenerateNode(ScType::ConstNode);
+  ScAddr const & arcAddr = m_ctx->GenerateConnector(ScType::ConstPermPosArc, ScKeynodes::action, nodeAddr);
+
+  EXPECT_THROW(ScKBImage::Capture(*m_ctx, {arcAddr}), utils::ExceptionInvalidState);
+}
+
+TEST_F(ScKBImageTest, Merge)
+{
+  ScAddr const & classAddr = m_ctx->GenerateNode(ScType::ConstNode);
+  m_ctx->SetElementSystemIdentifier("test_kb_image_class", classAddr);
+  ScAddr const & firstNodeAddr = m_ctx->GenerateNode(ScType::ConstNode);
+  ScAddr const & firstArcAddr = m_ctx->GenerateConnector(ScType::ConstPermPosArc, classAddr, firstNodeAddr);
+  ScKBImage image = ScKBImage::Capture(*m_ctx, {classAddr, firstNodeAddr, firstArcAddr});
+
+  m_ctx->SetElementSubtype(classAddr, ScType::ConstNodeClass);
+  ScAddr const & secondNodeAddr = m_ctx->GenerateNode(ScType::ConstNode);
+  ScAddr const & secondArcAddr = m_ctx->GenerateConnector(ScType::ConstPermPosArc, classAddr, secondNodeAddr);
+  // class is external sc-element in this image
+  ScKBImage const & otherImage = ScKBImage::Capture(*m_ctx, {secondNodeAddr, secondArcAddr});
+
+  image.Merge(otherImage);
+  // class with its system identifier quintuple and 2 nodes with sc-arcs
+  EXPECT_EQ(image.GetElements().size(), 8u);
+
+  Restart();
+
+  image.Generate(*m_ctx);
+
+  ScAddr const & loadedClassAddr = m_ctx->SearchElementBySystemIdentifier("test_kb_image_class");
+  EXPECT_EQ(m_ctx->GetElementType(loadedClassAddr), ScType::ConstNodeClass);
+  EXPECT_EQ(m_ctx->GetElementEdgesAndOutgoingArcsCount(loadedClassAddr), 3u);
+}
+
+TEST_F(ScKBImageTest, MergeIncompatibleTypes)
+{
+  ScAddr const & nodeAddr = m_ctx->GenerateNode(ScType::ConstNodeClass);
+  m_ctx->SetElementSystemIdentifier("test_kb_image_node", nodeAddr);
+  ScKBImage image = ScKBImage::Capture(*m_ctx, {nodeAddr});
+
+  Restart();
+
+  ScAddr const & otherNodeAddr = m_ctx->GenerateNode(ScType::ConstNodeRole);
+  m_ctx->SetElementSystemIdentifier("test_kb_image_node", otherNodeAddr);
+  ScKBImage const & otherImage = ScKBImage::Capture(*m_ctx, {otherNodeAddr});
+
+  EXPECT_THROW(image.Merge(otherImage), utils::ExceptionInvalidType);
+}
+
+TEST_F(ScKBImageTest, LoadCorruptedImage)
+{
+  ScAddr const & linkAddr = m_ctx->GenerateLink(ScType::ConstNodeLink);
+  m_ctx->SetLinkContent(linkAddr, "test_kb_image_content");
+  ScKBImage::Capture(*m_ctx, {linkAddr}).Save(IMAGE_PATH);
+
+  std::string data;
+  {
+    std::ifstream file(IMAGE_PATH, std::ios::binary);
+    data.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+  }
+
+  auto const & writeImage = [](std::string const & imageData)
+  {
+    std::ofstream file(IMAGE_PATH, std::ios::binary | std::ios::trunc);
+    file << imageData;
+  };
+
+  ScKBImage image;
+
+  std::string corruptedData = data;
+  corruptedData.back() ^= 1;
+  writeImage(corruptedData);
+  EXPECT_THROW(image.Load(IMAGE_PATH), utils::ExceptionInvalidState);
+
+  writeImage(data.substr(0, data.size() - 1));
+  EXPECT_THROW(image.Load(IMAGE_PATH), utils::ExceptionInvalidState);
+
+  writeImage("not-a-kb-image");
+  EXPECT_THROW(image.Load(IMAGE_PATH), utils::ExceptionInvalidState);
+
+  EXPECT_THROW(image.Load("unknown.image"), utils::ExceptionInvalidState);
+
+  writeImage(data);
+  image.Load(IMAGE_PATH);
+  EXPECT_EQ(image.GetElements().size(), 1u);
+  EXPECT_EQ(image.GetLinkContent(0), "test_kb_image_content");
+}
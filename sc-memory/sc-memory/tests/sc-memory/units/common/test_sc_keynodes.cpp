@@ -11,6 +11,39 @@
 
 using ScKeynodesTest = ScMemoryTest;
 
+class TestInitializedKeynode : public ScKeynode
+{
+public:
+  using ScKeynode::ScKeynode;
+
+  static inline size_t initializationsCount = 0;
+
+protected:
+  void Initialize(ScMemoryContext * context) override
+  {
+    ScKeynode::Initialize(context);
+    ++initializationsCount;
+  }
+
+  bool IsBatchResolvable() const override
+  {
+    return false;
+  }
+};
+
+class TestRegisteredKeynodes : public ScKeynodes
+{
+public:
+  static inline TestInitializedKeynode const test_initialized_class{"test_initialized_class", ScType::ConstNodeClass};
+  static inline ScKeynode const test_registered_class{"test_registered_class", ScType::ConstNodeClass};
+  static inline ScKeynode const test_registered_class_copy{"test_registered_class", ScType::ConstNodeClass};
+  static inline ScKeynode const test_registered_relation{"test_registered_relation", ScType::ConstNodeNonRole};
+  static inline ScTemplateKeynode const & test_registered_template =
+      ScTemplateKeynode("test_registered_template")
+          .Triple(test_registered_class, ScType::VarPermPosArc, ScType::VarNode >> "_node")
+          .Triple(test_registered_relation, ScType::VarPermPosArc, "_node");
+};
+
 TEST_F(ScKeynodesTest, CoreKeynodes)
 {
   EXPECT_TRUE(ScKeynodes::nrel_inclusion.IsValid());
@@ -248,3 +281,35 @@ TEST_F(ScKeynodesTest, Cache)
   EXPECT_FALSE(cache.GetKeynode("other").IsValid());
   EXPECT_FALSE(cache.GetKeynode("any_idtf").IsValid());
 }
+
+TEST_F(ScKeynodesTest, RegisteredKeynodes)
+{
+  EXPECT_TRUE(TestRegisteredKeynodes::test_registered_class.IsValid());
+  EXPECT_EQ(TestRegisteredKeynodes::test_registered_class, TestRegisteredKeynodes::test_registered_class_copy);
+  EXPECT_EQ(m_ctx->GetElementType(TestRegisteredKeynodes::test_registered_class), ScType::ConstNodeClass);
+  EXPECT_EQ(
+      m_ctx->SearchElementBySystemIdentifier("test_registered_class"), TestRegisteredKeynodes::test_registered_class);
+
+  EXPECT_TRUE(TestRegisteredKeynodes::test_registered_relation.IsValid());
+  EXPECT_EQ(m_ctx->GetElementType(TestRegisteredKeynodes::test_registered_relation), ScType::ConstNodeNonRole);
+
+  // sc-template keynode is built from keynodes resolved before it
+  ScAddr const & nodeAddr = m_ctx->GenerateNode(ScType::ConstNode);
+  m_ctx->GenerateConnector(ScType::ConstPermPosArc, TestRegisteredKeynodes::test_registered_class, nodeAddr);
+  m_ctx->GenerateConnector(ScType::ConstPermPosArc, TestRegisteredKeynodes::test_registered_relation, nodeAddr);
+
+  ScTemplate templ;
+  m_ctx->BuildTemplate(templ, TestRegisteredKeynodes::test_registered_template);
+
+  ScTemplateSearchResult result;
+  EXPECT_TRUE(m_ctx->SearchByTemplate(templ, result));
+  EXPECT_EQ(result.Size(), 1u);
+  EXPECT_EQ(result[0]["_node"], nodeAddr);
+}
+
+TEST_F(ScKeynodesTest, RegisteredKeynodeWithOwnInitialization)
+{
+  EXPECT_GT(TestInitializedKeynode::initializationsCount, 0u);
+  EXPECT_TRUE(TestRegisteredKeynodes::test_initialized_class.IsValid());
+  EXPECT_EQ(m_ctx->GetElementType(TestRegisteredKeynodes::test_initialized_class), ScType::ConstNodeClass);
+}
@@ -10,6 +10,11 @@
 
 #include <algorithm>
 
+extern "C"
+{
+#include <sc-core/sc_memory.h>
+}
+
 using ScMemoryAPITest = ScMemoryTest;
 
 TEST_F(ScMemoryAPITest, ScMemory)
@@ -107,6 +112,90 @@ TEST_F(ScMemoryAPITest, SetGetSystemIdentifierErrorSetTwice)
   EXPECT_FALSE(m_ctx->SetElementSystemIdentifier("test_node", otherAddr));
 }
 
+TEST_F(ScMemoryAPITest, FindSystemIdentifierAfterElementErased)
+{
+  ScAddr const & addr = m_ctx->GenerateNode(ScType::ConstNode);
+  EXPECT_TRUE(m_ctx->SetElementSystemIdentifier("test_node", addr));
+  EXPECT_EQ(m_ctx->SearchElementBySystemIdentifier("test_node"), addr);
+
+  EXPECT_TRUE(m_ctx->EraseElement(addr));
+  ScAddr foundAddr;
+  EXPECT_FALSE(m_ctx->SearchElementBySystemIdentifier("test_node", foundAddr));
+
+  // sc-addresses of erased sc-elements can be reused by new ones, but they aren't found by erased system identifier
+  ScAddr const & otherAddr = m_ctx->GenerateNode(ScType::ConstNode);
+  m_ctx->GenerateConnector(ScType::ConstCommonArc, otherAddr, m_ctx->GenerateLink(ScType::ConstNodeLink));
+  EXPECT_FALSE(m_ctx->SearchElementBySystemIdentifier("test_node", foundAddr));
+
+  EXPECT_TRUE(m_ctx->SetElementSystemIdentifier("test_node", otherAddr));
+  EXPECT_EQ(m_ctx->SearchElementBySystemIdentifier("test_node"), otherAddr);
+}
+
+TEST_F(ScMemoryAPITest, FindSystemIdentifierAfterLinkErased)
+{
+  ScAddr const & addr = m_ctx->GenerateNode(ScType::ConstNode);
+  ScSystemIdentifierQuintuple quintuple;
+  EXPECT_TRUE(m_ctx->SetElementSystemIdentifier("test_node", addr, quintuple));
+  EXPECT_EQ(m_ctx->SearchElementBySystemIdentifier("test_node"), addr);
+
+  EXPECT_TRUE(m_ctx->EraseElement(quintuple.addr3));
+  ScAddr foundAddr;
+  EXPECT_FALSE(m_ctx->SearchElementBySystemIdentifier("test_node", foundAddr));
+  EXPECT_EQ(m_ctx->GetElementSystemIdentifier(addr), "");
+}
+
+TEST_F(ScMemoryAPITest, FindSystemIdentifierAfterLinkContentChanged)
+{
+  ScAddr const & addr = m_ctx->GenerateNode(ScType::ConstNode);
+  ScSystemIdentifierQuintuple quintuple;
+  EXPECT_TRUE(m_ctx->SetElementSystemIdentifier("test_node", addr, quintuple));
+  EXPECT_EQ(m_ctx->SearchElementBySystemIdentifier("test_node"), addr);
+
+  EXPECT_TRUE(m_ctx->SetLinkContent(quintuple.addr3, "other_test_node"));
+  ScAddr foundAddr;
+  EXPECT_FALSE(m_ctx->SearchElementBySystemIdentifier("test_node", foundAddr));
+
+  for (size_t i = 0; i < 2; ++i)
+  {
+    ScSystemIdentifierQuintuple foundQuintuple;
+    EXPECT_TRUE(m_ctx->SearchElementBySystemIdentifier("other_test_node", foundQuintuple));
+    EXPECT_EQ(foundQuintuple.addr1, quintuple.addr1);
+    EXPECT_EQ(foundQuintuple.addr2, quintuple.addr2);
+    EXPECT_EQ(foundQuintuple.addr3, quintuple.addr3);
+    EXPECT_EQ(foundQuintuple.addr4, quintuple.addr4);
+    EXPECT_EQ(foundQuintuple.addr5, quintuple.addr5);
+  }
+}
+
+TEST_F(ScMemoryAPITest, ChangeIdentifiersVersionBySystemIdentifiersOnly)
+{
+  ScAddr const & addr = m_ctx->GenerateNode(ScType::ConstNode);
+  ScSystemIdentifierQuintuple quintuple;
+  EXPECT_TRUE(m_ctx->SetElementSystemIdentifier("test_node", addr, quintuple));
+  EXPECT_EQ(m_ctx->SearchElementBySystemIdentifier("test_node"), addr);
+
+  // sc-elements and sc-links without system identifiers don't invalidate found system identifiers
+  sc_uint32 const version = sc_memory_get_identifiers_version();
+  ScAddr const & linkAddr = m_ctx->GenerateLink(ScType::ConstNodeLink);
+  m_ctx->GenerateConnector(ScType::ConstCommonArc, addr, linkAddr);
+  EXPECT_TRUE(m_ctx->SetLinkContent(linkAddr, "test_content"));
+  EXPECT_TRUE(m_ctx->EraseElement(linkAddr));
+  EXPECT_TRUE(m_ctx->EraseElement(m_ctx->GenerateNode(ScType::ConstNode)));
+  EXPECT_TRUE(m_ctx->SetElementSystemIdentifier("test_other_node", m_ctx->GenerateNode(ScType::ConstNode)));
+  EXPECT_EQ(sc_memory_get_identifiers_version(), version);
+  EXPECT_EQ(m_ctx->SearchElementBySystemIdentifier("test_node"), addr);
+
+  EXPECT_TRUE(m_ctx->SetLinkContent(quintuple.addr3, "test_node"));
+  EXPECT_NE(sc_memory_get_identifiers_version(), version);
+  EXPECT_EQ(m_ctx->SearchElementBySystemIdentifier("test_node"), addr);
+
+  sc_uint32 const changedVersion = sc_memory_get_identifiers_version();
+  EXPECT_TRUE(m_ctx->EraseElement(quintuple.addr2));
+  EXPECT_NE(sc_memory_get_identifiers_version(), changedVersion);
+  ScAddr foundAddr;
+  EXPECT_FALSE(m_ctx->SearchElementBySystemIdentifier("test_node", foundAddr));
+}
+
 TEST_F(ScMemoryAPITest, ResolveGetSystemIdentifier)
 {
   ScAddr const & addr = m_ctx->ResolveElementSystemIdentifier("test_node", ScType::ConstNode);
@@ -142,6 +231,35 @@ TEST_F(ScMemoryAPITest, ResolveGetSystemIdentifierWithOutFiver)
   EXPECT_TRUE(resolveQuintuple.addr5.IsValid());
 }
 
+TEST_F(ScMemoryAPITest, ResolveElementsSystemIdentifiers)
+{
+  ScAddr const & addr = m_ctx->GenerateNode(ScType::ConstNodeClass);
+  EXPECT_TRUE(m_ctx->SetElementSystemIdentifier("test_class", addr));
+
+  std::vector<ScSystemIdentifierQuintuple> const & quintuples = m_ctx->ResolveElementsSystemIdentifiers(
+      {{"test_relation", ScType::ConstNodeNonRole},
+       {"test_class", ScType::ConstNodeClass},
+       {"test_relation", ScType::ConstNodeRole},
+       {"test_unknown", ScType::Unknown}});
+  ASSERT_EQ(quintuples.size(), 4u);
+
+  EXPECT_EQ(quintuples[1].addr1, addr);
+
+  // the same system identifier is resolved once with the first specified sc-type
+  EXPECT_TRUE(quintuples[0].addr1.IsValid());
+  EXPECT_EQ(quintuples[0].addr1, quintuples[2].addr1);
+  EXPECT_EQ(quintuples[0].addr3, quintuples[2].addr3);
+  EXPECT_EQ(m_ctx->GetElementType(quintuples[0].addr1), ScType::ConstNodeNonRole);
+  EXPECT_EQ(m_ctx->SearchElementBySystemIdentifier("test_relation"), quintuples[0].addr1);
+
+  EXPECT_FALSE(quintuples[3].addr1.IsValid());
+  ScAddr foundAddr;
+  EXPECT_FALSE(m_ctx->SearchElementBySystemIdentifier("test_unknown", foundAddr));
+
+  EXPECT_TRUE(m_ctx->ResolveElementsSystemIdentifiers({}).empty());
+  EXPECT_THROW(m_ctx->ResolveElementsSystemIdentifiers({{"****", ScType::ConstNode}}), utils::ExceptionInvalidParams);
+}
+
 SC_PRAGMA_DISABLE_DEPRECATION_WARNINGS_BEGIN
 
 TEST_F(ScMemoryAPITest, CreateNode_Deprecated)
@@ -659,3 +777,87 @@ TEST_F(ScMemoryAPITest, CalculateStat_Deprecated)
 }
 
 SC_PRAGMA_DISABLE_DEPRECATION_WARNINGS_END
+
+TEST_F(ScMemoryAPITest, CalculateStatisticsIncrementally)
+{
+  auto const & ExpectStatisticsCollected = [this]()
+  {
+    sc_stat collectedStat;
+    EXPECT_EQ(sc_memory_collect_stat(**m_ctx, &collectedStat), SC_RESULT_OK);
+
+    ScMemoryContext::ScMemoryStatistics const & stat = m_ctx->CalculateStatistics();
+    EXPECT_EQ(stat.m_nodesNum, collectedStat.node_count);
+    EXPECT_EQ(stat.m_linksNum, collectedStat.link_count);
+    EXPECT_EQ(stat.m_connectorsNum, collectedStat.connector_count);
+  };
+
+  ExpectStatisticsCollected();
+  ScMemoryContext::ScMemoryStatistics const & initialStat = m_ctx->CalculateStatistics();
+
+  ScAddr const & nodeAddr = m_ctx->GenerateNode(ScType::ConstNode);
+  ScAddr const & linkAddr = m_ctx->GenerateLink(ScType::ConstNodeLink);
+  m_ctx->GenerateConnector(ScType::ConstPermPosArc, nodeAddr, linkAddr);
+  m_ctx->GenerateConnector(ScType::ConstCommonEdge, linkAddr, nodeAddr);
+  EXPECT_TRUE(m_ctx->SetElementSubtype(nodeAddr, ScType::ConstNodeClass));
+
+  ScMemoryContext::ScMemoryStatistics const & stat = m_ctx->CalculateStatistics();
+  EXPECT_EQ(stat.m_nodesNum, initialStat.m_nodesNum + 2);
+  EXPECT_EQ(stat.m_linksNum, initialStat.m_linksNum + 1);
+  EXPECT_EQ(stat.m_connectorsNum, initialStat.m_connectorsNum + 2);
+  ExpectStatisticsCollected();
+
+  // incident sc-connectors are erased with sc-element
+  EXPECT_TRUE(m_ctx->EraseElement(nodeAddr));
+  ScMemoryContext::ScMemoryStatistics const & erasedStat = m_ctx->CalculateStatistics();
+  EXPECT_EQ(erasedStat.m_nodesNum, initialStat.m_nodesNum + 1);
+  EXPECT_EQ(erasedStat.m_linksNum, initialStat.m_linksNum + 1);
+  EXPECT_EQ(erasedStat.m_connectorsNum, initialStat.m_connectorsNum);
+  ExpectStatisticsCollected();
+}
+
+TEST_F(ScMemoryAPITest, EraseElements)
+{
+  ScMemoryContext::ScMemoryStatistics const & initialStat = m_ctx->CalculateStatistics();
+
+  ScAddr const & setAddr = m_ctx->GenerateNode(ScType::ConstNode);
+  ScAddr const & keptNodeAddr = m_ctx->GenerateNode(ScType::ConstNode);
+
+  ScAddrVector elementAddrs;
+  ScAddrVector connectorAddrs;
+  for (size_t i = 0; i < 100; ++i)
+  {
+    ScAddr const & nodeAddr = m_ctx->GenerateNode(ScType::ConstNode);
+    elementAddrs.push_back(nodeAddr);
+    connectorAddrs.push_back(m_ctx->GenerateConnector(ScType::ConstPermPosArc, setAddr, nodeAddr));
+    connectorAddrs.push_back(m_ctx->GenerateConnector(ScType::ConstCommonEdge, nodeAddr, keptNodeAddr));
+  }
+  // repeated and already erased sc-elements are skipped
+  elementAddrs.push_back(elementAddrs.front());
+  elementAddrs.push_back(connectorAddrs.front());
+  elementAddrs.push_back(ScAddr::Empty);
+
+  EXPECT_TRUE(m_ctx->EraseElements(elementAddrs));
+
+  for (ScAddr const & addr : elementAddrs)
+    EXPECT_FALSE(m_ctx->IsElement(addr));
+  for (ScAddr const & addr : connectorAddrs)
+    EXPECT_FALSE(m_ctx->IsElement(addr));
+  EXPECT_TRUE(m_ctx->IsElement(setAddr));
+  EXPECT_TRUE(m_ctx->IsElement(keptNodeAddr));
+  EXPECT_EQ(m_ctx->GetElementEdgesAndOutgoingArcsCount(setAddr), 0u);
+  EXPECT_EQ(m_ctx->GetElementEdgesAndIncomingArcsCount(keptNodeAddr), 0u);
+
+  ScMemoryContext::ScMemoryStatistics const & stat = m_ctx->CalculateStatistics();
+  EXPECT_EQ(stat.m_nodesNum, initialStat.m_nodesNum + 2);
+  EXPECT_EQ(stat.m_connectorsNum, initialStat.m_connectorsNum);
+
+  sc_stat collectedStat;
+  EXPECT_EQ(sc_memory_collect_stat(**m_ctx, &collectedStat), SC_RESULT_OK);
+  EXPECT_EQ(stat.m_nodesNum, collectedStat.node_count);
+  EXPECT_EQ(stat.m_connectorsNum, collectedStat.connector_count);
+
+  // erased sc-addresses are reused by new sc-elements
+  ScAddr const & newNodeAddr = m_ctx->GenerateNode(ScType::ConstNode);
+  EXPECT_TRUE(m_ctx->IsElement(newNodeAddr));
+  EXPECT_TRUE(m_ctx->EraseElements({}));
+}
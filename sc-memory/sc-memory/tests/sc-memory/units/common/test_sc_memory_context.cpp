@@ -397,6 +397,22 @@ TEST_F(ScMemoryTestWithUserMode, HandleElementsByGuestUser)
   TestActionsUnsuccessfully(m_ctx, userContext);
 }
 
+TEST_F(ScMemoryTestWithUserMode, BuildTemplateByGuestUserAfterBuildByAuthenticatedUser)
+{
+  ScAddr const & nodeAddr = m_ctx->GenerateNode(ScType::ConstNode);
+  m_ctx->SetElementSystemIdentifier("test_guest_template_node", nodeAddr);
+
+  sc_char const * data = "test_guest_template_node _-> _target;;";
+  ScTemplate templ;
+  m_ctx->BuildTemplate(templ, data);
+  EXPECT_EQ(templ.Size(), 1u);
+
+  // sc-elements resolved for one sc-memory context aren't reused by other one that can't read them
+  TestScMemoryContext userContext;
+  ScTemplate guestTempl;
+  EXPECT_ANY_THROW(userContext.BuildTemplate(guestTempl, data));
+}
+
 void TestSetIdentifiedUser(
     std::unique_ptr<ScAgentContext> const & context,
     ScAddr const & guestUserAddr,
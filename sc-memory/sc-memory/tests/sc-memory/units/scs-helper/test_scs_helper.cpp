@@ -608,6 +608,45 @@ TEST_F(SCsHelperTest, GenerateBySCs_Visibility_Local)
   EXPECT_NE(res[0]["_trg"], res[1]["_trg"]);
 }
 
+TEST_F(SCsHelperTest, GenerateBySCs_IdentifiersCache)
+{
+  ScAddr const & nodeAddr = m_ctx->GenerateNode(ScType::ConstNode);
+  m_ctx->SetElementSystemIdentifier("x_cached", nodeAddr);
+  SCsHelper helper(*m_ctx, std::make_shared<DummyFileInterface>());
+  EXPECT_TRUE(helper.GenerateBySCsText("y_cached -> .z_cached;;"));
+
+  auto const identifiersCache = std::make_shared<SCsIdentifiersCache>();
+  identifiersCache->Load(*m_ctx);
+  EXPECT_GT(identifiersCache->GetSystemIdentifiersNum(), 0u);
+  EXPECT_EQ(identifiersCache->GetGlobalIdentifiersNum(), 1u);
+
+  size_t const systemIdentifiersNum = identifiersCache->GetSystemIdentifiersNum();
+
+  SCsHelper firstHelper(*m_ctx, std::make_shared<DummyFileInterface>(), identifiersCache);
+  EXPECT_TRUE(firstHelper.GenerateBySCsText("x_cached -> .z_cached; w_cached;;"));
+  EXPECT_EQ(identifiersCache->GetSystemIdentifiersNum(), systemIdentifiersNum + 1);
+
+  SCsHelper secondHelper(*m_ctx, std::make_shared<DummyFileInterface>(), identifiersCache);
+  EXPECT_TRUE(secondHelper.GenerateBySCsText("y_cached -> .z_cached;; .v_cached -> x_cached;;"));
+  EXPECT_EQ(identifiersCache->GetGlobalIdentifiersNum(), 2u);
+
+  ScAddr const & wAddr = m_ctx->SearchElementBySystemIdentifier("w_cached");
+  EXPECT_TRUE(m_ctx->CheckConnector(nodeAddr, wAddr, ScType::ConstPermPosArc));
+
+  ScAddr zAddr;
+  ScAddr const & yAddr = m_ctx->SearchElementBySystemIdentifier("y_cached");
+  ScIterator3Ptr const it3 = m_ctx->CreateIterator3(yAddr, ScType::ConstPermPosArc, ScType::Unknown);
+  while (it3->Next())
+  {
+    if (zAddr.IsValid())
+      EXPECT_EQ(it3->Get(2), zAddr);
+    zAddr = it3->Get(2);
+  }
+  EXPECT_TRUE(m_ctx->CheckConnector(nodeAddr, zAddr, ScType::ConstPermPosArc));
+  EXPECT_EQ(m_ctx->GetElementEdgesAndIncomingArcsCount(zAddr), 3u);
+  EXPECT_EQ(m_ctx->GetElementEdgesAndIncomingArcsCount(nodeAddr), 1u);
+}
+
 TEST_F(SCsHelperTest, GenerateAppendToStructure)
 {
   SCsHelper helper(*m_ctx, std::make_shared<DummyFileInterface>());
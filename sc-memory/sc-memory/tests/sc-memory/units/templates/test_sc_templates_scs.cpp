@@ -117,3 +117,68 @@ TEST_F(ScTemplateSCsTest, IdtfNotExist)
   ScTemplate templ;
   EXPECT_THROW(m_ctx->BuildTemplate(templ, "non_existing_item _-> _z;;"), utils::ExceptionInvalidState);
 }
+
+TEST_F(ScTemplateSCsTest, BuildCachedTranslation)
+{
+  ScAddr const addr = m_ctx->GenerateNode(ScType::ConstNode);
+  EXPECT_TRUE(m_ctx->SetElementSystemIdentifier("cached_class", addr));
+  ScAddr const nodeAddr = m_ctx->GenerateNode(ScType::ConstNode);
+  m_ctx->GenerateConnector(ScType::ConstPermPosArc, addr, nodeAddr);
+
+  sc_char const * data = "cached_class _-> _node;;";
+  for (size_t i = 0; i < 3; ++i)
+  {
+    ScTemplate templ;
+    m_ctx->BuildTemplate(templ, data);
+    EXPECT_EQ(templ.Size(), 1u);
+
+    ScTemplateSearchResult searchResult;
+    EXPECT_TRUE(m_ctx->SearchByTemplate(templ, searchResult));
+    EXPECT_EQ(searchResult.Size(), 1u);
+    EXPECT_EQ(searchResult[0]["cached_class"], addr);
+    EXPECT_EQ(searchResult[0]["_node"], nodeAddr);
+  }
+}
+
+TEST_F(ScTemplateSCsTest, BuildCachedTranslationAfterIdentifierErased)
+{
+  ScAddr const addr = m_ctx->GenerateNode(ScType::ConstNode);
+  EXPECT_TRUE(m_ctx->SetElementSystemIdentifier("cached_erased_class", addr));
+
+  sc_char const * data = "cached_erased_class _-> _node;;";
+  ScTemplate templ;
+  m_ctx->BuildTemplate(templ, data);
+
+  EXPECT_TRUE(m_ctx->EraseElement(addr));
+  ScTemplate otherTempl;
+  EXPECT_THROW(m_ctx->BuildTemplate(otherTempl, data), utils::ExceptionInvalidState);
+
+  ScAddr const otherAddr = m_ctx->GenerateNode(ScType::ConstNode);
+  EXPECT_TRUE(m_ctx->SetElementSystemIdentifier("cached_erased_class", otherAddr));
+  ScAddr const nodeAddr = m_ctx->GenerateNode(ScType::ConstNode);
+  m_ctx->GenerateConnector(ScType::ConstPermPosArc, otherAddr, nodeAddr);
+
+  ScTemplate newTempl;
+  m_ctx->BuildTemplate(newTempl, data);
+  ScTemplateSearchResult searchResult;
+  EXPECT_TRUE(m_ctx->SearchByTemplate(newTempl, searchResult));
+  EXPECT_EQ(searchResult.Size(), 1u);
+  EXPECT_EQ(searchResult[0]["_node"], nodeAddr);
+}
+
+TEST_F(ScTemplateSCsTest, BuildCachedTranslationAfterIdentifierSet)
+{
+  sc_char const * data = "_cached_node _-> _other_node;;";
+  ScTemplate templ;
+  m_ctx->BuildTemplate(templ, data);
+
+  ScAddr const addr = m_ctx->GenerateNode(ScType::ConstNode);
+  EXPECT_TRUE(m_ctx->SetElementSystemIdentifier("_cached_node", addr));
+
+  // variable is replaced by sc-element found by its system identifier
+  ScTemplate newTempl;
+  m_ctx->BuildTemplate(newTempl, data);
+  ScTemplateGenResult genResult;
+  m_ctx->GenerateByTemplate(newTempl, genResult);
+  EXPECT_EQ(genResult["_cached_node"], addr);
+}
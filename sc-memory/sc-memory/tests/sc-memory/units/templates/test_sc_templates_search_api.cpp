@@ -296,6 +296,54 @@ TEST_F(ScTemplateSearchApiTest, SearchVarTriple)
   EXPECT_EQ(count, 0u);
 }
 
+TEST_F(ScTemplateSearchApiTest, SearchVarTripleSubstitutedByParams)
+{
+  ScAddr const & addr1 = m_ctx->GenerateNode(ScType::ConstNode);
+  ScAddr const & addr2 = m_ctx->GenerateNode(ScType::ConstNode);
+  ScAddr const & addr3 = m_ctx->GenerateNode(ScType::ConstNode);
+  ScAddr const & arcAddr = m_ctx->GenerateConnector(ScType::ConstPermPosArc, addr1, addr2);
+  m_ctx->GenerateConnector(ScType::ConstPermPosArc, addr1, addr3);
+  m_ctx->GenerateConnector(ScType::ConstPermPosArc, addr3, addr2);
+
+  ScTemplate templ;
+  templ.Triple(ScType::Unknown >> "_addr1", ScType::VarPermPosArc >> "_arc", ScType::Unknown >> "_addr2");
+  templ.Triple("_addr2", ScType::VarPermPosArc, ScType::Unknown >> "_addr3");
+
+  ScTemplateParams params;
+  params.Add("_addr1", addr1).Add("_addr2", addr2);
+
+  ScTemplate substitutedTempl;
+  templ.Substitute(params, substitutedTempl);
+  EXPECT_EQ(substitutedTempl.Size(), templ.Size());
+
+  ScTemplateSearchResult result;
+  EXPECT_FALSE(m_ctx->SearchByTemplate(substitutedTempl, result));
+
+  m_ctx->GenerateConnector(ScType::ConstPermPosArc, addr2, addr3);
+  EXPECT_TRUE(m_ctx->SearchByTemplate(substitutedTempl, result));
+  EXPECT_EQ(result.Size(), 1u);
+  EXPECT_EQ(result[0]["_addr1"], addr1);
+  EXPECT_EQ(result[0]["_arc"], arcAddr);
+  EXPECT_EQ(result[0]["_addr2"], addr2);
+  EXPECT_EQ(result[0]["_addr3"], addr3);
+}
+
+TEST_F(ScTemplateSearchApiTest, SubstituteIntoNotEmptyTemplate)
+{
+  ScAddr const & addr = m_ctx->GenerateNode(ScType::ConstNode);
+
+  ScTemplate templ;
+  templ.Triple(ScType::VarNode >> "_addr1", ScType::VarPermPosArc, ScType::VarNode);
+
+  ScTemplateParams params;
+  params.Add("_addr1", addr);
+
+  ScTemplate substitutedTempl;
+  substitutedTempl.Triple(addr, ScType::VarPermPosArc, ScType::VarNode);
+  EXPECT_THROW(templ.Substitute(params, substitutedTempl), utils::ExceptionInvalidParams);
+  EXPECT_EQ(substitutedTempl.Size(), 1u);
+}
+
 TEST_F(ScTemplateSearchApiTest, SearchEmpty)
 {
   ScTemplate templ;
@@ -0,0 +1,165 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include <gtest/gtest.h>
+
+#include "test_scs_utils.hpp"
+
+namespace
+{
+
+class TestParser : public scs::Parser
+{
+public:
+  using scs::Parser::ParseByANTLR;
+};
+
+void CheckParsedElementsEqual(
+    scs::Parser const & parser,
+    scs::ElementHandle const & handle,
+    scs::Parser const & expectedParser,
+    scs::ElementHandle const & expectedHandle)
+{
+  EXPECT_EQ(handle.GetVisibility(), expectedHandle.GetVisibility());
+
+  scs::ParsedElement const & element = parser.GetParsedElement(handle);
+  scs::ParsedElement const & expectedElement = expectedParser.GetParsedElement(expectedHandle);
+  EXPECT_EQ(element.GetIdtf(), expectedElement.GetIdtf());
+  EXPECT_EQ(element.GetType(), expectedElement.GetType());
+  EXPECT_EQ(element.GetValue(), expectedElement.GetValue());
+  EXPECT_EQ(element.IsURL(), expectedElement.IsURL());
+  EXPECT_EQ(element.IsReversed(), expectedElement.IsReversed());
+}
+
+void CheckParsersEqual(std::string const & data)
+{
+  SCOPED_TRACE(data);
+
+  scs::Parser parser;
+  EXPECT_TRUE(parser.Parse(data));
+
+  TestParser expectedParser;
+  EXPECT_TRUE(expectedParser.ParseByANTLR(data));
+
+  auto const & triples = parser.GetParsedTriples();
+  auto const & expectedTriples = expectedParser.GetParsedTriples();
+  ASSERT_EQ(triples.size(), expectedTriples.size());
+  for (size_t i = 0; i < triples.size(); ++i)
+  {
+    CheckParsedElementsEqual(parser, triples[i].m_source, expectedParser, expectedTriples[i].m_source);
+    CheckParsedElementsEqual(parser, triples[i].m_connector, expectedParser, expectedTriples[i].m_connector);
+    CheckParsedElementsEqual(parser, triples[i].m_target, expectedParser, expectedTriples[i].m_target);
+  }
+
+  auto const & aliases = parser.GetAliases();
+  auto const & expectedAliases = expectedParser.GetAliases();
+  ASSERT_EQ(aliases.size(), expectedAliases.size());
+  for (auto const & [alias, expectedHandle] : expectedAliases)
+  {
+    auto const it = aliases.find(alias);
+    ASSERT_NE(it, aliases.cend());
+    CheckParsedElementsEqual(parser, it->second, expectedParser, expectedHandle);
+  }
+}
+
+}  // namespace
+
+TEST(scs_fast_parser, level_1)
+{
+  CheckParsersEqual(
+      "sc_node_class#a | sc_arc_main#_arc | sc_node#b;;"
+      "sc_node#b | sc_common_edge#_edge | sc_node#c;;");
+}
+
+TEST(scs_fast_parser, connectors)
+{
+  CheckParsersEqual(
+      "a -> b; => c; <- d; <= e; _-> _f; _=> _g; -|> h; ~> i; ..> j; /> k; ?-> l; <|- m;;"
+      "x < _y; <=_ y1; <-_ y2; <|-_ y3; </_ y4; <~_ y5; <|~_ y6; > z; <> w;;");
+}
+
+TEST(scs_fast_parser, attributes)
+{
+  CheckParsersEqual(
+      "a -> rrel_1: rrel_2:: b; c;;"
+      "d => nrel_idtf: [content] (* <- lang_en;; *);;");
+}
+
+TEST(scs_fast_parser, internal_sentences)
+{
+  CheckParsersEqual(
+      "a -> b (* <- c;; => nrel_x: d (* -> e;; *);; *); f (* <- g;; *);;"
+      "(a -> b) => (c <- (d -> e));;");
+}
+
+TEST(scs_fast_parser, contents_and_links)
+{
+  CheckParsersEqual(
+      "a => nrel_idtf: [] ; [text \\] with \\[ escaped \\\\ symbols]; ![class content]!; \"file://file.txt\";;"
+      "b = [content];;"
+      "c = \"file://image.png\";;"
+      "_d = [*\n  e -> f;;\n  g => h: [*  i <- j;; *];;\n*];;");
+}
+
+TEST(scs_fast_parser, sets_and_contours)
+{
+  CheckParsersEqual(
+      "a -> {b; rrel_1: d; e: _f (* <- g;; *)};;"
+      "k -> [* l -> m;; n <- {o; p};; *];;"
+      "[**] -> q;;");
+}
+
+TEST(scs_fast_parser, aliases)
+{
+  CheckParsersEqual(
+      "@a = (b -> c);;"
+      "@d = [content];;"
+      "@a <- e;;"
+      "@f = @a;;"
+      "@f => nrel_x: @d;;"
+      "@_g = _h;;");
+}
+
+TEST(scs_fast_parser, comments)
+{
+  CheckParsersEqual(
+      "// Comment\n"
+      "a -> b;; /* Multiline\n comment */\n"
+      "c\r\n  <- d; /* Comment in sentence */ e;;");
+}
+
+TEST(scs_fast_parser, unsupported_vectors)
+{
+  char const * data = "a -> <b; c>;;";
+
+  scs::Parser parser;
+  EXPECT_TRUE(parser.Parse(data));
+  EXPECT_EQ(parser.GetParsedTriples().size(), 6u);
+}
+
+TEST(scs_fast_parser, errors)
+{
+  for (std::string const & data :
+       {"a -> b;", "a -> @b;;", "a -> [b;;", "a -> [* b -> c;; ;;", "a -> (b -> c;;", "a -> b c;;"})
+  {
+    SCOPED_TRACE(data);
+
+    scs::Parser parser;
+    EXPECT_FALSE(parser.Parse(data));
+    EXPECT_FALSE(parser.GetParseError().empty());
+  }
+}
+
+TEST(scs_fast_parser, parse_twice)
+{
+  scs::Parser parser;
+  EXPECT_TRUE(parser.Parse("a -> b;;"));
+  EXPECT_TRUE(parser.Parse("c -> d;;"));
+
+  auto const & triples = parser.GetParsedTriples();
+  EXPECT_EQ(triples.size(), 2u);
+  EXPECT_EQ(parser.GetParsedElement(triples[1].m_source).GetIdtf(), "c");
+}
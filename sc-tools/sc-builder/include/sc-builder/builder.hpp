@@ -9,9 +9,12 @@
 #include "sc-memory/sc_memory.hpp"
 
 #include <string>
+#include <vector>
 
 #include "translator.hpp"
 #include "sc_repo_path_collector.hpp"
+#include "sc_build_manifest.hpp"
+#include "sc_build_profile.hpp"
 
 struct BuilderParams
 {
@@ -23,10 +26,23 @@ struct BuilderParams
   std::string m_resultStructureSystemIdtf;
   //! Flag to create result structure
   sc_bool m_resultStructureUpload = SC_FALSE;
+  //! Number of threads parsing sources while previous sources are generated in memory
+  size_t m_parseThreadsNum = 1;
+  //! Flag to translate only changed sources and sources depending on them
+  sc_bool m_incremental = SC_FALSE;
+  //! If it isn't empty, then knowledge base image is saved into this file after build
+  std::string m_imagePath;
+  //! If it isn't empty, then build profile is saved into this file after build
+  std::string m_profilePath;
 };
 
 class Builder
 {
+  //! Number of sources that can be parsed by one thread ahead of source generated in memory
+  static size_t const PARSED_SOURCES_PER_THREAD = 4;
+  //! Number of sources that can be read by one thread ahead of source generated in memory
+  static size_t const READ_SOURCES_PER_THREAD = 16;
+
 public:
   Builder();
 
@@ -37,12 +53,35 @@ protected:
   std::unique_ptr<ScMemoryContext> m_ctx;
   ScRepoPathCollector m_collector;
   std::unordered_map<std::string, std::shared_ptr<Translator>> m_translators;
+  std::unique_ptr<ScBuildManifest> m_manifest;
+  ScBuildManifest::SourcesHashes m_sourcesHashes;
+  //! Sc-elements generated from all sources, they are collected to save knowledge base image without manifest
+  ScAddrVector m_generatedElements;
+  ScBuildProfile m_profile;
 
   ScAddr ResolveOutputStructure();
 
   bool BuildSources(ScRepoPathCollector::Sources const & buildSources, ScAddr const & outputStructure);
 
-  bool ProcessFile(std::string const & filename, ScAddr const & outputStructure);
+  std::shared_ptr<Translator> const & GetTranslator(std::string const & fileName) const;
+
+  std::vector<std::string> EraseChangedSources(std::vector<std::string> const & sources);
+
+  void UpdateManifestSource(
+      std::string const & fileName,
+      scs::Parser const & parser,
+      ScAddrVector const & generatedElements);
+
+  /*! Checks that sc-elements from manifest are the same ones that have been generated from sources during previous
+   * build: they have the same types and incident sc-elements, and system identifiers defined by sources belong to them.
+   * @return If sc-addresses of sc-elements from manifest aren't reused by other sc-elements, then returns true;
+   * otherwise returns false.
+   */
+  bool CheckManifestElements() const;
+
+  void CompleteManifest();
+
+  void SaveImage();
 
   void DumpStatistics();
 };
@@ -7,9 +7,15 @@
 #pragma once
 
 #include <string>
+#include <memory>
 
 #include <sc-memory/sc_addr.hpp>
 
+namespace scs
+{
+class Parser;
+}
+
 class Translator
 {
 public:
@@ -21,6 +27,10 @@ public:
     bool m_autoFormatInfo;
     //! output structure
     ScAddr m_outputStructure;
+    //! If it isn't null, then all sc-elements generated from file are appended to it
+    ScAddrVector * m_generatedElements = nullptr;
+    //! If it isn't null, then it is parsed instead of file content, so file can be read ahead of parsing
+    std::string const * m_fileContent = nullptr;
   };
 
   explicit Translator(class ScMemoryContext & context);
@@ -33,13 +43,34 @@ public:
   bool Translate(Params const & params);
 
   //! Implementation of translate
-  virtual bool TranslateImpl(Params const & params) = 0;
+  virtual bool TranslateImpl(Params const & params);
+
+  /*! Parse specified file without access to sc-memory. It can be called from several threads simultaneously.
+   * @param params Input parameters
+   * @return Returns parser with parsed file content. Throws utils::ExceptionParseError if file can't be parsed.
+   */
+  virtual std::unique_ptr<scs::Parser> Parse(Params const & params) const = 0;
+
+  /*! Generate parsed file content in memory
+   * @param params Input parameters
+   * @param parser Parser returned by `Parse` for the same parameters
+   * @return If file content generated without any errors, then returns true; otherwise returns false.
+   */
+  virtual bool Generate(Params const & params, scs::Parser const & parser) = 0;
 
   static void Clean(ScMemoryContext & ctx);
 
-protected:
+  /*! Reads whole file content.
+   * @throws utils::ExceptionInvalidState if file can't be read.
+   */
   static void GetFileContent(std::string const & fileName, std::string & outContent);
 
+protected:
+  /*! Gets content of file to translate. It is content read ahead of parsing, if it is specified in parameters,
+   * otherwise it is read into buffer.
+   */
+  static std::string const & GetFileContent(Params const & params, std::string & buffer);
+
   //! Pointer to memory context
   class ScMemoryContext & m_ctx;
 };
@@ -8,6 +8,17 @@
 
 #include <memory>
 #include <fstream>
+#include <algorithm>
+#include <set>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <tuple>
+
+#include <sc-memory/sc_kb_image.hpp>
+#include <sc-memory/sc_timer.hpp>
+
+#include <sc-memory/scs/scs_parser.hpp>
 
 #include "scs_translator.hpp"
 #include "gwf_translator.hpp"
@@ -18,9 +29,39 @@ bool Builder::Run(BuilderParams const & params, sc_memory_params const & memoryP
 {
   m_params = params;
 
-  if (!ScMemory::Initialize(memoryParams))
+  sc_memory_params builderMemoryParams = memoryParams;
+  if (m_params.m_incremental)
+  {
+    m_manifest = std::make_unique<ScBuildManifest>(m_params.m_outputPath);
+    // knowledge base binaries can be updated only if they have been built with manifest
+    if (builderMemoryParams.clear || !m_manifest->Load())
+    {
+      ScConsole::PrintLine() << ScConsole::Color::Blue << "Build manifest is not found, build all sources... ";
+      m_manifest->Remove();
+      builderMemoryParams.clear = SC_TRUE;
+    }
+  }
+
+  if (!ScMemory::Initialize(builderMemoryParams))
     SC_THROW_EXCEPTION(utils::ExceptionInvalidState, "Error while sc-memory initialize");
 
+  // sc-addresses of sc-elements from manifest may be reused if sc-elements have been erased after previous build
+  if (m_manifest && !builderMemoryParams.clear && !CheckManifestElements())
+  {
+    ScConsole::PrintLine() << ScConsole::Color::Blue
+                           << "Sc-elements of build manifest are changed in knowledge base binaries, build all "
+                              "sources... ";
+    ScMemory::Shutdown(SC_FALSE);
+    m_manifest->Remove();
+    builderMemoryParams.clear = SC_TRUE;
+    if (!ScMemory::Initialize(builderMemoryParams))
+      SC_THROW_EXCEPTION(utils::ExceptionInvalidState, "Error while sc-memory initialize");
+  }
+
+  // directories with sources are traversed by the same number of threads as sources are parsed
+  m_collector = ScRepoPathCollector{m_params.m_parseThreadsNum};
+  ScTimer const buildTimer;
+  ScTimer const collectTimer;
   ScRepoPathCollector::Sources excludedSources;
   ScRepoPathCollector::Sources checkSources;
   if (m_collector.IsRepoPathFile(m_params.m_inputPath))
@@ -31,15 +72,50 @@ bool Builder::Run(BuilderParams const & params, sc_memory_params const & memoryP
   ScRepoPathCollector::Sources buildSources;
   ScConsole::PrintLine() << ScConsole::Color::Blue << "Collect all sources... ";
   m_collector.CollectBuildSources(m_params.m_inputPath, excludedSources, checkSources, buildSources);
+  m_profile.SetPhaseSeconds(ScBuildProfile::Phase::Collect, collectTimer.Seconds());
 
   m_ctx = std::make_unique<ScMemoryContext>();
   ScAddr const & outputStructure = m_params.m_resultStructureUpload ? ResolveOutputStructure() : ScAddr::Empty;
 
   ScConsole::PrintLine() << ScConsole::Color::Blue << "Build knowledge base from sources... ";
-  bool const status = BuildSources(buildSources, outputStructure);
+  bool status;
+  ScTimer indexTimer;
+  {
+    // sc-links contents are indexed to search them by substrings once after all sources are translated
+    ScMemoryContextDeferredLinksIndexingGuard indexingGuard{*m_ctx};
+    status = BuildSources(buildSources, outputStructure);
+    indexTimer = ScTimer();
+  }
+  m_profile.SetPhaseSeconds(ScBuildProfile::Phase::IndexContents, indexTimer.Seconds());
+
+  if (m_manifest && status)
+    CompleteManifest();
+
+  if (!m_params.m_imagePath.empty() && status)
+    SaveImage();
 
   m_ctx.reset();
+  ScTimer const saveTimer;
   ScMemory::Shutdown(SC_TRUE);
+  m_profile.SetPhaseSeconds(ScBuildProfile::Phase::Save, saveTimer.Seconds());
+
+  if (m_manifest)
+  {
+    // binaries built partially can't be updated, so the next build will translate all sources
+    if (status)
+      m_manifest->Save();
+    else
+      m_manifest->Remove();
+    m_manifest.reset();
+  }
+
+  m_profile.SetPhaseSeconds(ScBuildProfile::Phase::Build, buildTimer.Seconds());
+  m_profile.Print();
+  if (!m_params.m_profilePath.empty())
+  {
+    ScConsole::PrintLine() << ScConsole::Color::Blue << "Save build profile... ";
+    m_profile.Save(m_params.m_profilePath);
+  }
 
   return status;
 }
@@ -47,31 +123,260 @@ bool Builder::Run(BuilderParams const & params, sc_memory_params const & memoryP
 bool Builder::BuildSources(ScRepoPathCollector::Sources const & buildSources, ScAddr const & outputStructure)
 {
   ScMemoryContextEventsBlockingGuard guard{*m_ctx};
-  m_translators = {{"scs", std::make_shared<SCsTranslator>(*m_ctx)}, {"gwf", std::make_shared<GWFTranslator>(*m_ctx)}};
+  // identifiers are resolved by all sources through one cache instead of search in sc-memory for each source
+  auto const identifiersCache = std::make_shared<SCsIdentifiersCache>();
+  m_translators = {
+      {"scs", std::make_shared<SCsTranslator>(*m_ctx, identifiersCache)},
+      {"gwf", std::make_shared<GWFTranslator>(*m_ctx, identifiersCache)}};
 
-  // process founded files
-  bool status = true;
+  // sources are generated in the same order regardless of number of parse threads
+  std::vector<std::string> sources{buildSources.cbegin(), buildSources.cend()};
+  std::sort(sources.begin(), sources.end());
+  if (m_manifest)
+  {
+    ScTimer const eraseTimer;
+    sources = EraseChangedSources(sources);
+    m_profile.SetPhaseSeconds(ScBuildProfile::Phase::EraseChangedSources, eraseTimer.Seconds());
+  }
+
+  // cache is loaded after erasure of changed sources, so it doesn't contain erased sc-elements
+  ScTimer const resolveTimer;
+  identifiersCache->Load(*m_ctx);
+  m_profile.SetPhaseSeconds(ScBuildProfile::Phase::ResolveIdentifiers, resolveTimer.Seconds());
 
-  size_t done = 0;
-  for (auto const & fileName : buildSources)
+  // each field of source profile is updated by one thread
+  m_profile.SetSources(sources);
+  std::vector<ScBuildProfile::Source> & profileSources = m_profile.GetSources();
+
+  struct ReadSource
+  {
+    std::string m_content;
+    std::string m_error;
+    sc_bool m_isRead = SC_FALSE;
+  };
+
+  struct ParsedSource
   {
-    ScConsole::Print() << ScConsole::Color::LightBlue << "[" << (++done) << "/" << buildSources.size() << "]: ";
-    ScConsole::Print() << ScConsole::Color::Grey << fileName << " - ";
+    std::unique_ptr<scs::Parser> m_parser;
+    std::string m_error;
+    sc_bool m_isParsed = SC_FALSE;
+  };
+
+  size_t const sourcesNum = sources.size();
+  size_t const parseThreadsNum = std::max<size_t>(1, std::min(m_params.m_parseThreadsNum, sourcesNum));
+  // parsed sources are kept until they are generated, so only a window of sources is parsed ahead
+  size_t const parseWindowSize = parseThreadsNum * PARSED_SOURCES_PER_THREAD;
+  // sources are read ahead of parsing, so parse threads don't wait for slow file systems
+  size_t const readWindowSize = parseThreadsNum * READ_SOURCES_PER_THREAD;
 
-    try
+  std::vector<ReadSource> readSources(sourcesNum);
+  std::vector<ParsedSource> parsedSources(sourcesNum);
+  std::mutex parsedSourcesMutex;
+  std::condition_variable sourceReadCond;
+  std::condition_variable sourceParsedCond;
+  std::condition_variable sourceGeneratedCond;
+  size_t nextSourceToRead = 0;
+  size_t nextSourceToParse = 0;
+  size_t nextSourceToGenerate = 0;
+  sc_bool isStopped = SC_FALSE;
+
+  auto const & ReadSources = [&]()
+  {
+    while (true)
     {
-      ProcessFile(fileName, outputStructure);
+      size_t index;
+      {
+        std::unique_lock<std::mutex> lock(parsedSourcesMutex);
+        sourceGeneratedCond.wait(
+            lock,
+            [&]()
+            {
+              return isStopped || nextSourceToRead == sourcesNum
+                     || nextSourceToRead < nextSourceToGenerate + readWindowSize;
+            });
+        if (isStopped || nextSourceToRead == sourcesNum)
+          return;
 
-      ScConsole::PrintLine() << ScConsole::Color::Green << "ok";
+        index = nextSourceToRead++;
+      }
+
+      ScTimer const readTimer;
+      ReadSource readSource;
+      try
+      {
+        Translator::GetFileContent(sources[index], readSource.m_content);
+      }
+      catch (utils::ScException const & e)
+      {
+        readSource.m_error = e.Message();
+      }
+      catch (std::exception const & e)
+      {
+        readSource.m_error = e.what();
+      }
+      readSource.m_isRead = SC_TRUE;
+      profileSources[index].m_size = readSource.m_content.size();
+      profileSources[index].m_readSeconds = readTimer.Seconds();
+
+      {
+        std::lock_guard<std::mutex> lock(parsedSourcesMutex);
+        readSources[index] = std::move(readSource);
+      }
+      sourceReadCond.notify_all();
+    }
+  };
+
+  auto const & ParseSources = [&]()
+  {
+    while (true)
+    {
+      size_t index;
+      {
+        std::unique_lock<std::mutex> lock(parsedSourcesMutex);
+        sourceGeneratedCond.wait(
+            lock,
+            [&]()
+            {
+              return isStopped || nextSourceToParse == sourcesNum
+                     || nextSourceToParse < nextSourceToGenerate + parseWindowSize;
+            });
+        if (isStopped || nextSourceToParse == sourcesNum)
+          return;
+
+        index = nextSourceToParse++;
+      }
+
+      ReadSource readSource;
+      {
+        std::unique_lock<std::mutex> lock(parsedSourcesMutex);
+        sourceReadCond.wait(
+            lock,
+            [&]()
+            {
+              return isStopped || readSources[index].m_isRead;
+            });
+        if (isStopped)
+          return;
+
+        readSource = std::move(readSources[index]);
+      }
+
+      Translator::Params translateParams;
+      translateParams.m_fileName = sources[index];
+      translateParams.m_outputStructure = outputStructure;
+      translateParams.m_fileContent = &readSource.m_content;
+
+      ScTimer const parseTimer;
+      ParsedSource parsedSource;
+      parsedSource.m_error = readSource.m_error;
+      try
+      {
+        if (parsedSource.m_error.empty())
+          parsedSource.m_parser = GetTranslator(translateParams.m_fileName)->Parse(translateParams);
+      }
+      catch (utils::ScException const & e)
+      {
+        parsedSource.m_error = e.Message();
+      }
+      catch (std::exception const & e)
+      {
+        parsedSource.m_error = e.what();
+      }
+      parsedSource.m_isParsed = SC_TRUE;
+      profileSources[index].m_parseSeconds = parseTimer.Seconds();
+
+      {
+        std::lock_guard<std::mutex> lock(parsedSourcesMutex);
+        parsedSources[index] = std::move(parsedSource);
+      }
+      sourceParsedCond.notify_all();
     }
-    catch (utils::ScException const & e)
+  };
+
+  ScTimer const sourcesTimer;
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < parseThreadsNum; ++i)
+  {
+    threads.emplace_back(ReadSources);
+    threads.emplace_back(ParseSources);
+  }
+
+  // generate parsed sources in memory sequentially
+  bool status = true;
+  for (size_t index = 0; index < sourcesNum; ++index)
+  {
+    ParsedSource parsedSource;
+    {
+      std::unique_lock<std::mutex> lock(parsedSourcesMutex);
+      sourceParsedCond.wait(
+          lock,
+          [&]()
+          {
+            return parsedSources[index].m_isParsed;
+          });
+      parsedSource = std::move(parsedSources[index]);
+    }
+
+    Translator::Params translateParams;
+    translateParams.m_fileName = sources[index];
+    translateParams.m_outputStructure = outputStructure;
+
+    ScConsole::Print() << ScConsole::Color::LightBlue << "[" << (index + 1) << "/" << sourcesNum << "]: ";
+    ScConsole::Print() << ScConsole::Color::Grey << translateParams.m_fileName << " - ";
+
+    if (parsedSource.m_parser)
+    {
+      ScTimer const generateTimer;
+      try
+      {
+        // generated sc-elements are collected for each source to count them in profile
+        ScAddrVector generatedElements;
+        translateParams.m_generatedElements = &generatedElements;
+
+        GetTranslator(translateParams.m_fileName)->Generate(translateParams, *parsedSource.m_parser);
+        profileSources[index].m_generatedElementsNum = generatedElements.size();
+
+        if (m_manifest)
+          UpdateManifestSource(translateParams.m_fileName, *parsedSource.m_parser, generatedElements);
+        else if (!m_params.m_imagePath.empty())
+          m_generatedElements.insert(m_generatedElements.end(), generatedElements.cbegin(), generatedElements.cend());
+      }
+      catch (utils::ScException const & e)
+      {
+        parsedSource.m_error = e.Message();
+      }
+      profileSources[index].m_generateSeconds = generateTimer.Seconds();
+    }
+
+    if (parsedSource.m_error.empty())
+      ScConsole::PrintLine() << ScConsole::Color::Green << "ok";
+    else
     {
       ScConsole::PrintLine() << ScConsole::Color::Red << "failed";
-      ScConsole::PrintLine() << ScConsole::Color::Red << e.Message();
+      ScConsole::PrintLine() << ScConsole::Color::Red << parsedSource.m_error;
       status = false;
-      break;
     }
+
+    {
+      std::lock_guard<std::mutex> lock(parsedSourcesMutex);
+      nextSourceToGenerate = index + 1;
+      isStopped = !status;
+    }
+    sourceGeneratedCond.notify_all();
+
+    if (!status)
+      break;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(parsedSourcesMutex);
+    isStopped = SC_TRUE;
   }
+  sourceGeneratedCond.notify_all();
+  sourceReadCond.notify_all();
+  for (auto & thread : threads)
+    thread.join();
+  m_profile.SetPhaseSeconds(ScBuildProfile::Phase::Sources, sourcesTimer.Seconds());
 
   ScConsole::PrintLine() << ScConsole::Color::Green << "Clean state...";
   Translator::Clean(*m_ctx);
@@ -104,19 +409,172 @@ ScAddr Builder::ResolveOutputStructure()
   return outputStructure;
 }
 
-bool Builder::ProcessFile(std::string const & fileName, ScAddr const & outputStructure)
+std::shared_ptr<Translator> const & Builder::GetTranslator(std::string const & fileName) const
 {
-  Translator::Params translateParams;
-  translateParams.m_fileName = fileName;
-  translateParams.m_outputStructure = outputStructure;
-
   std::string const & fileExt = m_collector.GetFileExtension(fileName);
   auto const & it = m_translators.find(fileExt);
   if (it == m_translators.cend())
     SC_THROW_EXCEPTION(
         utils::ExceptionInvalidState, "Not found translators for sources with extension `" << fileExt << "`.");
 
-  return it->second->Translate(translateParams);
+  return it->second;
+}
+
+std::vector<std::string> Builder::EraseChangedSources(std::vector<std::string> const & sources)
+{
+  ScConsole::PrintLine() << ScConsole::Color::Blue << "Find changed sources... ";
+  m_sourcesHashes.clear();
+  for (std::string const & fileName : sources)
+    m_sourcesHashes[fileName] = ScBuildManifest::CalculateHash(fileName);
+
+  std::set<std::string> const & changedSources = m_manifest->ResolveChangedSources(m_sourcesHashes);
+
+  // erase sc-elements generated from changed sources previously, newer sc-elements are erased first
+  ScBuildManifest::Sources & manifestSources = m_manifest->GetSources();
+  for (std::string const & fileName : changedSources)
+  {
+    auto const & it = manifestSources.find(fileName);
+    if (it == manifestSources.cend())
+      continue;
+
+    // sc-elements are checked to be the same ones before build, so they can be erased by their sc-addresses
+    std::vector<ScBuildManifest::Element> const & elements = it->second.m_elements;
+    for (auto elementIt = elements.crbegin(); elementIt != elements.crend(); ++elementIt)
+    {
+      if (m_ctx->IsElement(elementIt->m_addr))
+        m_ctx->EraseElement(elementIt->m_addr);
+    }
+    manifestSources.erase(it);
+  }
+
+  std::vector<std::string> changedCurrentSources;
+  for (std::string const & fileName : sources)
+  {
+    if (changedSources.find(fileName) != changedSources.cend())
+      changedCurrentSources.push_back(fileName);
+  }
+
+  ScConsole::PrintLine() << ScConsole::Color::Blue << "Sources to translate: " << changedCurrentSources.size() << "/"
+                         << sources.size();
+  return changedCurrentSources;
+}
+
+void Builder::UpdateManifestSource(
+    std::string const & fileName,
+    scs::Parser const & parser,
+    ScAddrVector const & generatedElements)
+{
+  ScBuildManifest::Source source;
+  source.m_hash = m_sourcesHashes[fileName];
+
+  ScAddrUnorderedSet const generatedElementsSet{generatedElements.cbegin(), generatedElements.cend()};
+  parser.ForEachParsedElement(
+      [&](scs::ParsedElement const & element)
+      {
+        if (element.GetType().IsConnector())
+          return;
+
+        std::string const & idtf = element.GetIdtf();
+        if (element.GetVisibility() == scs::Visibility::System)
+        {
+          ScAddr const & addr = m_ctx->SearchElementBySystemIdentifier(idtf);
+          if (generatedElementsSet.find(addr) != generatedElementsSet.cend())
+            source.m_definedIdtfs.insert(idtf);
+          else
+            source.m_usedIdtfs.insert(idtf);
+        }
+        else if (element.GetVisibility() == scs::Visibility::Global)
+          source.m_globalIdtfs.insert(idtf);
+      });
+
+  // types and incident sc-elements are stored after build, when they can't be changed by other sources
+  for (ScAddr const & addr : generatedElements)
+    source.m_elements.push_back({addr, ScType::Unknown, ScAddr::Empty, ScAddr::Empty});
+  m_manifest->GetSources()[fileName] = std::move(source);
+}
+
+bool Builder::CheckManifestElements() const
+{
+  ScMemoryContext context;
+  for (auto const & [fileName, source] : m_manifest->GetSources())
+  {
+    ScAddrUnorderedSet sourceElements;
+    for (ScBuildManifest::Element const & element : source.m_elements)
+    {
+      sourceElements.insert(element.m_addr);
+
+      // sc-elements erased after previous build are skipped, they are erased with the source anyway
+      if (!context.IsElement(element.m_addr))
+        continue;
+
+      ScType const & type = context.GetElementType(element.m_addr);
+      if (*type != *element.m_type)
+        return false;
+
+      if (type.IsConnector()
+          && context.GetConnectorIncidentElements(element.m_addr)
+                 != std::make_tuple(element.m_source, element.m_target))
+        return false;
+    }
+
+    for (std::string const & idtf : source.m_definedIdtfs)
+    {
+      ScAddr const & addr = context.SearchElementBySystemIdentifier(idtf);
+      if (addr.IsValid() && sourceElements.find(addr) == sourceElements.cend())
+        return false;
+    }
+  }
+
+  return true;
+}
+
+void Builder::CompleteManifest()
+{
+  // sc-links with global identifiers are erased after build
+  for (auto & [fileName, source] : m_manifest->GetSources())
+  {
+    std::vector<ScBuildManifest::Element> & elements = source.m_elements;
+    elements.erase(
+        std::remove_if(
+            elements.begin(),
+            elements.end(),
+            [this](ScBuildManifest::Element const & element)
+            {
+              return !m_ctx->IsElement(element.m_addr);
+            }),
+        elements.end());
+
+    for (ScBuildManifest::Element & element : elements)
+    {
+      element.m_type = m_ctx->GetElementType(element.m_addr);
+      if (element.m_type.IsConnector())
+        std::tie(element.m_source, element.m_target) = m_ctx->GetConnectorIncidentElements(element.m_addr);
+    }
+  }
+}
+
+void Builder::SaveImage()
+{
+  ScConsole::PrintLine() << ScConsole::Color::Blue << "Save knowledge base image... ";
+
+  // in incremental mode manifest contains sc-elements of all sources, not only translated ones
+  ScAddrVector elements;
+  if (m_manifest)
+  {
+    for (auto const & [fileName, source] : m_manifest->GetSources())
+    {
+      for (ScBuildManifest::Element const & element : source.m_elements)
+        elements.push_back(element.m_addr);
+    }
+  }
+  else
+    elements = std::move(m_generatedElements);
+
+  ScKBImage const & image = ScKBImage::Capture(*m_ctx, elements);
+  image.Save(m_params.m_imagePath);
+
+  ScConsole::PrintLine() << ScConsole::Color::LightBlue << "Image elements: " << ScConsole::Color::White
+                         << image.GetElements().size();
 }
 
 void Builder::DumpStatistics()
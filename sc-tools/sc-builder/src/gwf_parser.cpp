@@ -49,7 +49,6 @@ void GWFParser::Parse(std::string const & xmlStr, SCgElements & elements)
     return;
 
   ProcessStaticSector(staticSector, elements);
-  xmlCleanupParser();
 }
 
 void GWFParser::ProcessStaticSector(xmlNodePtr staticSector, SCgElements & elementsWithoutParents)
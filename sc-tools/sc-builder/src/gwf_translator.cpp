@@ -6,36 +6,40 @@
 
 #include "gwf_translator.hpp"
 
-#include <filesystem>
-
 #include <sc-memory/utils/sc_exec.hpp>
 
+#include <sc-memory/scs/scs_parser.hpp>
+
 #include "gwf_parser.hpp"
 #include "sc_scs_writer.hpp"
+#include "sc_scg_to_scs_parser.hpp"
 #include "gwf_translator_constants.hpp"
 
 using namespace Constants;
 
-GWFTranslator::GWFTranslator(ScMemoryContext & context)
+GWFTranslator::GWFTranslator(ScMemoryContext & context, SCsIdentifiersCachePtr identifiersCache)
   : Translator(context)
-  , m_scsTranslator(context)
+  , m_scsTranslator(context, std::move(identifiersCache))
 {
 }
 
-bool GWFTranslator::TranslateImpl(Params const & params)
+std::unique_ptr<scs::Parser> GWFTranslator::Parse(Params const & params) const
 {
-  std::string const & scsText = TranslateXMLFileContentToSCs(params.m_fileName);
-  std::string const & scsSource = WriteStringToFile(scsText, params.m_fileName);
+  std::string buffer;
+  std::string const & gwfText = GetFileContent(params, buffer);
 
-  Params newParams;
-  newParams.m_fileName = scsSource;
-  newParams.m_autoFormatInfo = params.m_autoFormatInfo;
-  newParams.m_outputStructure = params.m_outputStructure;
-  bool status = m_scsTranslator.Translate(newParams);
+  SCgElements elementsWithoutParents;
+  ParseGWF(gwfText, params.m_fileName, elementsWithoutParents);
 
-  std::filesystem::remove(scsSource.c_str());
+  // sc.s-elements are parsed straight from sc.g-elements, without rendering and parsing of SCs-text
+  auto parser = std::make_unique<SCgToSCsParser>();
+  parser->Parse(elementsWithoutParents, params.m_fileName);
+  return parser;
+}
 
-  return status;
+bool GWFTranslator::Generate(Params const & params, scs::Parser const & parser)
+{
+  return m_scsTranslator.Generate(params, parser);
 }
 
 std::string GWFTranslator::TranslateXMLFileContentToSCs(std::string const & filename)
@@ -61,21 +65,26 @@ std::string GWFTranslator::GetXMLFileContent(std::string const & fileName)
 
   xmlFree(xmlBuffer);
   xmlFreeDoc(document);
-  xmlCleanupParser();
 
   return xmlString;
 }
 
-std::string GWFTranslator::TranslateGWFToSCs(std::string const & xmlStr, std::string const & filePath)
+void GWFTranslator::ParseGWF(
+    std::string const & xmlStr,
+    std::string const & filePath,
+    SCgElements & elementsWithoutParents)
 {
-  SCgElements elementsWithoutParents;
-
   GWFParser::Parse(xmlStr, elementsWithoutParents);
 
   if (elementsWithoutParents.empty())
     SC_THROW_EXCEPTION(
-        utils::ExceptionParseError,
-        "GWFTranslator::TranslateGWFToSCs: There are no elements in file `" << filePath << "`.");
+        utils::ExceptionParseError, "GWFTranslator::ParseGWF: There are no elements in file `" << filePath << "`.");
+}
+
+std::string GWFTranslator::TranslateGWFToSCs(std::string const & xmlStr, std::string const & filePath)
+{
+  SCgElements elementsWithoutParents;
+  ParseGWF(xmlStr, filePath, elementsWithoutParents);
 
   Buffer scsBuffer;
   std::unordered_set<SCgElementPtr> writtenElements;
@@ -83,35 +92,3 @@ std::string GWFTranslator::TranslateGWFToSCs(std::string const & xmlStr, std::st
 
   return scsBuffer.GetValue();
 }
-
-std::string GWFTranslator::WriteStringToFile(std::string const & scsText, std::string const & fileName)
-{
-  std::string const & filePath = fileName + GENERATED_EXTENTION + SCS_EXTENTION;
-  std::ofstream outputFile(filePath, std::ios::binary);
-
-  if (!outputFile.is_open())
-    SC_THROW_EXCEPTION(
-        utils::ExceptionCritical,
-        "GWFTranslator::WriteStringToFile: Error creating file for writing `" << filePath << "`.");
-
-  outputFile << scsText;
-
-  if (outputFile.fail())
-  {
-    outputFile.close();
-    std::remove(filePath.c_str());
-    SC_THROW_EXCEPTION(
-        utils::ExceptionCritical, "GWFTranslator::WriteStringToFile: Error writing to file `" << filePath << "`.");
-  }
-
-  outputFile.close();
-
-  if (outputFile.fail())
-  {
-    std::remove(filePath.c_str());
-    SC_THROW_EXCEPTION(
-        utils::ExceptionCritical, "GWFTranslator::WriteStringToFile: Error closing the file `" << filePath << "`.");
-  }
-
-  return filePath;
-}
@@ -13,21 +13,24 @@
 #include "sc-builder/translator.hpp"
 
 #include "scs_translator.hpp"
+#include "gwf_translator_constants.hpp"
 
 class GWFTranslator : public Translator
 {
 public:
-  explicit GWFTranslator(class ScMemoryContext & context);
+  explicit GWFTranslator(class ScMemoryContext & context, SCsIdentifiersCachePtr identifiersCache = nullptr);
   ~GWFTranslator() override = default;
 
-  bool TranslateImpl(Params const & params) override;
+  std::unique_ptr<scs::Parser> Parse(Params const & params) const override;
+
+  bool Generate(Params const & params, scs::Parser const & parser) override;
 
   static std::string TranslateXMLFileContentToSCs(std::string const & filename);
 
 protected:
   SCsTranslator m_scsTranslator;
 
-  static std::string WriteStringToFile(std::string const & scsStr, std::string const & filePath);
   static std::string TranslateGWFToSCs(std::string const & xmlStr, std::string const & filePath);
   static std::string GetXMLFileContent(std::string const & filename);
+  static void ParseGWF(std::string const & xmlStr, std::string const & filePath, SCgElements & elementsWithoutParents);
 };
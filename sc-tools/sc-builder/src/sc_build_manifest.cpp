@@ -0,0 +1,273 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "sc_build_manifest.hpp"
+
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <filesystem>
+
+#include <sc-memory/sc_utils.hpp>
+
+std::string const ScBuildManifest::FILE_NAME = "sc-builder.manifest";
+std::string const ScBuildManifest::FILE_HEADER = "sc-builder-manifest 2";
+
+namespace impl
+{
+std::string const SOURCE_LINE = "source";
+std::string const DEFINED_IDTFS_LINE = "defined";
+std::string const USED_IDTFS_LINE = "used";
+std::string const GLOBAL_IDTFS_LINE = "global";
+std::string const ELEMENTS_LINE = "elements";
+
+bool Intersects(std::set<std::string> const & first, std::set<std::string> const & second)
+{
+  for (auto const & item : first)
+  {
+    if (second.find(item) != second.cend())
+      return true;
+  }
+
+  return false;
+}
+
+void ReadIdtfs(std::istringstream & stream, std::set<std::string> & idtfs)
+{
+  std::string idtf;
+  while (stream >> idtf)
+    idtfs.insert(idtf);
+}
+
+void WriteIdtfs(std::ofstream & stream, std::string const & lineName, std::set<std::string> const & idtfs)
+{
+  stream << lineName;
+  for (auto const & idtf : idtfs)
+    stream << " " << idtf;
+  stream << "\n";
+}
+}  // namespace impl
+
+bool ScBuildManifest::Element::operator==(Element const & other) const
+{
+  return m_addr == other.m_addr && *m_type == *other.m_type && m_source == other.m_source && m_target == other.m_target;
+}
+
+bool ScBuildManifest::ReadElements(std::istringstream & stream, std::vector<Element> & elements)
+{
+  ScAddr::HashType hash;
+  sc_type type;
+  while (stream >> hash >> type)
+  {
+    Element element{ScAddr(hash), ScType(type), ScAddr::Empty, ScAddr::Empty};
+    if (element.m_type.IsConnector())
+    {
+      ScAddr::HashType sourceHash;
+      ScAddr::HashType targetHash;
+      if (!(stream >> sourceHash >> targetHash))
+        return false;
+
+      element.m_source = ScAddr(sourceHash);
+      element.m_target = ScAddr(targetHash);
+    }
+    elements.push_back(element);
+  }
+
+  return stream.eof();
+}
+
+ScBuildManifest::ScBuildManifest(std::string const & outputPath)
+  : m_filePath((std::filesystem::path(outputPath) / FILE_NAME).string())
+{
+}
+
+bool ScBuildManifest::Load()
+{
+  m_sources.clear();
+
+  std::ifstream file(m_filePath);
+  if (!file.is_open())
+    return false;
+
+  std::string line;
+  if (!std::getline(file, line) || line != FILE_HEADER)
+    return false;
+
+  Source * source = nullptr;
+  while (std::getline(file, line))
+  {
+    std::istringstream stream(line);
+    std::string lineName;
+    stream >> lineName;
+
+    if (lineName == impl::SOURCE_LINE)
+    {
+      std::string hash;
+      std::string path;
+      stream >> hash;
+      std::getline(stream >> std::ws, path);
+      if (hash.empty() || path.empty())
+        break;
+
+      source = &m_sources[path];
+      source->m_hash = hash;
+      continue;
+    }
+
+    if (source == nullptr)
+      break;
+
+    if (lineName == impl::DEFINED_IDTFS_LINE)
+      impl::ReadIdtfs(stream, source->m_definedIdtfs);
+    else if (lineName == impl::USED_IDTFS_LINE)
+      impl::ReadIdtfs(stream, source->m_usedIdtfs);
+    else if (lineName == impl::GLOBAL_IDTFS_LINE)
+      impl::ReadIdtfs(stream, source->m_globalIdtfs);
+    else if (lineName == impl::ELEMENTS_LINE)
+    {
+      if (!ReadElements(stream, source->m_elements))
+        break;
+    }
+    else
+      break;
+  }
+
+  if (!file.eof())
+  {
+    m_sources.clear();
+    return false;
+  }
+
+  return true;
+}
+
+void ScBuildManifest::Save() const
+{
+  std::string const & tempFilePath = m_filePath + ".tmp";
+  {
+    std::ofstream file(tempFilePath, std::ios::trunc);
+    if (!file.is_open())
+      SC_THROW_EXCEPTION(
+          utils::ExceptionCritical, "ScBuildManifest::Save: Error creating file for writing `" << tempFilePath << "`.");
+
+    file << FILE_HEADER << "\n";
+    for (auto const & [path, source] : m_sources)
+    {
+      file << impl::SOURCE_LINE << " " << source.m_hash << " " << path << "\n";
+      impl::WriteIdtfs(file, impl::DEFINED_IDTFS_LINE, source.m_definedIdtfs);
+      impl::WriteIdtfs(file, impl::USED_IDTFS_LINE, source.m_usedIdtfs);
+      impl::WriteIdtfs(file, impl::GLOBAL_IDTFS_LINE, source.m_globalIdtfs);
+
+      file << impl::ELEMENTS_LINE;
+      for (Element const & element : source.m_elements)
+      {
+        file << " " << element.m_addr.Hash() << " " << *element.m_type;
+        if (element.m_type.IsConnector())
+          file << " " << element.m_source.Hash() << " " << element.m_target.Hash();
+      }
+      file << "\n";
+    }
+
+    if (file.fail())
+    {
+      file.close();
+      std::filesystem::remove(tempFilePath);
+      SC_THROW_EXCEPTION(
+          utils::ExceptionCritical, "ScBuildManifest::Save: Error writing to file `" << tempFilePath << "`.");
+    }
+  }
+
+  // replace previous manifest only if new one is written completely
+  std::filesystem::rename(tempFilePath, m_filePath);
+}
+
+void ScBuildManifest::Remove()
+{
+  m_sources.clear();
+  std::filesystem::remove(m_filePath);
+}
+
+ScBuildManifest::Sources & ScBuildManifest::GetSources()
+{
+  return m_sources;
+}
+
+std::set<std::string> ScBuildManifest::ResolveChangedSources(SourcesHashes const & hashes) const
+{
+  std::set<std::string> changedSources;
+  for (auto const & [path, hash] : hashes)
+  {
+    auto const & it = m_sources.find(path);
+    if (it == m_sources.cend() || it->second.m_hash != hash)
+      changedSources.insert(path);
+  }
+  for (auto const & [path, source] : m_sources)
+  {
+    if (hashes.find(path) == hashes.cend())
+      changedSources.insert(path);
+  }
+
+  // Sc-elements generated from changed sources are erased together with all sc-connectors incident to them, so sources
+  // using their identifiers should be translated again. Global identifiers are resolved only during one build, so all
+  // sources sharing them should be translated together.
+  std::set<std::string> erasedIdtfs;
+  std::set<std::string> globalIdtfs;
+  auto const & AppendSourceIdtfs = [&](Source const & source)
+  {
+    erasedIdtfs.insert(source.m_definedIdtfs.cbegin(), source.m_definedIdtfs.cend());
+    globalIdtfs.insert(source.m_globalIdtfs.cbegin(), source.m_globalIdtfs.cend());
+  };
+
+  for (std::string const & path : changedSources)
+  {
+    auto const & it = m_sources.find(path);
+    if (it != m_sources.cend())
+      AppendSourceIdtfs(it->second);
+  }
+
+  bool isChanged = true;
+  while (isChanged)
+  {
+    isChanged = false;
+    for (auto const & [path, source] : m_sources)
+    {
+      if (changedSources.find(path) != changedSources.cend())
+        continue;
+
+      if (impl::Intersects(source.m_usedIdtfs, erasedIdtfs) || impl::Intersects(source.m_globalIdtfs, globalIdtfs))
+      {
+        changedSources.insert(path);
+        AppendSourceIdtfs(source);
+        isChanged = true;
+      }
+    }
+  }
+
+  return changedSources;
+}
+
+std::string ScBuildManifest::CalculateHash(std::string const & fileName)
+{
+  std::ifstream file(fileName, std::ios::binary);
+  if (!file.is_open())
+    SC_THROW_EXCEPTION(utils::ExceptionInvalidState, "Can't open file " << fileName);
+
+  // FNV-1a hash is enough to detect changes of sources and it is stable between platforms and builds
+  sc_uint64 hash = 14695981039346656037ull;
+  char buffer[4096];
+  while (file.read(buffer, sizeof(buffer)) || file.gcount() > 0)
+  {
+    for (std::streamsize i = 0; i < file.gcount(); ++i)
+    {
+      hash ^= static_cast<unsigned char>(buffer[i]);
+      hash *= 1099511628211ull;
+    }
+  }
+
+  std::stringstream stream;
+  stream << std::hex << std::setw(16) << std::setfill('0') << hash;
+  return stream.str();
+}
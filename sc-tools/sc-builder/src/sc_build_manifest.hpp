@@ -0,0 +1,96 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#pragma once
+
+#include <map>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <sc-memory/sc_addr.hpp>
+#include <sc-memory/sc_type.hpp>
+
+/*!
+ * Manifest of knowledge base binaries. It is stored next to binaries and describes sources translated into them: hashes
+ * of their contents, identifiers of sc-elements they define and use, and sc-elements generated from them. It allows to
+ * translate only changed sources and sources depending on them.
+ *
+ * Types of sc-elements found by system identifiers and extended by sources aren't stored, so their extensions aren't
+ * rolled back when these sources are changed.
+ */
+class ScBuildManifest
+{
+public:
+  /*!
+   * Sc-element generated from source. Its type and incident sc-elements are stored to check that its sc-address isn't
+   * reused by other sc-element since the previous build.
+   */
+  struct Element
+  {
+    ScAddr m_addr;
+    ScType m_type;
+    //! Source sc-element of sc-connector
+    ScAddr m_source;
+    //! Target sc-element of sc-connector
+    ScAddr m_target;
+
+    bool operator==(Element const & other) const;
+  };
+
+  struct Source
+  {
+    //! Hash of source content
+    std::string m_hash;
+    //! System identifiers of sc-elements generated from source
+    std::set<std::string> m_definedIdtfs;
+    //! System identifiers of sc-elements generated from other sources and used in source
+    std::set<std::string> m_usedIdtfs;
+    //! Global identifiers used in source
+    std::set<std::string> m_globalIdtfs;
+    //! Sc-elements generated from source in order of their generation
+    std::vector<Element> m_elements;
+  };
+
+  using Sources = std::map<std::string, Source>;
+  //! Source path to source content hash
+  using SourcesHashes = std::map<std::string, std::string>;
+
+  explicit ScBuildManifest(std::string const & outputPath);
+
+  /*! Loads manifest from directory with knowledge base binaries.
+   * @return If manifest exists and it is valid, then returns true; otherwise returns false.
+   */
+  bool Load();
+
+  //! Saves manifest into directory with knowledge base binaries.
+  void Save() const;
+
+  //! Removes manifest from directory with knowledge base binaries.
+  void Remove();
+
+  Sources & GetSources();
+
+  /*! Resolves sources which previous contribution to knowledge base binaries should be erased. They are new, changed
+   * and removed sources, and sources using identifiers of sc-elements generated from them.
+   * @param hashes Hashes of current sources.
+   * @return Paths of current and removed sources to erase and translate again.
+   */
+  std::set<std::string> ResolveChangedSources(SourcesHashes const & hashes) const;
+
+  //! Calculates hash of file content.
+  static std::string CalculateHash(std::string const & fileName);
+
+private:
+  static std::string const FILE_NAME;
+  static std::string const FILE_HEADER;
+
+  std::string m_filePath;
+  Sources m_sources;
+
+  static bool ReadElements(std::istringstream & stream, std::vector<Element> & elements);
+};
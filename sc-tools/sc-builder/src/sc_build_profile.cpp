@@ -0,0 +1,221 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "sc_build_profile.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+
+#include <sc-memory/sc_utils.hpp>
+#include <sc-memory/utils/sc_console.hpp>
+
+std::array<std::string, static_cast<size_t>(ScBuildProfile::Phase::Count)> const ScBuildProfile::PHASES_NAMES = {
+    "collect",
+    "erase_changed_sources",
+    "resolve_identifiers",
+    "sources",
+    "read_thread_time",
+    "parse_thread_time",
+    "generate_thread_time",
+    "index_contents",
+    "save",
+    "build"};
+
+namespace impl
+{
+void WriteJSONString(std::ostream & stream, std::string const & string)
+{
+  stream << '"';
+  for (char const symbol : string)
+  {
+    switch (symbol)
+    {
+    case '"':
+      stream << "\\\"";
+      break;
+    case '\\':
+      stream << "\\\\";
+      break;
+    case '\n':
+      stream << "\\n";
+      break;
+    case '\t':
+      stream << "\\t";
+      break;
+    default:
+      if (static_cast<unsigned char>(symbol) < 0x20)
+        stream << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(symbol) << std::dec;
+      else
+        stream << symbol;
+    }
+  }
+  stream << '"';
+}
+
+void WriteCSVString(std::ostream & stream, std::string const & string)
+{
+  if (string.find_first_of(",\"\n") == std::string::npos)
+  {
+    stream << string;
+    return;
+  }
+
+  stream << '"';
+  for (char const symbol : string)
+  {
+    if (symbol == '"')
+      stream << '"';
+    stream << symbol;
+  }
+  stream << '"';
+}
+}  // namespace impl
+
+double ScBuildProfile::Source::GetSeconds() const
+{
+  return m_readSeconds + m_parseSeconds + m_generateSeconds;
+}
+
+void ScBuildProfile::SetPhaseSeconds(Phase phase, double seconds)
+{
+  m_phasesSeconds[static_cast<size_t>(phase)] = seconds;
+}
+
+double ScBuildProfile::GetPhaseSeconds(Phase phase) const
+{
+  auto const & SumSourcesSeconds = [this](double Source::*seconds)
+  {
+    double sum = 0;
+    for (Source const & source : m_sources)
+      sum += source.*seconds;
+    return sum;
+  };
+
+  switch (phase)
+  {
+  case Phase::Read:
+    return SumSourcesSeconds(&Source::m_readSeconds);
+  case Phase::Parse:
+    return SumSourcesSeconds(&Source::m_parseSeconds);
+  case Phase::Generate:
+    return SumSourcesSeconds(&Source::m_generateSeconds);
+  default:
+    return m_phasesSeconds[static_cast<size_t>(phase)];
+  }
+}
+
+bool ScBuildProfile::IsThreadTimePhase(Phase phase)
+{
+  return phase == Phase::Read || phase == Phase::Parse || phase == Phase::Generate;
+}
+
+void ScBuildProfile::SetSources(std::vector<std::string> const & fileNames)
+{
+  m_sources.clear();
+  m_sources.resize(fileNames.size());
+  for (size_t i = 0; i < fileNames.size(); ++i)
+    m_sources[i].m_fileName = fileNames[i];
+}
+
+std::vector<ScBuildProfile::Source> & ScBuildProfile::GetSources()
+{
+  return m_sources;
+}
+
+void ScBuildProfile::Print() const
+{
+  ScConsole::PrintLine() << ScConsole::Color::White << "Profile";
+  for (size_t i = 0; i < PHASES_NAMES.size(); ++i)
+  {
+    Phase const phase = static_cast<Phase>(i);
+    ScConsole::PrintLine() << ScConsole::Color::LightBlue << PHASES_NAMES[i] << ": " << ScConsole::Color::White
+                           << GetPhaseSeconds(phase) << "s"
+                           << (IsThreadTimePhase(phase) ? " (cumulative thread time of all sources)" : "");
+  }
+
+  std::vector<Source const *> sources;
+  sources.reserve(m_sources.size());
+  for (Source const & source : m_sources)
+    sources.push_back(&source);
+
+  size_t const printedSourcesNum = sources.size() < PRINTED_SOURCES_NUM ? sources.size() : PRINTED_SOURCES_NUM;
+  std::partial_sort(
+      sources.begin(),
+      sources.begin() + printedSourcesNum,
+      sources.end(),
+      [](Source const * source, Source const * otherSource)
+      {
+        return source->GetSeconds() > otherSource->GetSeconds();
+      });
+
+  if (printedSourcesNum != 0)
+    ScConsole::PrintLine() << ScConsole::Color::White << "The slowest sources";
+  for (size_t i = 0; i < printedSourcesNum; ++i)
+  {
+    Source const & source = *sources[i];
+    ScConsole::PrintLine() << ScConsole::Color::LightBlue << source.m_fileName << ": " << ScConsole::Color::White
+                           << source.GetSeconds() << "s (read " << source.m_readSeconds << "s, parse "
+                           << source.m_parseSeconds << "s, generate " << source.m_generateSeconds << "s, "
+                           << source.m_generatedElementsNum << " sc-elements)";
+  }
+}
+
+void ScBuildProfile::Save(std::string const & filePath) const
+{
+  std::ofstream stream(filePath, std::ios::trunc);
+  if (!stream.is_open())
+    SC_THROW_EXCEPTION(utils::ExceptionInvalidState, "Can't open build profile file `" << filePath << "`.");
+
+  std::string ext = utils::StringUtils::GetFileExtension(filePath);
+  utils::StringUtils::ToLowerCase(ext);
+  if (ext == "csv")
+    SaveCSV(stream);
+  else
+    SaveJSON(stream);
+
+  if (!stream)
+    SC_THROW_EXCEPTION(utils::ExceptionInvalidState, "Can't write build profile file `" << filePath << "`.");
+}
+
+void ScBuildProfile::SaveJSON(std::ostream & stream) const
+{
+  stream << "{\n  \"phases\": {";
+  for (size_t i = 0; i < PHASES_NAMES.size(); ++i)
+  {
+    stream << (i == 0 ? "\n    " : ",\n    ");
+    impl::WriteJSONString(stream, PHASES_NAMES[i]);
+    stream << ": " << GetPhaseSeconds(static_cast<Phase>(i));
+  }
+  stream << "\n  },\n  \"sources\": [";
+
+  for (size_t i = 0; i < m_sources.size(); ++i)
+  {
+    Source const & source = m_sources[i];
+    stream << (i == 0 ? "\n    {" : ",\n    {") << "\"file\": ";
+    impl::WriteJSONString(stream, source.m_fileName);
+    stream << ", \"size\": " << source.m_size << ", \"read\": " << source.m_readSeconds
+           << ", \"parse\": " << source.m_parseSeconds << ", \"generate\": " << source.m_generateSeconds
+           << ", \"elements\": " << source.m_generatedElementsNum << "}";
+  }
+  stream << (m_sources.empty() ? "]\n}\n" : "\n  ]\n}\n");
+}
+
+void ScBuildProfile::SaveCSV(std::ostream & stream) const
+{
+  // phases have only names and durations, sources have all columns
+  stream << "kind,name,seconds,size,read,parse,generate,elements\n";
+  for (size_t i = 0; i < PHASES_NAMES.size(); ++i)
+    stream << "phase," << PHASES_NAMES[i] << "," << GetPhaseSeconds(static_cast<Phase>(i)) << ",,,,,\n";
+
+  for (Source const & source : m_sources)
+  {
+    stream << "source,";
+    impl::WriteCSVString(stream, source.m_fileName);
+    stream << "," << source.GetSeconds() << "," << source.m_size << "," << source.m_readSeconds << ","
+           << source.m_parseSeconds << "," << source.m_generateSeconds << "," << source.m_generatedElementsNum << "\n";
+  }
+}
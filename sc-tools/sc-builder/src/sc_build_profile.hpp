@@ -0,0 +1,80 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#pragma once
+
+#include <array>
+#include <string>
+#include <vector>
+
+/*!
+ * Profile of knowledge base build. It contains durations of build phases and durations of reading, parsing and
+ * generation of each source. Profile is printed after build, and it can be saved as JSON or CSV report.
+ */
+class ScBuildProfile
+{
+public:
+  //! Number of the slowest sources printed after build
+  static size_t const PRINTED_SOURCES_NUM = 10;
+
+  enum class Phase : size_t
+  {
+    Collect = 0,
+    EraseChangedSources,
+    ResolveIdentifiers,
+    //! Elapsed time of reading, parsing and generation of all sources
+    Sources,
+    //! Cumulative thread times of sources phases. They are summed up by all sources, and they overlap each other,
+    //! because sources are read, parsed and generated simultaneously by different threads.
+    Read,
+    Parse,
+    Generate,
+    IndexContents,
+    Save,
+    Build,
+    Count
+  };
+
+  struct Source
+  {
+    std::string m_fileName;
+    size_t m_size = 0;
+    double m_readSeconds = 0;
+    double m_parseSeconds = 0;
+    double m_generateSeconds = 0;
+    size_t m_generatedElementsNum = 0;
+
+    double GetSeconds() const;
+  };
+
+  void SetPhaseSeconds(Phase phase, double seconds);
+  double GetPhaseSeconds(Phase phase) const;
+  //! Checks if duration of phase is cumulative thread time of sources rather than elapsed time.
+  static bool IsThreadTimePhase(Phase phase);
+
+  /*! Sets sources to profile. Each source can be profiled by different threads simultaneously, if each field of it is
+   * updated by one thread.
+   */
+  void SetSources(std::vector<std::string> const & fileNames);
+  std::vector<Source> & GetSources();
+
+  //! Prints durations of phases and the slowest sources.
+  void Print() const;
+
+  /*! Saves profile into file. Profile is saved in CSV format if file has `csv` extension, and in JSON format otherwise.
+   * @throws utils::ExceptionInvalidState if file can't be written.
+   */
+  void Save(std::string const & filePath) const;
+
+private:
+  static std::array<std::string, static_cast<size_t>(Phase::Count)> const PHASES_NAMES;
+
+  std::array<double, static_cast<size_t>(Phase::Count)> m_phasesSeconds{};
+  std::vector<Source> m_sources;
+
+  void SaveJSON(std::ostream & stream) const;
+  void SaveCSV(std::ostream & stream) const;
+};
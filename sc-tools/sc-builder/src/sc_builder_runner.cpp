@@ -7,6 +7,7 @@
 #include "sc_builder_runner.hpp"
 
 #include <iostream>
+#include <thread>
 
 #include <sc-config/sc_options.hpp>
 #include <sc-config/sc_config.hpp>
@@ -43,6 +44,26 @@ void PrintHelpMessage(std::string const & binaryName)
       << "Additional Options:\n"
       << "  --clear                                  Run sc-builder in a mode that overwrites existing knowledge base "
          "binaries.\n"
+      << "  --parse-threads|-t <number>              Specify the number of threads parsing knowledge base sources. "
+         "Parsed sources are generated into binaries in the same order regardless of this number.\n"
+         "                                           This number can also be provided via the `parse_threads` option "
+         "in the [sc-builder] group of the configuration file.\n"
+         "                                           By default, it is the number of hardware threads.\n"
+         "                                           The same number of threads traverses directories with sources "
+         "and reads sources ahead of parsing.\n"
+      << "  --incremental                            Run sc-builder in a mode that translates only changed sources and "
+         "sources depending on them.\n"
+         "                                           Hashes of sources and identifiers they define and use are stored "
+         "in `sc-builder.manifest` file next to binaries.\n"
+         "                                           If there is no manifest or --clear is specified, all sources are "
+         "translated.\n"
+      << "  --image <file>                           Save knowledge base image into specified file after build.\n"
+         "                                           Image can be loaded by sc-machine with --images option instead of "
+         "building knowledge base from sources.\n"
+      << "  --profile <file>                         Save build profile with durations of build phases and sources "
+         "into specified file.\n"
+         "                                           Profile is saved in CSV format if file has `.csv` extension, and "
+         "in JSON format otherwise.\n"
       << "  --version                                Display the version of " << binaryName << ".\n"
       << "  --help                                   Display this help message.\n";
 }
@@ -72,6 +93,10 @@ try
   if (options.Has({"output", "o"}))
     params.m_outputPath = options[{"output", "o"}].second;
 
+  std::string parseThreadsNum;
+  if (options.Has({"parse-threads", "t"}))
+    parseThreadsNum = options[{"parse-threads", "t"}].second;
+
   std::string configPath;
   if (options.Has({"config", "c"}))
     configPath = options[{"config", "c"}].second;
@@ -157,6 +182,31 @@ try
               << "For more information, run with --help.\n";
     return EXIT_FAILURE;
   }
+  if (parseThreadsNum.empty())
+    parseThreadsNum = builderGroup["parse_threads"];
+
+  params.m_parseThreadsNum = std::max<size_t>(1, std::thread::hardware_concurrency());
+  if (!parseThreadsNum.empty())
+  {
+    sc_uint64 number;
+    if (!utils::StringUtils::ParseNumber<sc_uint64>(parseThreadsNum, number) || number == 0)
+    {
+      std::cout << "Error: Number of parse threads should be a positive integer, but `" << parseThreadsNum
+                << "` is specified.\n"
+                << "For more information, run with --help.\n";
+      return EXIT_FAILURE;
+    }
+    params.m_parseThreadsNum = number;
+  }
+
+  params.m_incremental = options.Has({"incremental"});
+
+  if (options.Has({"image"}))
+    params.m_imagePath = options[{"image"}].second;
+
+  if (options.Has({"profile"}))
+    params.m_profilePath = options[{"profile"}].second;
+
   params.m_resultStructureUpload = formedMemoryParams.init_memory_generated_upload;
   if (formedMemoryParams.init_memory_generated_structure != nullptr)
     params.m_resultStructureSystemIdtf = formedMemoryParams.init_memory_generated_structure;
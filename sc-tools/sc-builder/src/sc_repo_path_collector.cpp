@@ -6,8 +6,13 @@
 
 #include "sc_repo_path_collector.hpp"
 
+#include <algorithm>
 #include <regex>
 #include <filesystem>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <queue>
 
 #include <sc-memory/sc_utils.hpp>
 
@@ -39,7 +44,10 @@ bool IsDirectory(std::string const & path)
 }
 }  // namespace impl
 
-ScRepoPathCollector::ScRepoPathCollector() = default;
+ScRepoPathCollector::ScRepoPathCollector(size_t threadsNum)
+  : m_threadsNum(std::max<size_t>(1, threadsNum))
+{
+}
 
 bool ScRepoPathCollector::IsSkipText(std::string const & string) const
 {
@@ -146,19 +154,95 @@ void ScRepoPathCollector::CollectBuildSources(
   if (!impl::IsDirectory(path))
     SC_THROW_EXCEPTION(utils::ExceptionInvalidState, "Sources path `" << path << "` is invalid.");
 
-  auto const & items = std::filesystem::directory_iterator{path};
-  for (auto const & item : items)
+  CollectDirectorySources(path, excludedSources, buildSources);
+}
+
+void ScRepoPathCollector::CollectDirectorySources(
+    std::string const & path,
+    Sources const & excludedSources,
+    Sources & buildSources)
+{
+  // directories are traversed by several threads, each thread takes the next directory from the common queue and
+  // appends its subdirectories into this queue
+  std::queue<std::string> directories;
+  directories.push(path);
+  size_t activeThreadsNum = 0;
+  std::exception_ptr error;
+  std::mutex mutex;
+  std::condition_variable directoryAppendedCond;
+
+  auto const & CollectSources = [&]()
   {
-    std::string const sourcePath = item.path();
+    while (true)
+    {
+      std::string directory;
+      {
+        std::unique_lock<std::mutex> lock(mutex);
+        directoryAppendedCond.wait(
+            lock,
+            [&]()
+            {
+              return error || !directories.empty() || activeThreadsNum == 0;
+            });
+        if (error || directories.empty())
+          return;
+
+        directory = std::move(directories.front());
+        directories.pop();
+        ++activeThreadsNum;
+      }
+
+      Sources directorySources;
+      std::vector<std::string> subdirectories;
+      std::exception_ptr directoryError;
+      try
+      {
+        // types of directory entries are read with entries, so files aren't checked one by one
+        for (auto const & item : std::filesystem::directory_iterator{directory})
+        {
+          std::string const sourcePath = item.path();
+
+          if (excludedSources.find(sourcePath) != excludedSources.cend())
+            continue;
+
+          if (item.is_regular_file())
+          {
+            std::string ext = GetFileExtension(sourcePath);
+            impl::NormalizeExt(ext);
+            if (m_supportedSourcesFormats.find(ext) != m_supportedSourcesFormats.cend())
+              directorySources.insert(sourcePath);
+          }
+          else if (item.is_directory())
+            subdirectories.push_back(sourcePath);
+        }
+      }
+      catch (...)
+      {
+        directoryError = std::current_exception();
+      }
+
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        buildSources.merge(directorySources);
+        for (std::string & subdirectory : subdirectories)
+          directories.push(std::move(subdirectory));
+        if (directoryError && !error)
+          error = directoryError;
+        --activeThreadsNum;
+      }
+      directoryAppendedCond.notify_all();
+    }
+  };
 
-    if (IsExcludedPath(sourcePath))
-      continue;
+  std::vector<std::thread> threads;
+  for (size_t i = 1; i < m_threadsNum; ++i)
+    threads.emplace_back(CollectSources);
+  CollectSources();
+  for (auto & thread : threads)
+    thread.join();
 
-    if (IsSourceFile(sourcePath))
-      buildSources.insert(sourcePath);
-    else if (impl::IsDirectory(sourcePath))
-      CollectBuildSources(sourcePath, excludedSources, buildSources);
-  }
+  if (error)
+    std::rethrow_exception(error);
 }
 
 void ScRepoPathCollector::CollectBuildSources(
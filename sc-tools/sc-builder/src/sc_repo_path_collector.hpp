@@ -12,7 +12,10 @@
 class ScRepoPathCollector
 {
 public:
-  ScRepoPathCollector();
+  /*! Creates collector of knowledge base sources.
+   * @param threadsNum Number of threads traversing directories with sources.
+   */
+  explicit ScRepoPathCollector(size_t threadsNum = 1);
 
   using Sources = std::unordered_set<std::string>;
 
@@ -34,7 +37,10 @@ public:
       Sources & buildSources);
 
 private:
+  size_t m_threadsNum;
+
   void CollectBuildSources(std::string const & path, Sources const & excludedSources, Sources & buildSources);
+  void CollectDirectorySources(std::string const & path, Sources const & excludedSources, Sources & buildSources);
 
   static std::unordered_set<std::string> const m_supportedSourcesFormats;
   static std::unordered_set<std::string> const m_supportedRepoPathFormats;
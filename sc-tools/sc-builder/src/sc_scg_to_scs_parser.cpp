@@ -0,0 +1,60 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "sc_scg_to_scs_parser.hpp"
+
+#include <sc-memory/sc_utils.hpp>
+
+#include "sc_scs_element.hpp"
+#include "sc_scs_writer.hpp"
+
+using namespace Constants;
+
+void SCgToSCsParser::Parse(SCgElements const & elements, std::string const & filePath)
+{
+  std::unordered_set<SCgElementPtr> writtenElements;
+  ProcessElements(elements, filePath, writtenElements);
+}
+
+void SCgToSCsParser::ProcessElements(
+    SCgElements const & elements,
+    std::string const & filePath,
+    std::unordered_set<SCgElementPtr> & writtenElements)
+{
+  SCsWriter::ForEachElement(
+      elements,
+      filePath,
+      writtenElements,
+      [&](SCsElementPtr const & scsElement)
+      {
+        scsElement->Process(*this, filePath, writtenElements);
+      });
+}
+
+scs::ElementHandle SCgToSCsParser::ProcessElement(std::string const & identifier)
+{
+  if (identifier.rfind(ALIAS_PREFIX, 0) != 0)
+    return ProcessIdentifier(identifier);
+
+  scs::ElementHandle const & handle = ResolveAlias(identifier);
+  if (!handle.IsValid())
+    SC_THROW_EXCEPTION(
+        utils::ExceptionParseError, "SCgToSCsParser::ProcessElement: Can't resolve alias `" << identifier << "`.");
+
+  return handle;
+}
+
+void SCgToSCsParser::ProcessMainIdentifier(scs::ElementHandle const & element, std::string const & mainIdentifier)
+{
+  scs::ElementHandle const & relation = ProcessIdentifier(NREL_MAIN_IDTF);
+  scs::ElementHandle const & link = ProcessContent(OPEN_BRACKET + mainIdentifier + CLOSE_BRACKET, false);
+
+  scs::ElementHandle const & connector = ProcessConnector(SC_CONNECTOR_DCOMMON_R);
+  ProcessTriple(element, connector, link);
+
+  scs::ElementHandle const & relationArc = ProcessConnector(SC_CONNECTOR_MAIN_R);
+  ProcessTriple(relation, relationArc, connector);
+}
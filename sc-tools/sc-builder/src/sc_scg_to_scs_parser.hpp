@@ -0,0 +1,49 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#pragma once
+
+#include <string>
+#include <unordered_set>
+
+#include <sc-memory/scs/scs_parser.hpp>
+
+#include "gwf_translator_constants.hpp"
+
+/*!
+ * Parser filling sc.s-elements and triples straight from sc.g-elements. Its result is the same as result of parsing of
+ * SCs-text written by SCsWriter for these sc.g-elements, but this text isn't rendered and parsed again.
+ */
+class SCgToSCsParser : public scs::Parser
+{
+public:
+  /*! Parses sc.g-elements without parents.
+   * @param elements Sc.g-elements to parse.
+   * @param filePath Path to file with sc.g-elements.
+   * @throws utils::ExceptionParseError if sc.g-elements can't be represented by sc.s-elements.
+   */
+  void Parse(SCgElements const & elements, std::string const & filePath);
+
+  //! Parses sc.g-elements in order, in which SCsWriter writes them.
+  void ProcessElements(
+      SCgElements const & elements,
+      std::string const & filePath,
+      std::unordered_set<SCgElementPtr> & writtenElements);
+
+  //! Resolves sc.s-element by its system identifier or by its alias.
+  scs::ElementHandle ProcessElement(std::string const & identifier);
+
+  //! Parses main identifier of sc.s-element, the same as SCsWriter::WriteMainIdentifier writes it.
+  void ProcessMainIdentifier(scs::ElementHandle const & element, std::string const & mainIdentifier);
+
+  using scs::Parser::ProcessAssign;
+  using scs::Parser::ProcessConnector;
+  using scs::Parser::ProcessContourBegin;
+  using scs::Parser::ProcessContourEnd;
+  using scs::Parser::ProcessIdentifier;
+  using scs::Parser::ProcessLink;
+  using scs::Parser::ProcessTriple;
+};
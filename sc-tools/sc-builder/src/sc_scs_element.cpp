@@ -15,6 +15,7 @@
 
 #include "sc_scg_element.hpp"
 #include "sc_scs_writer.hpp"
+#include "sc_scg_to_scs_parser.hpp"
 
 #include "sc_scg_to_scs_types_converter.hpp"
 
@@ -72,6 +73,20 @@ void SCsNode::Dump(
     SCsWriter::WriteMainIdentifier(buffer, depth, this->GetIdentifierForSCs(), this->GetMainIdentifier());
 }
 
+void SCsNode::Process(
+    SCgToSCsParser & parser,
+    std::string const & filePath,
+    std::unordered_set<SCgElementPtr> & writtenElements) const
+{
+  scs::ElementHandle const & node = parser.ProcessIdentifier(GetIdentifierForSCs());
+  scs::ElementHandle const & type = parser.ProcessIdentifier(m_type);
+  scs::ElementHandle const & connector = parser.ProcessConnector(SC_CONNECTOR_MAIN_L);
+  parser.ProcessTriple(node, connector, type);
+
+  if (!GetMainIdentifier().empty())
+    parser.ProcessMainIdentifier(node, GetMainIdentifier());
+}
+
 // SCsLink
 enum class ContentType
 {
@@ -126,27 +141,7 @@ void SCsLink::Dump(
   if (m_isUrl)
   {
     std::string imageFormat;
-
-    std::filesystem::path const & basePath = std::filesystem::path(filePath).parent_path();
-    std::filesystem::path const & fullPath = basePath / m_fileName;
-
-    std::string const & content = FILE_PREFIX + fullPath.filename().string();
-    std::string const & fileExtension = fullPath.extension().string();
-    auto it = IMAGE_FORMATS.find(fileExtension);
-    if (it == IMAGE_FORMATS.cend())
-      SC_THROW_EXCEPTION(
-          utils::ExceptionItemNotFound, "SCsLink::Dump: File extension `" << fileExtension << "` is not supported.");
-
-    imageFormat = it->second;
-
-    std::ofstream file(fullPath, std::ios::binary);
-    if (!file)
-      SC_THROW_EXCEPTION(
-          utils::ExceptionInvalidParams,
-          "SCsLink::Dump: Failed to open file for writing `" << fullPath.string() << "`.");
-
-    file.write(m_urlContent.data(), m_urlContent.size());
-    file.close();
+    std::string const & content = WriteImageFile(filePath, imageFormat);
 
     buffer.AddTabs(depth) << m_identifierForSCs << SPACE << EQUAL << SPACE << DOUBLE_QUOTE << content << DOUBLE_QUOTE
                           << ELEMENT_END << NEWLINE;
@@ -164,6 +159,59 @@ void SCsLink::Dump(
   }
 }
 
+void SCsLink::Process(
+    SCgToSCsParser & parser,
+    std::string const & filePath,
+    std::unordered_set<SCgElementPtr> & writtenElements) const
+{
+  scs::ElementHandle const & link = parser.ProcessIdentifier(m_identifierForSCs);
+
+  if (m_isUrl)
+  {
+    std::string imageFormat;
+    std::string const & content = WriteImageFile(filePath, imageFormat);
+    parser.ProcessLink(link, DOUBLE_QUOTE + content + DOUBLE_QUOTE, true);
+
+    scs::ElementHandle const & format = parser.ProcessIdentifier(imageFormat);
+    scs::ElementHandle const & formatArc = parser.ProcessConnector(SC_CONNECTOR_DCOMMON_R);
+    parser.ProcessTriple(link, formatArc, format);
+    parser.ProcessAssign(FORMAT_ARC, formatArc);
+
+    scs::ElementHandle const & relation = parser.ProcessIdentifier(NREL_FORMAT);
+    scs::ElementHandle const & relationArc = parser.ProcessConnector(SC_CONNECTOR_MAIN_R);
+    parser.ProcessTriple(relation, relationArc, formatArc);
+    parser.ProcessAssign(NREL_FORMAT_ARC, relationArc);
+  }
+  else
+    parser.ProcessLink(link, OPEN_BRACKET + m_content + CLOSE_BRACKET);
+}
+
+std::string SCsLink::WriteImageFile(std::string const & filePath, std::string & imageFormat) const
+{
+  std::filesystem::path const & basePath = std::filesystem::path(filePath).parent_path();
+  std::filesystem::path const & fullPath = basePath / m_fileName;
+
+  std::string const & fileExtension = fullPath.extension().string();
+  auto it = IMAGE_FORMATS.find(fileExtension);
+  if (it == IMAGE_FORMATS.cend())
+    SC_THROW_EXCEPTION(
+        utils::ExceptionItemNotFound,
+        "SCsLink::WriteImageFile: File extension `" << fileExtension << "` is not supported.");
+
+  imageFormat = it->second;
+
+  std::ofstream file(fullPath, std::ios::binary);
+  if (!file)
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidParams,
+        "SCsLink::WriteImageFile: Failed to open file for writing `" << fullPath.string() << "`.");
+
+  file.write(m_urlContent.data(), m_urlContent.size());
+  file.close();
+
+  return FILE_PREFIX + fullPath.filename().string();
+}
+
 // SCsConnector
 void SCsConnector::ConvertFromSCgElement(SCgElementPtr const & scgElement)
 {
@@ -216,6 +264,25 @@ void SCsConnector::Dump(
   }
 }
 
+void SCsConnector::Process(
+    SCgToSCsParser & parser,
+    std::string const & filePath,
+    std::unordered_set<SCgElementPtr> & writtenElements) const
+{
+  scs::ElementHandle const & source = parser.ProcessElement(m_sourceIdentifier);
+  scs::ElementHandle const & target = parser.ProcessElement(m_targetIdentifier);
+  scs::ElementHandle const & connector = parser.ProcessConnector(m_isUnsupported ? SC_CONNECTOR_DCOMMON_R : m_type);
+  parser.ProcessTriple(source, connector, target);
+  parser.ProcessAssign(m_identifierForSCs, connector);
+
+  if (m_isUnsupported)
+  {
+    scs::ElementHandle const & type = parser.ProcessIdentifier(m_type);
+    scs::ElementHandle const & typeArc = parser.ProcessConnector(SC_CONNECTOR_MAIN_R);
+    parser.ProcessTriple(type, typeArc, connector);
+  }
+}
+
 // SCsContour
 void SCsContour::ConvertFromSCgElement(SCgElementPtr const & scgElement)
 {
@@ -243,6 +310,17 @@ void SCsContour::Dump(
   buffer.AddTabs(depth) << CLOSE_CONTOUR << ELEMENT_END << NEWLINE;
 }
 
+void SCsContour::Process(
+    SCgToSCsParser & parser,
+    std::string const & filePath,
+    std::unordered_set<SCgElementPtr> & writtenElements) const
+{
+  scs::ElementHandle const & contour = parser.ProcessIdentifier(GetIdentifierForSCs());
+  parser.ProcessContourBegin();
+  parser.ProcessElements(m_scgElements, filePath, writtenElements);
+  parser.ProcessContourEnd(contour);
+}
+
 // SCsFactory
 
 SCsElementPtr SCsElementFactory::CreateSCsElementForSCgElement(SCgElementPtr const & scgElement)
@@ -13,6 +13,8 @@
 #include "gwf_translator_constants.hpp"
 #include "sc_scg_element.hpp"
 
+class SCgToSCsParser;
+
 class SCsElement
 {
 public:
@@ -22,6 +24,11 @@ public:
       Buffer & buffer,
       size_t depth,
       std::unordered_set<SCgElementPtr> & writtenElements) const = 0;
+  //! Parses sc.s-element the same way as SCs-text written by Dump would be parsed.
+  virtual void Process(
+      SCgToSCsParser & parser,
+      std::string const & filePath,
+      std::unordered_set<SCgElementPtr> & writtenElements) const = 0;
   virtual ~SCsElement() = default;
 
   void SetIdentifierForSCs(std::string const & identifier);
@@ -44,6 +51,10 @@ public:
       Buffer & buffer,
       size_t depth,
       std::unordered_set<SCgElementPtr> & writtenElements) const override;
+  void Process(
+      SCgToSCsParser & parser,
+      std::string const & filePath,
+      std::unordered_set<SCgElementPtr> & writtenElements) const override;
 };
 
 class SCsLink : public SCsElement
@@ -55,8 +66,14 @@ public:
       Buffer & buffer,
       size_t depth,
       std::unordered_set<SCgElementPtr> & writtenElements) const override;
+  void Process(
+      SCgToSCsParser & parser,
+      std::string const & filePath,
+      std::unordered_set<SCgElementPtr> & writtenElements) const override;
 
 private:
+  std::string WriteImageFile(std::string const & filePath, std::string & imageFormat) const;
+
   bool m_isUrl{false};
   std::string m_fileName;
   std::string m_content;
@@ -72,6 +89,10 @@ public:
       Buffer & buffer,
       size_t depth,
       std::unordered_set<SCgElementPtr> & writtenElements) const override;
+  void Process(
+      SCgToSCsParser & parser,
+      std::string const & filePath,
+      std::unordered_set<SCgElementPtr> & writtenElements) const override;
   static std::string GetIncidentElementIdentifier(SCgElementPtr const & element);
 
 private:
@@ -89,6 +110,10 @@ public:
       Buffer & buffer,
       size_t depth,
       std::unordered_set<SCgElementPtr> & writtenElements) const override;
+  void Process(
+      SCgToSCsParser & parser,
+      std::string const & filePath,
+      std::unordered_set<SCgElementPtr> & writtenElements) const override;
 
 private:
   SCgElements m_scgElements;
@@ -98,6 +98,22 @@ void SCsWriter::Write(
     Buffer & buffer,
     size_t depth,
     std::unordered_set<SCgElementPtr> & writtenElements)
+{
+  ForEachElement(
+      elements,
+      filePath,
+      writtenElements,
+      [&](SCsElementPtr const & scsElement)
+      {
+        scsElement->Dump(filePath, buffer, depth, writtenElements);
+      });
+}
+
+void SCsWriter::ForEachElement(
+    SCgElements const & elements,
+    std::string const & filePath,
+    std::unordered_set<SCgElementPtr> & writtenElements,
+    std::function<void(SCsElementPtr const &)> const & callback)
 {
   std::list<SCgElementPtr> dependedConnectors;
 
@@ -128,7 +144,7 @@ void SCsWriter::Write(
     {
       auto const & scsElement = SCsElementFactory::CreateSCsElementForSCgElement(scgElement);
       scsElement->ConvertFromSCgElement(scgElement);
-      scsElement->Dump(filePath, buffer, depth, writtenElements);
+      callback(scsElement);
       writtenElements.insert(scgElement);
     }
 
@@ -152,7 +168,7 @@ void SCsWriter::Write(
         {
           auto const & scsElement = SCsElementFactory::CreateSCsElementForSCgElement(*dependedConnector);
           scsElement->ConvertFromSCgElement(*dependedConnector);
-          scsElement->Dump(filePath, buffer, depth, writtenElements);
+          callback(scsElement);
           writtenElements.insert(*dependedConnector);
           ++connectorsWrittenOnPreviousIteration;
           dependedConnector = dependedConnectors.erase(dependedConnector);
@@ -8,6 +8,7 @@
 
 #include <string>
 #include <sstream>
+#include <functional>
 #include <unordered_set>
 
 #include "buffer.hpp"
@@ -24,6 +25,17 @@ public:
       size_t depth,
       std::unordered_set<SCgElementPtr> & writtenElements);
 
+  /*! Converts sc.g-elements into sc.s-elements in order, in which they should be written: sc.g-connectors are written
+   * after their incident sc.g-elements.
+   * @param callback Function called for each converted sc.s-element before its sc.g-element is marked as written.
+   * @throws utils::ExceptionInvalidState if there are sc.g-connectors with unknown incident sc.g-elements.
+   */
+  static void ForEachElement(
+      SCgElements const & elements,
+      std::string const & filePath,
+      std::unordered_set<SCgElementPtr> & writtenElements,
+      std::function<void(SCsElementPtr const &)> const & callback);
+
   class SCgIdentifierCorrector
   {
   public:
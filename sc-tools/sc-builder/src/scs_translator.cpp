@@ -13,6 +13,8 @@
 #include <sc-memory/sc_memory.hpp>
 #include <sc-memory/sc_scs_helper.hpp>
 
+#include <sc-memory/scs/scs_parser.hpp>
+
 extern "C"
 {
 #include <sc-core/sc-container/sc_string.h>
@@ -63,20 +65,36 @@ private:
 
 }  // namespace impl
 
-SCsTranslator::SCsTranslator(ScMemoryContext & context)
+SCsTranslator::SCsTranslator(ScMemoryContext & context, SCsIdentifiersCachePtr identifiersCache)
   : Translator(context)
+  , m_identifiersCache(std::move(identifiersCache))
 {
 }
 
-bool SCsTranslator::TranslateImpl(Params const & params)
+std::unique_ptr<scs::Parser> SCsTranslator::Parse(Params const & params) const
 {
-  std::string data;
-  GetFileContent(params.m_fileName, data);
+  std::string buffer;
+  return ParseSCsText(GetFileContent(params, buffer));
+}
 
-  SCsHelper scs(m_ctx, std::make_shared<impl::FileProvider>(params.m_fileName));
+bool SCsTranslator::Generate(Params const & params, scs::Parser const & parser)
+{
+  SCsHelper scs(m_ctx, std::make_shared<impl::FileProvider>(params.m_fileName), m_identifiersCache);
 
-  if (!scs.GenerateBySCsText(data, params.m_outputStructure))
+  bool const status = params.m_generatedElements == nullptr
+                          ? scs.GenerateByParsedSCs(parser, params.m_outputStructure)
+                          : scs.GenerateByParsedSCs(parser, params.m_outputStructure, *params.m_generatedElements);
+  if (!status)
     SC_THROW_EXCEPTION(utils::ExceptionParseError, scs.GetLastError());
 
   return true;
 }
+
+std::unique_ptr<scs::Parser> SCsTranslator::ParseSCsText(std::string const & scsText)
+{
+  auto parser = std::make_unique<scs::Parser>();
+  if (!parser->Parse(scsText))
+    SC_THROW_EXCEPTION(utils::ExceptionParseError, parser->GetParseError());
+
+  return parser;
+}
@@ -6,13 +6,26 @@
 
 #pragma once
 
+#include <sc-memory/sc_scs_helper.hpp>
+
 #include "sc-builder/translator.hpp"
 
 class SCsTranslator : public Translator
 {
 public:
-  explicit SCsTranslator(class ScMemoryContext & context);
+  /*! @param context Sc-memory context to generate sources.
+   * @param identifiersCache Cache of sc-elements by identifiers shared by translators of all sources.
+   */
+  explicit SCsTranslator(class ScMemoryContext & context, SCsIdentifiersCachePtr identifiersCache = nullptr);
   ~SCsTranslator() override = default;
 
-  bool TranslateImpl(Params const & params) override;
+  std::unique_ptr<scs::Parser> Parse(Params const & params) const override;
+
+  bool Generate(Params const & params, scs::Parser const & parser) override;
+
+  //! Parse SCs-text. It can be called from several threads simultaneously.
+  static std::unique_ptr<scs::Parser> ParseSCsText(std::string const & scsText);
+
+private:
+  SCsIdentifiersCachePtr m_identifiersCache;
 };
@@ -9,6 +9,8 @@
 #include <sc-memory/sc_memory.hpp>
 #include <sc-memory/sc_keynodes.hpp>
 
+#include <sc-memory/scs/scs_parser.hpp>
+
 Translator::Translator(ScMemoryContext & ctx)
   : m_ctx(ctx)
 {
@@ -19,14 +21,36 @@ bool Translator::Translate(Params const & params)
   return TranslateImpl(params);
 }
 
+bool Translator::TranslateImpl(Params const & params)
+{
+  std::unique_ptr<scs::Parser> const & parser = Parse(params);
+  return Generate(params, *parser);
+}
+
 void Translator::GetFileContent(std::string const & fileName, std::string & outContent)
 {
-  std::ifstream ifs(fileName);
+  std::ifstream ifs(fileName, std::ios::binary | std::ios::ate);
   if (!ifs.is_open())
     SC_THROW_EXCEPTION(utils::ExceptionInvalidState, "Can't open file " << fileName);
 
-  outContent.assign((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
-  ifs.close();
+  // file is read by one call instead of reading it symbol by symbol
+  std::streamoff const size = ifs.tellg();
+  if (size < 0)
+    SC_THROW_EXCEPTION(utils::ExceptionInvalidState, "Can't read file " << fileName);
+
+  outContent.resize(static_cast<size_t>(size));
+  ifs.seekg(0);
+  if (!ifs.read(outContent.data(), size))
+    SC_THROW_EXCEPTION(utils::ExceptionInvalidState, "Can't read file " << fileName);
+}
+
+std::string const & Translator::GetFileContent(Params const & params, std::string & buffer)
+{
+  if (params.m_fileContent != nullptr)
+    return *params.m_fileContent;
+
+  GetFileContent(params.m_fileName, buffer);
+  return buffer;
 }
 
 void Translator::Clean(ScMemoryContext & ctx)
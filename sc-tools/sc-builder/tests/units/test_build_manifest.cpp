@@ -0,0 +1,153 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <filesystem>
+
+#include <sc-memory/sc_utils.hpp>
+
+#include "sc_build_manifest.hpp"
+
+class ScBuildManifestTest : public testing::Test
+{
+public:
+  static inline std::string const & SC_BUILDER_MANIFEST_DIRECTORY = "sc-builder-test-manifest";
+
+protected:
+  void SetUp() override
+  {
+    std::filesystem::create_directories(SC_BUILDER_MANIFEST_DIRECTORY);
+
+    ScBuildManifest::Sources & sources = m_manifest.GetSources();
+    sources["a.scs"] = {"1", {"concept_a"}, {}, {}, {Node(1), Node(2), Arc(6, 1, 2)}};
+    sources["b.scs"] = {"2", {"concept_b"}, {"concept_a"}, {}, {Node(3)}};
+    sources["c.scs"] = {"3", {}, {"concept_b"}, {"..global"}, {Node(4)}};
+    sources["d.scs"] = {"4", {}, {}, {"..global"}, {}};
+    sources["e.scs"] = {"5", {"concept_e"}, {}, {}, {Node(5)}};
+  }
+
+  void TearDown() override
+  {
+    std::filesystem::remove_all(SC_BUILDER_MANIFEST_DIRECTORY);
+  }
+
+  static ScBuildManifest::Element Node(ScAddr::HashType hash)
+  {
+    return {ScAddr(hash), ScType::ConstNode, ScAddr::Empty, ScAddr::Empty};
+  }
+
+  static ScBuildManifest::Element Arc(
+      ScAddr::HashType hash,
+      ScAddr::HashType sourceHash,
+      ScAddr::HashType targetHash)
+  {
+    return {ScAddr(hash), ScType::ConstPermPosArc, ScAddr(sourceHash), ScAddr(targetHash)};
+  }
+
+  ScBuildManifest m_manifest{SC_BUILDER_MANIFEST_DIRECTORY};
+};
+
+TEST_F(ScBuildManifestTest, NoChangedSources)
+{
+  ScBuildManifest::SourcesHashes const hashes = {
+      {"a.scs", "1"}, {"b.scs", "2"}, {"c.scs", "3"}, {"d.scs", "4"}, {"e.scs", "5"}};
+  EXPECT_TRUE(m_manifest.ResolveChangedSources(hashes).empty());
+}
+
+TEST_F(ScBuildManifestTest, ChangedSourceWithDependentSources)
+{
+  ScBuildManifest::SourcesHashes const hashes = {
+      {"a.scs", "10"}, {"b.scs", "2"}, {"c.scs", "3"}, {"d.scs", "4"}, {"e.scs", "5"}};
+  std::set<std::string> const expectedSources = {"a.scs", "b.scs", "c.scs", "d.scs"};
+  EXPECT_EQ(m_manifest.ResolveChangedSources(hashes), expectedSources);
+}
+
+TEST_F(ScBuildManifestTest, ChangedSourceWithoutDependentSources)
+{
+  ScBuildManifest::SourcesHashes const hashes = {
+      {"a.scs", "1"}, {"b.scs", "2"}, {"c.scs", "3"}, {"d.scs", "4"}, {"e.scs", "50"}};
+  std::set<std::string> const expectedSources = {"e.scs"};
+  EXPECT_EQ(m_manifest.ResolveChangedSources(hashes), expectedSources);
+}
+
+TEST_F(ScBuildManifestTest, NewAndRemovedSources)
+{
+  ScBuildManifest::SourcesHashes const hashes = {
+      {"a.scs", "1"}, {"b.scs", "2"}, {"c.scs", "3"}, {"e.scs", "5"}, {"f.scs", "6"}};
+  std::set<std::string> const expectedSources = {"c.scs", "d.scs", "f.scs"};
+  EXPECT_EQ(m_manifest.ResolveChangedSources(hashes), expectedSources);
+}
+
+TEST_F(ScBuildManifestTest, SaveAndLoad)
+{
+  m_manifest.Save();
+
+  ScBuildManifest manifest{SC_BUILDER_MANIFEST_DIRECTORY};
+  EXPECT_TRUE(manifest.Load());
+
+  ScBuildManifest::Sources const & expectedSources = m_manifest.GetSources();
+  ScBuildManifest::Sources const & sources = manifest.GetSources();
+  EXPECT_EQ(sources.size(), expectedSources.size());
+  for (auto const & [path, expectedSource] : expectedSources)
+  {
+    auto const & it = sources.find(path);
+    ASSERT_NE(it, sources.cend());
+    EXPECT_EQ(it->second.m_hash, expectedSource.m_hash);
+    EXPECT_EQ(it->second.m_definedIdtfs, expectedSource.m_definedIdtfs);
+    EXPECT_EQ(it->second.m_usedIdtfs, expectedSource.m_usedIdtfs);
+    EXPECT_EQ(it->second.m_globalIdtfs, expectedSource.m_globalIdtfs);
+    EXPECT_EQ(it->second.m_elements, expectedSource.m_elements);
+  }
+
+  manifest.Remove();
+  EXPECT_FALSE(manifest.Load());
+}
+
+TEST_F(ScBuildManifestTest, LoadInvalidManifest)
+{
+  {
+    std::ofstream file(SC_BUILDER_MANIFEST_DIRECTORY + "/sc-builder.manifest");
+    file << "invalid manifest\n";
+  }
+
+  ScBuildManifest manifest{SC_BUILDER_MANIFEST_DIRECTORY};
+  EXPECT_FALSE(manifest.Load());
+  EXPECT_TRUE(manifest.GetSources().empty());
+}
+
+TEST_F(ScBuildManifestTest, LoadManifestWithIncompleteConnector)
+{
+  {
+    std::ofstream file(SC_BUILDER_MANIFEST_DIRECTORY + "/sc-builder.manifest");
+    file << "sc-builder-manifest 2\n";
+    file << "source 1 a.scs\n";
+    file << "elements 1 " << *ScType::ConstNode << " 6 " << *ScType::ConstPermPosArc << " 1\n";
+  }
+
+  ScBuildManifest manifest{SC_BUILDER_MANIFEST_DIRECTORY};
+  EXPECT_FALSE(manifest.Load());
+  EXPECT_TRUE(manifest.GetSources().empty());
+}
+
+TEST_F(ScBuildManifestTest, CalculateHash)
+{
+  std::string const & firstFilePath = SC_BUILDER_MANIFEST_DIRECTORY + "/first.scs";
+  std::string const & secondFilePath = SC_BUILDER_MANIFEST_DIRECTORY + "/second.scs";
+  {
+    std::ofstream firstFile(firstFilePath);
+    firstFile << "concept_a -> a;;";
+    std::ofstream secondFile(secondFilePath);
+    secondFile << "concept_a -> b;;";
+  }
+
+  std::string const & firstHash = ScBuildManifest::CalculateHash(firstFilePath);
+  EXPECT_EQ(firstHash, ScBuildManifest::CalculateHash(firstFilePath));
+  EXPECT_NE(firstHash, ScBuildManifest::CalculateHash(secondFilePath));
+  EXPECT_THROW(
+      ScBuildManifest::CalculateHash(SC_BUILDER_MANIFEST_DIRECTORY + "/unknown.scs"), utils::ExceptionInvalidState);
+}
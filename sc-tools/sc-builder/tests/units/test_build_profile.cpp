@@ -0,0 +1,98 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <filesystem>
+
+#include <sc-memory/sc_utils.hpp>
+
+#include "sc_build_profile.hpp"
+
+class ScBuildProfileTest : public testing::Test
+{
+public:
+  static inline std::string const & SC_BUILDER_PROFILE_JSON = "sc-builder-test-profile.json";
+  static inline std::string const & SC_BUILDER_PROFILE_CSV = "sc-builder-test-profile.csv";
+
+protected:
+  void SetUp() override
+  {
+    m_profile.SetPhaseSeconds(ScBuildProfile::Phase::Collect, 1);
+    m_profile.SetPhaseSeconds(ScBuildProfile::Phase::Build, 10);
+    m_profile.SetSources({"a.scs", "b,\"c\".scs"});
+
+    std::vector<ScBuildProfile::Source> & sources = m_profile.GetSources();
+    sources[0].m_size = 100;
+    sources[0].m_readSeconds = 0.5;
+    sources[0].m_parseSeconds = 1;
+    sources[0].m_generateSeconds = 2;
+    sources[0].m_generatedElementsNum = 3;
+    sources[1].m_readSeconds = 0.25;
+    sources[1].m_parseSeconds = 2;
+  }
+
+  void TearDown() override
+  {
+    std::filesystem::remove(SC_BUILDER_PROFILE_JSON);
+    std::filesystem::remove(SC_BUILDER_PROFILE_CSV);
+  }
+
+  static std::string ReadFile(std::string const & filePath)
+  {
+    std::ifstream stream(filePath);
+    return {std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>()};
+  }
+
+  ScBuildProfile m_profile;
+};
+
+TEST_F(ScBuildProfileTest, PhasesSeconds)
+{
+  EXPECT_EQ(m_profile.GetPhaseSeconds(ScBuildProfile::Phase::Collect), 1);
+  EXPECT_EQ(m_profile.GetPhaseSeconds(ScBuildProfile::Phase::Build), 10);
+  EXPECT_EQ(m_profile.GetPhaseSeconds(ScBuildProfile::Phase::Save), 0);
+
+  // thread times of sources phases are summed up by all sources
+  EXPECT_TRUE(ScBuildProfile::IsThreadTimePhase(ScBuildProfile::Phase::Parse));
+  EXPECT_FALSE(ScBuildProfile::IsThreadTimePhase(ScBuildProfile::Phase::Sources));
+  EXPECT_EQ(m_profile.GetPhaseSeconds(ScBuildProfile::Phase::Read), 0.75);
+  EXPECT_EQ(m_profile.GetPhaseSeconds(ScBuildProfile::Phase::Parse), 3);
+  EXPECT_EQ(m_profile.GetPhaseSeconds(ScBuildProfile::Phase::Generate), 2);
+
+  EXPECT_EQ(m_profile.GetSources()[0].GetSeconds(), 3.5);
+}
+
+TEST_F(ScBuildProfileTest, SaveJSON)
+{
+  m_profile.Save(SC_BUILDER_PROFILE_JSON);
+
+  std::string const & report = ReadFile(SC_BUILDER_PROFILE_JSON);
+  EXPECT_NE(report.find("\"collect\": 1"), std::string::npos);
+  EXPECT_NE(report.find("\"parse_thread_time\": 3,"), std::string::npos);
+  EXPECT_NE(
+      report.find(
+          "{\"file\": \"a.scs\", \"size\": 100, \"read\": 0.5, \"parse\": 1, \"generate\": 2, \"elements\": 3}"),
+      std::string::npos);
+  EXPECT_NE(report.find("\"file\": \"b,\\\"c\\\".scs\""), std::string::npos);
+}
+
+TEST_F(ScBuildProfileTest, SaveCSV)
+{
+  m_profile.Save(SC_BUILDER_PROFILE_CSV);
+
+  std::string const & report = ReadFile(SC_BUILDER_PROFILE_CSV);
+  EXPECT_EQ(report.find("kind,name,seconds,size,read,parse,generate,elements\n"), 0u);
+  EXPECT_NE(report.find("phase,build,10,,,,,\n"), std::string::npos);
+  EXPECT_NE(report.find("source,a.scs,3.5,100,0.5,1,2,3\n"), std::string::npos);
+  EXPECT_NE(report.find("source,\"b,\"\"c\"\".scs\",2.25,0,0.25,2,0,0\n"), std::string::npos);
+}
+
+TEST_F(ScBuildProfileTest, SaveIntoInvalidPath)
+{
+  EXPECT_THROW(m_profile.Save("unknown-directory/profile.json"), utils::ExceptionInvalidState);
+}
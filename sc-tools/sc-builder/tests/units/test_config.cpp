@@ -6,6 +6,8 @@
 
 #include "builder_test.hpp"
 
+#include <fstream>
+
 #include <sc-builder/builder.hpp>
 
 #include <sc-config/sc_options.hpp>
@@ -123,6 +125,189 @@ TEST(ScBuilder, RunWithoutConfig)
   EXPECT_EQ(RunBuilder(argsNumber, (sc_char **)args), EXIT_SUCCESS);
 }
 
+TEST(ScBuilder, RunWithParseThreads)
+{
+  sc_uint32 const argsNumber = 8;
+  sc_char const * args[argsNumber] = {
+      "sc-builder",
+      "-i",
+      ScBuilderTest::SC_BUILDER_REPO_PATH.c_str(),
+      "-o",
+      ScBuilderTest::SC_BUILDER_KB_BIN.c_str(),
+      "-t",
+      "4",
+      "--clear"};
+  EXPECT_EQ(RunBuilder(argsNumber, (sc_char **)args), EXIT_SUCCESS);
+}
+
+TEST(ScBuilder, RunWithInvalidParseThreads)
+{
+  sc_uint32 const argsNumber = 8;
+  sc_char const * args[argsNumber] = {
+      "sc-builder",
+      "-i",
+      ScBuilderTest::SC_BUILDER_REPO_PATH.c_str(),
+      "-o",
+      ScBuilderTest::SC_BUILDER_KB_BIN.c_str(),
+      "--parse-threads",
+      "0",
+      "--clear"};
+  EXPECT_EQ(RunBuilder(argsNumber, (sc_char **)args), EXIT_FAILURE);
+}
+
+TEST(ScBuilder, RunIncrementally)
+{
+  sc_uint32 const argsNumber = 7;
+  sc_char const * args[argsNumber] = {
+      "sc-builder",
+      "-i",
+      ScBuilderTest::SC_BUILDER_REPO_PATH.c_str(),
+      "-o",
+      ScBuilderTest::SC_BUILDER_KB_BIN.c_str(),
+      "--incremental",
+      "--clear"};
+  EXPECT_EQ(RunBuilder(argsNumber, (sc_char **)args), EXIT_SUCCESS);
+
+  std::string const & manifestPath = ScBuilderTest::SC_BUILDER_KB_BIN + "/sc-builder.manifest";
+  EXPECT_TRUE(std::filesystem::exists(manifestPath));
+
+  // nothing is changed, so binaries are updated without translation of sources
+  EXPECT_EQ(RunBuilder(argsNumber - 1, (sc_char **)args), EXIT_SUCCESS);
+  EXPECT_TRUE(std::filesystem::exists(manifestPath));
+
+  std::filesystem::remove_all(ScBuilderTest::SC_BUILDER_KB_BIN);
+}
+
+TEST(ScBuilder, RunIncrementallyWithChangedSource)
+{
+  std::string const & repoPath = "sc-builder-test-incremental-repo";
+  std::filesystem::create_directories(repoPath);
+  auto const & writeSource = [&repoPath](std::string const & fileName, std::string const & content)
+  {
+    std::ofstream stream(repoPath + "/" + fileName, std::ios::trunc);
+    stream << content;
+  };
+
+  // sources are translated in sorted order, so set is generated from the first source and used by the second one
+  writeSource("a-set.scs", "sc_builder_test_set -> sc_builder_test_old_element;;");
+  writeSource("b-dependent.scs", "sc_builder_test_dependent -> sc_builder_test_set;;");
+
+  sc_uint32 const argsNumber = 7;
+  sc_char const * args[argsNumber] = {
+      "sc-builder",
+      "-i",
+      repoPath.c_str(),
+      "-o",
+      ScBuilderTest::SC_BUILDER_KB_BIN.c_str(),
+      "--incremental",
+      "--clear"};
+  EXPECT_EQ(RunBuilder(argsNumber, (sc_char **)args), EXIT_SUCCESS);
+
+  writeSource("a-set.scs", "sc_builder_test_set -> sc_builder_test_new_element;;");
+  EXPECT_EQ(RunBuilder(argsNumber - 1, (sc_char **)args), EXIT_SUCCESS);
+
+  sc_memory_params params;
+  sc_memory_params_clear(&params);
+  params.dump_memory = SC_FALSE;
+  params.dump_memory_statistics = SC_FALSE;
+  params.clear = SC_FALSE;
+  params.storage = ScBuilderTest::SC_BUILDER_KB_BIN.c_str();
+  ScMemory::Initialize(params);
+  {
+    ScMemoryContext context;
+    // sc-elements generated from previous version of changed source are erased
+    EXPECT_FALSE(context.SearchElementBySystemIdentifier("sc_builder_test_old_element").IsValid());
+
+    ScAddr const & setAddr = context.SearchElementBySystemIdentifier("sc_builder_test_set");
+    ScAddr const & newElementAddr = context.SearchElementBySystemIdentifier("sc_builder_test_new_element");
+    EXPECT_TRUE(setAddr.IsValid());
+    EXPECT_TRUE(newElementAddr.IsValid());
+    EXPECT_TRUE(context.CheckConnector(setAddr, newElementAddr, ScType::ConstPermPosArc));
+    EXPECT_EQ(context.CreateIterator3(setAddr, ScType::ConstPermPosArc, ScType::Unknown)->Count(), 1u);
+
+    // dependent source is translated again, so it refers to the new sc-element of set
+    ScAddr const & dependentAddr = context.SearchElementBySystemIdentifier("sc_builder_test_dependent");
+    EXPECT_TRUE(dependentAddr.IsValid());
+    ScIterator3Ptr const it3 = context.CreateIterator3(dependentAddr, ScType::ConstPermPosArc, ScType::Unknown);
+    EXPECT_TRUE(it3->Next());
+    EXPECT_EQ(it3->Get(2), setAddr);
+    EXPECT_FALSE(it3->Next());
+  }
+  ScMemory::Shutdown(SC_FALSE);
+
+  std::filesystem::remove_all(repoPath);
+  std::filesystem::remove_all(ScBuilderTest::SC_BUILDER_KB_BIN);
+}
+
+TEST(ScBuilder, RunIncrementallyWithChangedManifestElements)
+{
+  sc_uint32 const argsNumber = 7;
+  sc_char const * args[argsNumber] = {
+      "sc-builder",
+      "-i",
+      ScBuilderTest::SC_BUILDER_REPO_PATH.c_str(),
+      "-o",
+      ScBuilderTest::SC_BUILDER_KB_BIN.c_str(),
+      "--incremental",
+      "--clear"};
+  EXPECT_EQ(RunBuilder(argsNumber, (sc_char **)args), EXIT_SUCCESS);
+
+  // type of sc-element from manifest differs as if its sc-address is reused by other sc-element
+  {
+    ScBuildManifest manifest{ScBuilderTest::SC_BUILDER_KB_BIN};
+    EXPECT_TRUE(manifest.Load());
+
+    bool isChanged = false;
+    for (auto & [fileName, source] : manifest.GetSources())
+    {
+      for (ScBuildManifest::Element & element : source.m_elements)
+      {
+        if (element.m_type.IsConnector())
+          continue;
+
+        element.m_type = *element.m_type == *ScType::ConstNode ? ScType::ConstNodeClass : ScType::ConstNode;
+        isChanged = true;
+        break;
+      }
+
+      if (isChanged)
+        break;
+    }
+    EXPECT_TRUE(isChanged);
+    manifest.Save();
+  }
+
+  auto const & initialize = []()
+  {
+    sc_memory_params params;
+    sc_memory_params_clear(&params);
+    params.dump_memory = SC_FALSE;
+    params.dump_memory_statistics = SC_FALSE;
+    params.clear = SC_FALSE;
+    params.storage = ScBuilderTest::SC_BUILDER_KB_BIN.c_str();
+    ScMemory::Initialize(params);
+  };
+
+  initialize();
+  {
+    ScMemoryContext context;
+    context.SetElementSystemIdentifier("sc_builder_test_extra_node", context.GenerateNode(ScType::ConstNode));
+  }
+  ScMemory::Shutdown(SC_TRUE);
+
+  // manifest can't be trusted, so all sources are built into cleared binaries
+  EXPECT_EQ(RunBuilder(argsNumber - 1, (sc_char **)args), EXIT_SUCCESS);
+
+  initialize();
+  {
+    ScMemoryContext context;
+    EXPECT_FALSE(context.SearchElementBySystemIdentifier("sc_builder_test_extra_node").IsValid());
+  }
+  ScMemory::Shutdown(SC_FALSE);
+
+  std::filesystem::remove_all(ScBuilderTest::SC_BUILDER_KB_BIN);
+}
+
 TEST(ScBuilder, RunWithoutInput)
 {
   sc_uint32 const argsNumber = 4;
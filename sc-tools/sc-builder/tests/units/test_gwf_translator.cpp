@@ -15,6 +15,8 @@
 
 #include <sc-memory/sc_utils.hpp>
 
+#include <sc-memory/scs/scs_parser.hpp>
+
 #include "builder_test.hpp"
 
 #include "gwf_translator.hpp"
@@ -64,6 +66,48 @@ Differences CheckGWFToSCSTranslation(std::string const & fileName)
   return testSCsTree.Compare(correctSCsTree);
 }
 
+std::string ParsedElementToString(scs::Parser const & parser, scs::ElementHandle const & handle)
+{
+  scs::ParsedElement const & element = parser.GetParsedElement(handle);
+  return element.GetIdtf() + " " + std::string(element.GetType()) + " " + element.GetValue() + " "
+         + std::to_string(element.IsURL());
+}
+
+Differences CheckGWFToSCsParsing(ScMemoryContext & context, std::string const & fileName)
+{
+  std::string const & testGWFFilePath = ScBuilderTest::SC_BUILDER_KB_GWF + fileName;
+
+  scs::Parser scsTextParser;
+  scsTextParser.Parse(GWFTranslator::TranslateXMLFileContentToSCs(testGWFFilePath));
+
+  GWFTranslator translator(context);
+  std::unique_ptr<scs::Parser> const & gwfParser = translator.Parse({testGWFFilePath, false, ScAddr::Empty});
+
+  // Triples are compared in order, because sc.s-elements should be parsed in the same order as SCs-text is parsed
+  Differences differences = std::make_shared<std::list<std::pair<std::string, std::string>>>();
+  auto const & ParsedTripleToString = [](scs::Parser const & parser, size_t index) -> std::string
+  {
+    auto const & triples = parser.GetParsedTriples();
+    if (index >= triples.size())
+      return "";
+
+    scs::ParsedTriple const & triple = triples[index];
+    return ParsedElementToString(parser, triple.m_source) + " | " + ParsedElementToString(parser, triple.m_connector)
+           + " | " + ParsedElementToString(parser, triple.m_target);
+  };
+
+  size_t const triplesNum = std::max(scsTextParser.GetParsedTriples().size(), gwfParser->GetParsedTriples().size());
+  for (size_t i = 0; i < triplesNum; ++i)
+  {
+    std::string const & expectedTriple = ParsedTripleToString(scsTextParser, i);
+    std::string const & triple = ParsedTripleToString(*gwfParser, i);
+    if (expectedTriple != triple)
+      differences->emplace_back(expectedTriple, triple);
+  }
+
+  return differences;
+}
+
 TEST_F(GWFTranslatorTest, InvalidPath)
 {
   GWFTranslator translator(*m_ctx);
@@ -206,21 +250,29 @@ TEST_F(GWFTranslatorTest, SCsTree)
   }
 }
 
-class TestGWFTranslator : public GWFTranslator
+TEST_F(GWFTranslatorTest, ParseGWFWithoutSCsText)
 {
-public:
-  explicit TestGWFTranslator(class ScMemoryContext & context)
-    : GWFTranslator(context)
+  std::vector<std::string> const fileNames = {
+      "bus.gwf",
+      "empty_contour.gwf",
+      "lot_of_contours.gwf",
+      "contour_with_main_key_sc_element.gwf",
+      "content_types.gwf"};
+  for (std::string const & fileName : fileNames)
   {
+    Differences const & differences = CheckGWFToSCsParsing(*m_ctx, fileName);
+    EXPECT_TRUE(differences->empty()) << fileName << ": " << differencesToString(differences);
   }
 
-  using GWFTranslator::WriteStringToFile;
-};
+  std::filesystem::remove(SC_BUILDER_KB_GWF + "/ostis.png");
+}
 
-TEST_F(GWFTranslatorTest, WriteStringToFileInUnknownDirectory)
+TEST_F(GWFTranslatorTest, ParseGWFWithUnknownIncidentElements)
 {
-  TestGWFTranslator translator(*m_ctx);
-  EXPECT_THROW(translator.WriteStringToFile("text", "test/test.txt"), utils::ExceptionCritical);
+  GWFTranslator translator(*m_ctx);
+
+  std::string const filePath = SC_BUILDER_KB_GWF + "/connector_from_itself_to_itself.gwf";
+  EXPECT_THROW(translator.Parse({filePath, false, ScAddr::Empty}), utils::ExceptionInvalidState);
 }
 
 TEST_F(GWFTranslatorTest, DifferencesToString)
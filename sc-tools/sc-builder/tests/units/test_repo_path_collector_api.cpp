@@ -174,6 +174,24 @@ TEST_F(ScRepoPathCollectorTestAPI, NonTrimRepos)
   EXPECT_EQ(buildSources.count(directory + "/example.gwf"), 1u);
 }
 
+TEST_F(ScRepoPathCollectorTestAPI, ExcludedReposByParallelCollector)
+{
+  std::string const & repoPath = ScRepoPathCollectorTestAPI::SC_BUILDER_TEST_EXCLUDED_REPOS;
+
+  ScRepoPathCollector::Sources excludedSources, checkSources;
+  collector.ParseRepoPath(repoPath, excludedSources, checkSources);
+
+  ScRepoPathCollector::Sources buildSources;
+  collector.CollectBuildSources(repoPath, excludedSources, checkSources, buildSources);
+
+  ScRepoPathCollector parallelCollector{4};
+  ScRepoPathCollector::Sources parallelBuildSources;
+  parallelCollector.CollectBuildSources(repoPath, excludedSources, checkSources, parallelBuildSources);
+
+  EXPECT_EQ(parallelBuildSources.size(), 10u);
+  EXPECT_EQ(parallelBuildSources, buildSources);
+}
+
 TEST_F(ScRepoPathCollectorTestAPI, InvalidRepoPath)
 {
   std::string const & repoPath = ScRepoPathCollectorTestAPI::SC_BUILDER_TEST_INVALID_REPO_PATH;
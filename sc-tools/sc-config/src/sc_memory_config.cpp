@@ -205,6 +205,8 @@ sc_memory_params ScMemoryConfig::GetParams()
   m_memoryParams.term_separators = GetStringByKey("term_separators", DEFAULT_TERM_SEPARATORS);
   m_memoryParams.search_by_substring = GetBoolByKey("search_by_substring", DEFAULT_SEARCH_BY_SUBSTRING);
 
+  m_memoryParams.index_elements_by_types = GetBoolByKey("index_elements_by_types", DEFAULT_INDEX_ELEMENTS_BY_TYPES);
+
   return m_memoryParams;
 }
 
@@ -12,12 +12,43 @@
 
 #include <sc-memory/sc_memory.hpp>
 #include <sc-memory/sc_debug.hpp>
+#include <sc-memory/sc_kb_image.hpp>
 #include <sc-memory/utils/sc_signal_handler.hpp>
 
 #include <sc-config/sc_options.hpp>
 #include <sc-config/sc_config.hpp>
 #include <sc-config/sc_memory_config.hpp>
 
+bool LoadImages(std::string const & imagesPaths)
+try
+{
+  std::vector<std::string> paths;
+  utils::StringUtils::SplitString(imagesPaths, ScConfig::PATHS_SEPARATOR, paths);
+
+  ScKBImage image;
+  for (std::string const & path : paths)
+  {
+    if (path.empty())
+      continue;
+
+    ScKBImage pathImage;
+    pathImage.Load(path);
+    image.Merge(pathImage);
+  }
+
+  ScMemoryContext context;
+  ScMemoryContextEventsBlockingGuard guard(context);
+  image.Generate(context);
+
+  std::cout << "Knowledge base images are loaded: " << image.GetElements().size() << " sc-elements\n";
+  return true;
+}
+catch (utils::ScException const & e)
+{
+  std::cout << "Error while loading knowledge base images: " << e.Message() << std::endl;
+  return false;
+}
+
 void PrintHelpMessage(std::string const & binaryName)
 {
   std::cout
@@ -45,6 +76,13 @@ void PrintHelpMessage(std::string const & binaryName)
          "precedence.\n"
       << "  --clear                                 Run sc-memory in the mode when it overwrites "
          "existing knowledge base binaries.\n"
+      << "  --images <file>[;<file>...]             Load knowledge base images into sc-memory after its "
+         "initialization. Knowledge base images should be saved by sc-builder with --image option.\n"
+         "                                          If several images are provided, they are merged by system "
+         "identifiers of their sc-elements before loading.\n"
+         "                                          Images are loaded only into cleared sc-memory, so --clear is "
+         "required with this option, because sc-elements of images are saved into knowledge base binaries on "
+         "shutdown.\n"
       << "  --verbose|-v                            Shutdown sc-memory without dumping its state into knowledge base "
          "binaries.\n"
       << "  --test|-t                               Test sc-memory state. "
@@ -99,10 +137,22 @@ try
     return EXIT_FAILURE;
   }
 
+  // Sc-elements of images are saved into binaries on shutdown, so they would be duplicated by each next load of images
+  if (options.Has({"images"}) && !memoryConfig.GetParams().clear)
+  {
+    std::cout << "Error: Knowledge base images can be loaded only into cleared sc-memory, but it isn't cleared. Use "
+                 "--clear to overwrite existing knowledge base binaries.\n";
+    std::cout << "For more information, run with --help.\n";
+    return EXIT_FAILURE;
+  }
+
   std::atomic_bool isRun;
   if (!ScMemory::Initialize(memoryConfig.GetParams()))
     goto error;
 
+  if (options.Has({"images"}) && !LoadImages(options[{"images"}].second))
+    goto error;
+
   utils::ScSignalHandler::Initialize();
 
   isRun = !options.Has({"test", "t"});
@@ -10,6 +10,8 @@
 
 #include <sc-config/sc_options.hpp>
 
+#include <sc-memory/sc_kb_image.hpp>
+
 TEST_F(ScMachineTest, Run)
 {
   sc_uint32 const argsNumber = 4;
@@ -54,6 +56,67 @@ TEST_F(ScMachineTest, RunWithVerbose)
   EXPECT_EQ(RunMachine(argsNumber, (sc_char **)args), EXIT_SUCCESS);
 }
 
+TEST_F(ScMachineTest, RunWithImagesTwice)
+{
+  std::string const imagePath = "../sc-machine-test.image";
+  auto const & initialize = [](sc_bool clear)
+  {
+    sc_memory_params params;
+    sc_memory_params_clear(&params);
+    params.dump_memory = SC_FALSE;
+    params.dump_memory_statistics = SC_FALSE;
+    params.clear = clear;
+    params.storage = SC_MACHINE_KB_BIN.c_str();
+    ScMemory::Initialize(params);
+  };
+
+  initialize(SC_TRUE);
+  {
+    ScMemoryContext context;
+    ScAddr const & nodeAddr = context.GenerateNode(ScType::ConstNode);
+    context.SetElementSystemIdentifier("sc_machine_test_image_node", nodeAddr);
+    ScAddr const & targetAddr = context.GenerateNode(ScType::ConstNode);
+    ScAddr const & arcAddr = context.GenerateConnector(ScType::ConstPermPosArc, nodeAddr, targetAddr);
+    ScKBImage::Capture(context, {nodeAddr, targetAddr, arcAddr}).Save(imagePath);
+  }
+  ScMemory::Shutdown(SC_FALSE);
+
+  sc_uint32 const argsNumber = 9;
+  sc_char const * args[argsNumber] = {
+      "sc-machine",
+      "-c",
+      SC_MACHINE_INI.c_str(),
+      "-s",
+      SC_MACHINE_KB_BIN.c_str(),
+      "--clear",
+      "--images",
+      imagePath.c_str(),
+      "-t"};
+  EXPECT_EQ(RunMachine(argsNumber, (sc_char **)args), EXIT_SUCCESS);
+  EXPECT_EQ(RunMachine(argsNumber, (sc_char **)args), EXIT_SUCCESS);
+
+  initialize(SC_FALSE);
+  {
+    ScMemoryContext context;
+    ScAddr const & nodeAddr = context.SearchElementBySystemIdentifier("sc_machine_test_image_node");
+    EXPECT_TRUE(nodeAddr.IsValid());
+    // Sc-elements of image saved on the first run aren't duplicated by the second one
+    EXPECT_EQ(context.CreateIterator3(nodeAddr, ScType::ConstPermPosArc, ScType::ConstNode)->Count(), 1u);
+  }
+  ScMemory::Shutdown(SC_FALSE);
+
+  std::filesystem::remove(imagePath);
+}
+
+TEST_F(ScMachineTest, RunWithImagesWithoutClear)
+{
+  std::string const imagePath = "../sc-machine-test.image";
+  sc_uint32 const argsNumber = 8;
+  sc_char const * args[argsNumber] = {
+      "sc-machine", "-c", SC_MACHINE_INI.c_str(), "-s", SC_MACHINE_KB_BIN.c_str(), "--images", imagePath.c_str(), "-t"};
+  EXPECT_EQ(RunMachine(argsNumber, (sc_char **)args), EXIT_FAILURE);
+}
+
 TEST_F(ScMachineTest, PrintHelp)
 {
   sc_uint32 const argsNumber = 2;
@@ -14,11 +14,12 @@ public:
   ScMemoryJsonPayload Complete(ScAgentContext * context, ScMemoryJsonPayload requestPayload, ScMemoryJsonPayload &)
       override
   {
+    ScAddrVector addrs;
+    addrs.reserve(requestPayload.size());
     for (auto & hash : requestPayload)
-    {
-      ScAddr const addr{hash.get<ScAddr::HashType>()};
-      context->EraseElement(addr);
-    }
+      addrs.emplace_back(hash.get<ScAddr::HashType>());
+
+    context->EraseElements(addrs);
 
     return {SC_TRUE};
   }
@@ -16,3 +16,4 @@
 #include "sc_memory_handle_keynodes_json_action.hpp"
 #include "sc_memory_template_generate_json_action.hpp"
 #include "sc_memory_template_search_json_action.hpp"
+#include "sc_memory_template_prepare_json_action.hpp"
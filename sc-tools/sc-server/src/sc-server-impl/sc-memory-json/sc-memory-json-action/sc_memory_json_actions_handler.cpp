@@ -29,12 +29,16 @@ void ScMemoryJsonActionsHandler::InitializeActionClasses()
       {"delete_elements", new ScMemoryEraseElementsJsonAction()},
       {"search_template", new ScMemoryTemplateSearchJsonAction()},
       {"generate_template", new ScMemoryTemplateGenerateJsonAction()},
+      {"prepare_template", new ScMemoryTemplatePrepareJsonAction()},
       {"content", new ScMemoryHandleLinkContentJsonAction()},
   };
 }
 
 void ScMemoryJsonActionsHandler::ClearActionClasses()
 {
+  ScMemoryJsonTemplatesManager::GetInstance()->Clear();
+  ScMemoryJsonKeynodesCache::GetInstance()->Clear();
+
   for (auto & it : m_actions)
   {
     delete it.second;
@@ -54,6 +58,13 @@ ScMemoryJsonPayload ScMemoryJsonActionsHandler::HandleRequestPayload(
   isEvent = SC_FALSE;
 
   ScMemoryJsonPayload responsePayload;
+  if (requestType == BATCH_REQUEST_TYPE)
+  {
+    responsePayload = HandleBatch(requestPayload, errorsPayload);
+    status = errorsPayload.empty();
+    return responsePayload;
+  }
+
   auto const & it = m_actions.find(requestType);
   if (it == m_actions.end())
   {
@@ -68,3 +79,99 @@ ScMemoryJsonPayload ScMemoryJsonActionsHandler::HandleRequestPayload(
   status = errorsPayload.empty();
   return responsePayload;
 }
+
+ScMemoryJsonPayload ScMemoryJsonActionsHandler::HandleBatch(
+    ScMemoryJsonPayload const & requestPayload,
+    ScMemoryJsonPayload & errorsPayload)
+{
+  if (!requestPayload.is_array())
+  {
+    errorsPayload = "Batch request payload must be an array of requests.";
+    return {};
+  }
+
+  // Payloads of completed requests, they are referenced by json pointers in `$ref` objects of next requests
+  ScMemoryJsonPayload resultsPayloads = ScMemoryJsonPayload::array();
+  ScMemoryJsonPayload responsePayload = ScMemoryJsonPayload::array();
+  sc_bool isFailed = SC_FALSE;
+
+  for (auto const & subrequest : requestPayload)
+  {
+    ScMemoryJsonPayload subresponsePayload;
+    ScMemoryJsonPayload suberrorsPayload = ScMemoryJsonPayload::array({});
+
+    if (isFailed)
+      suberrorsPayload = "Request is not completed because one of previous requests in batch is failed.";
+    else if (!subrequest.is_object() || !subrequest.contains("type") || !subrequest["type"].is_string())
+      suberrorsPayload = "Request in batch must have type.";
+    else
+    {
+      std::string const & subrequestType = subrequest["type"].get<std::string>();
+      auto const & it = m_actions.find(subrequestType);
+      if (it == m_actions.cend())
+        suberrorsPayload = "Unsupported request type in batch: " + subrequestType;
+      else
+      {
+        try
+        {
+          ScMemoryJsonPayload const & subrequestPayload = ResolveReferences(
+              subrequest.contains("payload") ? subrequest["payload"] : ScMemoryJsonPayload(), resultsPayloads);
+          subresponsePayload = it->second->Complete(m_context, subrequestPayload, suberrorsPayload);
+        }
+        catch (utils::ScException const & e)
+        {
+          suberrorsPayload = e.Description();
+        }
+        catch (std::exception const & e)
+        {
+          suberrorsPayload = e.what();
+        }
+      }
+    }
+
+    sc_bool const substatus = suberrorsPayload.empty();
+    isFailed = isFailed || !substatus;
+
+    resultsPayloads.push_back(subresponsePayload);
+    responsePayload.push_back({{"status", substatus}, {"errors", suberrorsPayload}, {"payload", subresponsePayload}});
+  }
+
+  if (isFailed)
+    errorsPayload = "Not all requests in batch are completed.";
+
+  return responsePayload;
+}
+
+ScMemoryJsonPayload ScMemoryJsonActionsHandler::ResolveReferences(
+    ScMemoryJsonPayload const & payload,
+    ScMemoryJsonPayload const & resultsPayloads)
+{
+  if (payload.is_object())
+  {
+    if (payload.size() == 1 && payload.contains(BATCH_REFERENCE) && payload[BATCH_REFERENCE].is_string())
+    {
+      ScMemoryJsonPayload::json_pointer const pointer{payload[BATCH_REFERENCE].get<std::string>()};
+      if (!resultsPayloads.contains(pointer))
+        SC_THROW_EXCEPTION(
+            utils::ExceptionInvalidParams,
+            "Reference `" << pointer.to_string() << "` does not point to result of previous request in batch.");
+
+      return resultsPayloads[pointer];
+    }
+
+    ScMemoryJsonPayload resolvedPayload = ScMemoryJsonPayload::object();
+    for (auto it = payload.cbegin(); it != payload.cend(); ++it)
+      resolvedPayload[it.key()] = ResolveReferences(it.value(), resultsPayloads);
+    return resolvedPayload;
+  }
+
+  if (payload.is_array())
+  {
+    ScMemoryJsonPayload resolvedPayload = ScMemoryJsonPayload::array();
+    for (auto const & item : payload)
+      resolvedPayload.push_back(ResolveReferences(item, resultsPayloads));
+    return resolvedPayload;
+  }
+
+  return payload;
+}
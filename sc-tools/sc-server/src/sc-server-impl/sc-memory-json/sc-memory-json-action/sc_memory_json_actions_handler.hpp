@@ -24,6 +24,9 @@ public:
   static void ClearActionClasses();
 
 private:
+  inline static std::string const BATCH_REQUEST_TYPE = "batch";
+  inline static std::string const BATCH_REFERENCE = "$ref";
+
   ScAgentContext * m_context;
 
   ScMemoryJsonPayload HandleRequestPayload(
@@ -34,5 +37,11 @@ private:
       sc_bool & status,
       sc_bool & isEvent) override;
 
+  ScMemoryJsonPayload HandleBatch(ScMemoryJsonPayload const & requestPayload, ScMemoryJsonPayload & errorsPayload);
+
+  static ScMemoryJsonPayload ResolveReferences(
+      ScMemoryJsonPayload const & payload,
+      ScMemoryJsonPayload const & resultsPayloads);
+
   static std::map<std::string, ScMemoryJsonAction *> m_actions;
 };
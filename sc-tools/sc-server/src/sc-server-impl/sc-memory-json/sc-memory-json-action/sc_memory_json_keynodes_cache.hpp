@@ -0,0 +1,100 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#pragma once
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include <sc-memory/sc_agent_context.hpp>
+
+extern "C"
+{
+#include <sc-core/sc_memory.h>
+}
+
+/*!
+ * Stores sc-addresses of sc-elements found by system identifiers for each session, so parameters of sc-templates
+ * given by system identifiers aren't searched in sc-memory on each request. Sc-elements are found by session contexts,
+ * so each session caches only sc-elements it can read. Cache of session is cleared when system identifiers change and
+ * it is removed when session is disconnected.
+ */
+class ScMemoryJsonKeynodesCache
+{
+public:
+  static ScMemoryJsonKeynodesCache * GetInstance()
+  {
+    static ScMemoryJsonKeynodesCache instance;
+    return &instance;
+  }
+
+  /*!
+   * @brief Finds sc-element by system identifier for session.
+   * @param context A session context to find sc-element by.
+   * @param identifier A system identifier of sc-element.
+   * @return Sc-address of found sc-element, or empty sc-address if there is no such sc-element.
+   */
+  ScAddr Find(ScAgentContext * context, std::string const & identifier)
+  {
+    sc_uint32 const identifiersVersion = sc_memory_get_identifiers_version();
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      ScSessionKeynodes & sessionKeynodes = m_sessionsKeynodes[context];
+      if (sessionKeynodes.identifiersVersion != identifiersVersion)
+      {
+        sessionKeynodes.keynodes.clear();
+        sessionKeynodes.identifiersVersion = identifiersVersion;
+      }
+
+      auto const it = sessionKeynodes.keynodes.find(identifier);
+      if (it != sessionKeynodes.keynodes.cend())
+        return it->second;
+    }
+
+    ScAddr const & addr = context->SearchElementBySystemIdentifier(identifier);
+    // Not found sc-elements aren't cached, they can be generated without changing version of system identifiers
+    if (addr.IsValid())
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      ScSessionKeynodes & sessionKeynodes = m_sessionsKeynodes[context];
+      if (sessionKeynodes.identifiersVersion == identifiersVersion)
+        sessionKeynodes.keynodes.insert({identifier, addr});
+    }
+
+    return addr;
+  }
+
+  void RemoveSession(ScAgentContext const * context)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_sessionsKeynodes.erase(context);
+  }
+
+  size_t Size()
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_sessionsKeynodes.size();
+  }
+
+  void Clear()
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_sessionsKeynodes.clear();
+  }
+
+private:
+  struct ScSessionKeynodes
+  {
+    std::unordered_map<std::string, ScAddr> keynodes;
+    sc_uint32 identifiersVersion = 0;
+  };
+
+  std::unordered_map<ScAgentContext const *, ScSessionKeynodes> m_sessionsKeynodes;
+  std::mutex m_mutex;
+
+  ScMemoryJsonKeynodesCache() = default;
+};
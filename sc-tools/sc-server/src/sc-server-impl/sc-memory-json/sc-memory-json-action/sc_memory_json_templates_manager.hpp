@@ -0,0 +1,170 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include <sc-memory/sc_template.hpp>
+
+#include "sc-server-impl/sc_server_defines.hpp"
+
+#include "sc-server-impl/sc-memory-json/sc_memory_json_payload.hpp"
+
+using ScPreparedTemplatePtr = std::shared_ptr<ScTemplate const>;
+
+/*!
+ * Stores sc-templates prepared by `prepare_template` requests. Prepared sc-templates are shared between all sessions
+ * and are identified by handles. The number of stored sc-templates is bounded: the least recently used sc-template is
+ * removed when capacity is exceeded, and requests with its handle fail until it is prepared again.
+ *
+ * Sc-templates are stored built, so requests with handles only substitute their parameters. Sc-template is built with
+ * version of system identifiers it is built by, and it is rebuilt from its request when system identifiers change.
+ * Read permissions of sessions are checked when sc-templates are searched or generated by their contexts.
+ */
+class ScMemoryJsonTemplatesManager
+{
+public:
+  static ScMemoryJsonTemplatesManager * GetInstance()
+  {
+    static ScMemoryJsonTemplatesManager instance;
+    return &instance;
+  }
+
+  void SetCapacity(size_t capacity)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_capacity = std::max<size_t>(capacity, 1);
+    Shrink();
+  }
+
+  /*!
+   * @brief Finds a handle of sc-template prepared from the same request.
+   * @param key A request representation of sc-template.
+   * @param handle A found handle.
+   * @return true if sc-template is prepared; otherwise, false.
+   */
+  bool Find(std::string const & key, size_t & handle)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto const it = m_keysToHandles.find(key);
+    if (it == m_keysToHandles.cend())
+      return false;
+
+    handle = it->second;
+    Touch(m_templates.find(handle)->second);
+    return true;
+  }
+
+  size_t Add(
+      std::string const & key,
+      ScMemoryJsonPayload const & request,
+      ScPreparedTemplatePtr const & templ,
+      sc_uint32 identifiersVersion)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto const keyIt = m_keysToHandles.find(key);
+    if (keyIt != m_keysToHandles.cend())
+      return keyIt->second;
+
+    size_t const handle = m_counter++;
+    m_usages.push_front(handle);
+    m_templates.insert({handle, {templ, request, identifiersVersion, key, m_usages.begin()}});
+    m_keysToHandles.insert({key, handle});
+    Shrink();
+
+    return handle;
+  }
+
+  /*!
+   * @brief Gets prepared sc-template by its handle.
+   * @param handle A handle of sc-template.
+   * @param request A request of sc-template to rebuild it by.
+   * @param identifiersVersion A version of system identifiers sc-template is built by.
+   * @return Built sc-template, or null if there is no sc-template with such handle.
+   */
+  ScPreparedTemplatePtr Get(size_t handle, ScMemoryJsonPayload & request, sc_uint32 & identifiersVersion)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto const it = m_templates.find(handle);
+    if (it == m_templates.cend())
+      return nullptr;
+
+    Touch(it->second);
+    request = it->second.request;
+    identifiersVersion = it->second.identifiersVersion;
+    return it->second.templ;
+  }
+
+  //! Replaces sc-template by the one rebuilt for new version of system identifiers, if it is still stored
+  void Update(size_t handle, ScPreparedTemplatePtr const & templ, sc_uint32 identifiersVersion)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto const it = m_templates.find(handle);
+    if (it == m_templates.cend())
+      return;
+
+    it->second.templ = templ;
+    it->second.identifiersVersion = identifiersVersion;
+  }
+
+  size_t Size()
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_templates.size();
+  }
+
+  void Clear()
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_templates.clear();
+    m_keysToHandles.clear();
+    m_usages.clear();
+  }
+
+private:
+  struct ScPreparedTemplate
+  {
+    ScPreparedTemplatePtr templ;
+    ScMemoryJsonPayload request;
+    sc_uint32 identifiersVersion;
+    std::string key;
+    std::list<size_t>::iterator usage;
+  };
+
+  std::unordered_map<size_t, ScPreparedTemplate> m_templates;
+  std::unordered_map<std::string, size_t> m_keysToHandles;
+  // Handles ordered from the most recently used to the least recently used
+  std::list<size_t> m_usages;
+  size_t m_capacity = SC_SERVER_DEFAULT_PREPARED_TEMPLATES_NUM;
+  size_t m_counter = 0;
+  std::mutex m_mutex;
+
+  ScMemoryJsonTemplatesManager() = default;
+
+  void Touch(ScPreparedTemplate & preparedTemplate)
+  {
+    m_usages.splice(m_usages.begin(), m_usages, preparedTemplate.usage);
+  }
+
+  void Shrink()
+  {
+    while (m_templates.size() > m_capacity)
+    {
+      size_t const handle = m_usages.back();
+      m_usages.pop_back();
+
+      auto const it = m_templates.find(handle);
+      m_keysToHandles.erase(it->second.key);
+      m_templates.erase(it);
+    }
+  }
+};
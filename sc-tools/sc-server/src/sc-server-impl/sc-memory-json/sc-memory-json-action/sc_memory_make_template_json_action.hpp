@@ -8,6 +8,9 @@
 
 #include "sc_memory_json_action.hpp"
 
+#include "sc_memory_json_templates_manager.hpp"
+#include "sc_memory_json_keynodes_cache.hpp"
+
 class ScMemoryMakeTemplateJsonAction : public ScMemoryJsonAction
 {
 protected:
@@ -16,21 +19,8 @@ protected:
     ScTemplateParams templParams;
     if (payload.is_object())
     {
-      auto const rowParams = payload["params"];
+      templParams = GetTemplateParams(context, payload["params"]);
       payload = payload["templ"];
-
-      for (auto it = rowParams.cbegin(); it != rowParams.cend(); it++)
-      {
-        auto const & key = it.key();
-        auto const & value = it.value();
-        if (value.is_string())
-        {
-          ScAddr const & addr = context->SearchElementBySystemIdentifier(value.get<std::string>());
-          templParams.Add(key, addr);
-        }
-        else
-          templParams.Add(key, ScAddr(value.get<size_t>()));
-      }
     }
 
     ScTemplate * scTemplate;
@@ -50,7 +40,8 @@ protected:
         context->BuildTemplate(*scTemplate, ScAddr(value.get<size_t>()), templParams);
       else if (type == "idtf")
       {
-        ScAddr const & templateStruct = context->SearchElementBySystemIdentifier(value.get<std::string>());
+        ScAddr const & templateStruct =
+            ScMemoryJsonKeynodesCache::GetInstance()->Find(context, value.get<std::string>());
         context->BuildTemplate(*scTemplate, templateStruct, templParams);
       }
     }
@@ -60,6 +51,75 @@ protected:
     return {scTemplate, templParams};
   }
 
+  static ScTemplateParams GetTemplateParams(ScAgentContext * context, ScMemoryJsonPayload const & rowParams)
+  {
+    ScTemplateParams templParams;
+    for (auto it = rowParams.cbegin(); it != rowParams.cend(); it++)
+    {
+      auto const & key = it.key();
+      auto const & value = it.value();
+      if (value.is_string())
+      {
+        ScAddr const & addr = ScMemoryJsonKeynodesCache::GetInstance()->Find(context, value.get<std::string>());
+        templParams.Add(key, addr);
+      }
+      else
+        templParams.Add(key, ScAddr(value.get<size_t>()));
+    }
+
+    return templParams;
+  }
+
+  static sc_bool IsPreparedTemplate(ScMemoryJsonPayload const & payload)
+  {
+    return payload.is_object() && payload.contains("handle");
+  }
+
+  ScPreparedTemplatePtr BuildPreparedTemplate(ScAgentContext * context, ScMemoryJsonPayload const & request)
+  {
+    return ScPreparedTemplatePtr(GetTemplate(context, request).first);
+  }
+
+  /*!
+   * @brief Gets sc-template prepared by `prepare_template` request and its parameters. Sc-template is rebuilt if system
+   * identifiers are changed after it has been built.
+   * @param context A session context to rebuild sc-template by.
+   * @param payload A request payload with `handle` and optional `params`.
+   * @param errorsPayload A payload to write error to if there is no prepared sc-template with such handle.
+   * @return A pair of prepared sc-template and its parameters. Sc-template is null if it is not found.
+   */
+  std::pair<ScPreparedTemplatePtr, ScTemplateParams> GetPreparedTemplate(
+      ScAgentContext * context,
+      ScMemoryJsonPayload const & payload,
+      ScMemoryJsonPayload & errorsPayload)
+  {
+    auto * manager = ScMemoryJsonTemplatesManager::GetInstance();
+    size_t const handle = payload["handle"].get<size_t>();
+    ScMemoryJsonPayload templRequest;
+    sc_uint32 identifiersVersion;
+    ScPreparedTemplatePtr templ = manager->Get(handle, templRequest, identifiersVersion);
+    if (templ == nullptr)
+    {
+      errorsPayload = "Prepared sc-template with handle " + std::to_string(handle)
+                      + " is not found. It may be removed from cache, prepare it again.";
+      return {nullptr, ScTemplateParams()};
+    }
+
+    // Version is got before rebuilding, so changes of system identifiers during rebuilding lead to next rebuilding
+    sc_uint32 const currentIdentifiersVersion = sc_memory_get_identifiers_version();
+    if (identifiersVersion != currentIdentifiersVersion)
+    {
+      templ = BuildPreparedTemplate(context, templRequest);
+      manager->Update(handle, templ, currentIdentifiersVersion);
+    }
+
+    ScTemplateParams templParams;
+    if (payload.contains("params"))
+      templParams = GetTemplateParams(context, payload["params"]);
+
+    return {templ, templParams};
+  }
+
   ScTemplate * MakeTemplate(ScMemoryJsonPayload const & triples)
   {
     auto const & convertItemToParam = [](ScMemoryJsonPayload paramItem) -> ScTemplateItem
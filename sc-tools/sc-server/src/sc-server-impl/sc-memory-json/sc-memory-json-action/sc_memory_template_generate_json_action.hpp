@@ -11,12 +11,35 @@
 class ScMemoryTemplateGenerateJsonAction : public ScMemoryMakeTemplateJsonAction
 {
 public:
-  ScMemoryJsonPayload Complete(ScAgentContext * context, ScMemoryJsonPayload requestPayload, ScMemoryJsonPayload &)
-      override
+  ScMemoryJsonPayload Complete(
+      ScAgentContext * context,
+      ScMemoryJsonPayload requestPayload,
+      ScMemoryJsonPayload & errorsPayload) override
+  {
+    if (IsPreparedTemplate(requestPayload))
+    {
+      std::pair<ScPreparedTemplatePtr, ScTemplateParams> const & pair =
+          GetPreparedTemplate(context, requestPayload, errorsPayload);
+      if (pair.first == nullptr)
+        return {};
+
+      return GenerateByTemplate(context, *pair.first, pair.second);
+    }
+
+    std::pair<ScTemplate *, ScTemplateParams> const & pair = GetTemplate(context, requestPayload);
+    ScMemoryJsonPayload const & resultPayload = GenerateByTemplate(context, *pair.first, pair.second);
+    delete pair.first;
+    return resultPayload;
+  }
+
+protected:
+  static ScMemoryJsonPayload GenerateByTemplate(
+      ScAgentContext * context,
+      ScTemplate const & templ,
+      ScTemplateParams const & templParams)
   {
     ScTemplateGenResult result;
-    auto pair = GetTemplate(context, requestPayload);
-    context->GenerateByTemplate(*pair.first, result, pair.second);
+    context->GenerateByTemplate(templ, result, templParams);
 
     std::vector<size_t> hashesVectors;
     for (size_t i = 0; i < result.Size(); ++i)
@@ -25,7 +48,6 @@ public:
     SC_PRAGMA_DISABLE_DEPRECATION_WARNINGS_BEGIN
     ScMemoryJsonPayload const & resultPayload = {{"aliases", result.GetReplacements()}, {"addrs", hashesVectors}};
     SC_PRAGMA_DISABLE_DEPRECATION_WARNINGS_END
-    delete pair.first;
     return resultPayload;
   }
 };
@@ -0,0 +1,30 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#pragma once
+
+#include "sc_memory_make_template_json_action.hpp"
+
+class ScMemoryTemplatePrepareJsonAction : public ScMemoryMakeTemplateJsonAction
+{
+public:
+  ScMemoryJsonPayload Complete(ScAgentContext * context, ScMemoryJsonPayload requestPayload, ScMemoryJsonPayload &)
+      override
+  {
+    // The same sc-templates sent by different clients share one handle
+    std::string const & key = requestPayload.dump();
+
+    auto * manager = ScMemoryJsonTemplatesManager::GetInstance();
+    size_t handle;
+    if (!manager->Find(key, handle))
+    {
+      sc_uint32 const identifiersVersion = sc_memory_get_identifiers_version();
+      handle = manager->Add(key, requestPayload, BuildPreparedTemplate(context, requestPayload), identifiersVersion);
+    }
+
+    return {{"handle", handle}};
+  }
+};
@@ -11,12 +11,36 @@
 class ScMemoryTemplateSearchJsonAction : public ScMemoryMakeTemplateJsonAction
 {
 public:
-  ScMemoryJsonPayload Complete(ScAgentContext * context, ScMemoryJsonPayload requestPayload, ScMemoryJsonPayload &)
-      override
+  ScMemoryJsonPayload Complete(
+      ScAgentContext * context,
+      ScMemoryJsonPayload requestPayload,
+      ScMemoryJsonPayload & errorsPayload) override
+  {
+    if (IsPreparedTemplate(requestPayload))
+    {
+      std::pair<ScPreparedTemplatePtr, ScTemplateParams> const & pair =
+          GetPreparedTemplate(context, requestPayload, errorsPayload);
+      if (pair.first == nullptr)
+        return {};
+
+      // Search has no parameters, so parameters of prepared sc-template are substituted into its copy
+      ScTemplate substitutedTempl;
+      pair.first->Substitute(pair.second, substitutedTempl);
+      return SearchByTemplate(context, substitutedTempl);
+    }
+
+    // Parameters of not prepared sc-template are applied when it is built from sc-memory
+    std::pair<ScTemplate *, ScTemplateParams> const & pair = GetTemplate(context, requestPayload);
+    ScMemoryJsonPayload const & resultPayload = SearchByTemplate(context, *pair.first);
+    delete pair.first;
+    return resultPayload;
+  }
+
+protected:
+  static ScMemoryJsonPayload SearchByTemplate(ScAgentContext * context, ScTemplate const & templ)
   {
     ScTemplateSearchResult result;
-    auto const & pair = GetTemplate(context, requestPayload);
-    context->SearchByTemplate(*pair.first, result);
+    context->SearchByTemplate(templ, result);
 
     std::vector<std::vector<size_t>> hashesVectors;
     for (size_t i = 0; i < result.Size(); ++i)
@@ -33,7 +57,6 @@ public:
     SC_PRAGMA_DISABLE_DEPRECATION_WARNINGS_BEGIN
     ScMemoryJsonPayload const & resultPayload = {{"aliases", result.GetReplacements()}, {"addrs", hashesVectors}};
     SC_PRAGMA_DISABLE_DEPRECATION_WARNINGS_END
-    delete pair.first;
     return resultPayload;
   }
 };
@@ -70,10 +70,10 @@ ScMemoryJsonPayload ScMemoryJsonEventsHandler::HandleGenerate(
 
     ScMemoryJsonPayload const & responseTextJson =
         ScMemoryJsonHandler::FormResponseMessage(id, isEvent, status, errorsPayload, responsePayload);
-    std::string const responseText = responseTextJson.dump();
 
     if (server != nullptr)
-      server->OnEvent(handle, responseText);
+      server->OnEvent(
+          handle, id, ScMemoryJsonPayloadFormat::Dump(responseTextJson, server->GetSessionFormat(handle)));
   };
 
   ScMemoryJsonPayload responsePayload;
@@ -87,9 +87,10 @@ ScMemoryJsonPayload ScMemoryJsonEventsHandler::HandleGenerate(
       eventClass = it->second;
 
     ScAddr const & eventClassAddr = m_context->SearchElementBySystemIdentifier(eventClass);
+    size_t const subscriptionId = m_manager->Next();
     auto const & subscription = m_context->CreateElementaryEventSubscription(
-        eventClassAddr, subscriptionElementAddr, bind(onEmitEvent, m_server, m_manager->Next(), sessionId, ::_1));
-    responsePayload.push_back(m_manager->Add(subscription));
+        eventClassAddr, subscriptionElementAddr, bind(onEmitEvent, m_server, subscriptionId, sessionId, ::_1));
+    responsePayload.push_back(m_manager->Add(subscriptionId, subscription));
   }
 
   return responsePayload;
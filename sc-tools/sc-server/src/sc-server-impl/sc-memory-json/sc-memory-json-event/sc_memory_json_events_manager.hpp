@@ -7,6 +7,7 @@
 #pragma once
 
 #include <algorithm>
+#include <mutex>
 
 #include <sc-memory/sc_event_subscription.hpp>
 
@@ -21,19 +22,22 @@ public:
     return m_instance;
   }
 
-  size_t Add(ScEventSubscriptionPtr const & event)
+  size_t Add(size_t index, ScEventSubscriptionPtr const & event)
   {
-    m_events.insert({counter, event});
-    return counter++;
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_events.insert({index, event});
+    return index;
   }
 
-  size_t Next() const
+  size_t Next()
   {
-    return counter;
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return counter++;
   }
 
   ScEventSubscriptionPtr Remove(size_t index)
   {
+    std::lock_guard<std::mutex> lock(m_mutex);
     auto const & it = m_events.find(index);
     if (it != m_events.end())
     {
@@ -57,6 +61,8 @@ private:
   static ScMemoryJsonEventsManager * m_instance;
   std::unordered_map<size_t, ScEventSubscriptionPtr> m_events;
   size_t counter = 0;
+  // Sessions are handled by several actions threads, so subscriptions of them may be added and removed concurrently.
+  std::mutex m_mutex;
 
   ScMemoryJsonEventsManager() = default;
 };
@@ -7,23 +7,34 @@
 #include "sc_memory_json_handler.hpp"
 
 std::string ScMemoryJsonHandler::Handle(ScServerSessionId const & sessionId, std::string const & requestMessage)
+{
+  return Handle(sessionId, JsonifyRequestMessage(requestMessage)).dump();
+}
+
+ScMemoryJsonPayload ScMemoryJsonHandler::Handle(
+    ScServerSessionId const & sessionId,
+    ScMemoryJsonPayload const & requestMessage)
 {
   std::vector<ScMemoryJsonPayload> requestData = ParseRequestMessage(requestMessage);
   if (requestData.empty())
-    return ScMemoryJsonPayload("Invalid request message").dump();
+    return ScMemoryJsonPayload("Invalid request message");
 
   std::string const & requestType = requestData.at(0).get<std::string>();
   ScMemoryJsonPayload const & requestPayload = requestData.at(1);
   size_t const & requestId = requestData.at(2).get<size_t>();
 
-  return ResponseRequestMessage(sessionId, requestId, requestType, requestPayload).dump();
+  return ResponseRequestMessage(sessionId, requestId, requestType, requestPayload);
 }
 
 std::vector<ScMemoryJsonPayload> ScMemoryJsonHandler::ParseRequestMessage(std::string const & requestMessage)
+{
+  return ParseRequestMessage(JsonifyRequestMessage(requestMessage));
+}
+
+std::vector<ScMemoryJsonPayload> ScMemoryJsonHandler::ParseRequestMessage(ScMemoryJsonPayload const & messageJson)
 {
   std::vector<ScMemoryJsonPayload> requestData;
 
-  ScMemoryJsonPayload const & messageJson = JsonifyRequestMessage(requestMessage);
   if (messageJson.is_null())
     return requestData;
 
@@ -25,11 +25,15 @@ public:
 
   virtual std::string Handle(ScServerSessionId const & sessionId, std::string const & requestMessage);
 
+  virtual ScMemoryJsonPayload Handle(ScServerSessionId const & sessionId, ScMemoryJsonPayload const & requestMessage);
+
 protected:
   ScServer * m_server;
 
   std::vector<ScMemoryJsonPayload> ParseRequestMessage(std::string const & requestMessage);
 
+  std::vector<ScMemoryJsonPayload> ParseRequestMessage(ScMemoryJsonPayload const & messageJson);
+
   ScMemoryJsonPayload JsonifyRequestMessage(std::string const & requestMessage);
 
   virtual ScMemoryJsonPayload ResponseRequestMessage(
@@ -8,4 +8,66 @@
 
 #include <nlohmann/json.hpp>
 
+#include "sc-server-impl/sc_server_defines.hpp"
+
 using ScMemoryJsonPayload = nlohmann::json;
+
+/*!
+ * Encodes and decodes payloads in formats supported by sc-server. Binary formats are nlohmann binary
+ * representations of the same json documents, so all handlers work with the same payloads.
+ */
+class ScMemoryJsonPayloadFormat
+{
+public:
+  /*!
+   * @brief Decodes a message in specified format.
+   * @param message A message to decode.
+   * @param format A format of message.
+   * @return A decoded payload or null payload if message is invalid.
+   */
+  static ScMemoryJsonPayload Parse(std::string const & message, ScServerMessageFormat format)
+  {
+    ScMemoryJsonPayload payload;
+    switch (format)
+    {
+    case ScServerMessageFormat::Cbor:
+      payload = ScMemoryJsonPayload::from_cbor(message, true, false);
+      break;
+    case ScServerMessageFormat::MessagePack:
+      payload = ScMemoryJsonPayload::from_msgpack(message, true, false);
+      break;
+    default:
+      payload = ScMemoryJsonPayload::parse(message, nullptr, false);
+      break;
+    }
+
+    return payload.is_discarded() ? ScMemoryJsonPayload() : payload;
+  }
+
+  /*!
+   * @brief Encodes a payload in specified format.
+   * @param payload A payload to encode.
+   * @param format A format of message.
+   * @return An encoded message.
+   */
+  static std::string Dump(ScMemoryJsonPayload const & payload, ScServerMessageFormat format)
+  {
+    switch (format)
+    {
+    case ScServerMessageFormat::Cbor:
+    {
+      std::string message;
+      ScMemoryJsonPayload::to_cbor(payload, message);
+      return message;
+    }
+    case ScServerMessageFormat::MessagePack:
+    {
+      std::string message;
+      ScMemoryJsonPayload::to_msgpack(payload, message);
+      return message;
+    }
+    default:
+      return payload.dump();
+    }
+  }
+};
@@ -6,13 +6,17 @@
 
 #include "sc_server.hpp"
 
+#include <algorithm>
+
 #include <websocketpp/config/asio_no_tls.hpp>
 
 #include <sc-memory/sc_keynodes.hpp>
 
-ScServer::ScServer(std::string hostName, size_t port)
+ScServer::ScServer(std::string hostName, size_t port, size_t ioThreadsNum, size_t actionsThreadsNum)
   : m_host(std::move(hostName))
   , m_port(port)
+  , m_ioThreadsNum(std::max<size_t>(ioThreadsNum, 1))
+  , m_actionsThreadsNum(std::max<size_t>(actionsThreadsNum, 1))
   , m_logger(nullptr)
 {
   m_instance = new ScServerCore();
@@ -23,9 +27,13 @@ ScServer::ScServer(std::string hostName, size_t port)
     LogMessage(ScServerErrorLevel::info, "Socket data:");
     LogMessage(ScServerErrorLevel::info, "\tHost: " + m_host);
     LogMessage(ScServerErrorLevel::info, "\tPort: " + std::to_string(m_port));
+    LogMessage(ScServerErrorLevel::info, "Threads data:");
+    LogMessage(ScServerErrorLevel::info, "\tInput-output threads: " + std::to_string(m_ioThreadsNum));
+    LogMessage(ScServerErrorLevel::info, "\tActions threads: " + std::to_string(m_actionsThreadsNum));
   }
 
   m_connections = new ScServerSessionContexts();
+  m_formats = new ScServerSessionFormats();
   LogMessage(ScServerErrorLevel::info, "Sc-server initialized");
 }
 
@@ -42,10 +50,13 @@ void ScServer::Run()
   m_instance->start_accept();
 
   LogMessage(ScServerErrorLevel::info, "Start actions processing");
-  m_actionsThread = std::thread(&ScServer::EmitActions, &*this);
+  for (size_t i = 0; i < m_actionsThreadsNum; ++i)
+    m_actionsThreads.emplace_back(&ScServer::EmitActions, &*this);
 
   LogMessage(ScServerErrorLevel::info, "Start input-output processing");
-  m_ioThread = std::thread(&ScServerCore::run, &*m_instance);
+  // All input-output threads share one io_context, websocketpp serializes handlers of each connection by itself.
+  for (size_t i = 0; i < m_ioThreadsNum; ++i)
+    m_ioThreads.emplace_back(&ScServerCore::run, &*m_instance);
 
   LogMessage(ScServerErrorLevel::info, "All inner processes started");
   LogMessage(ScServerErrorLevel::info, "Sc-server run");
@@ -62,13 +73,18 @@ void ScServer::Stop()
 
   AfterInitialize();
 
-  if (m_actionsThread.joinable())
+  if (!m_actionsThreads.empty())
   {
     LogMessage(ScServerErrorLevel::info, "Stop actions processing");
-    m_actionsThread.join();
+    for (auto & thread : m_actionsThreads)
+    {
+      if (thread.joinable())
+        thread.join();
+    }
+    m_actionsThreads.clear();
   }
 
-  if (m_ioThread.joinable())
+  if (!m_ioThreads.empty())
   {
     LogMessage(ScServerErrorLevel::info, "Stop input-output processing");
 
@@ -85,7 +101,12 @@ void ScServer::Stop()
     }
 
     m_instance->stop();
-    m_ioThread.join();
+    for (auto & thread : m_ioThreads)
+    {
+      if (thread.joinable())
+        thread.join();
+    }
+    m_ioThreads.clear();
   }
 
   LogMessage(ScServerErrorLevel::info, "All inner processes stopped");
@@ -99,6 +120,8 @@ void ScServer::Shutdown()
   LogMessage(ScServerErrorLevel::info, "Clear connections");
   delete m_connections;
   m_connections = nullptr;
+  delete m_formats;
+  m_formats = nullptr;
 
   LogMessage(ScServerErrorLevel::info, "Sc-server shutdown");
 
@@ -128,6 +151,7 @@ ScAgentContext * ScServer::PopSessionContext(ScServerSessionId const & sessionId
   ScServerLock lock(m_connectionsMutex);
   ScAgentContext * sessionCtx = m_connections->at(sessionId);
   m_connections->erase(sessionId);
+  m_formats->erase(sessionId);
   return sessionCtx;
 }
 
@@ -137,6 +161,34 @@ ScAgentContext * ScServer::GetSessionContext(ScServerSessionId const & sessionId
   return m_connections->at(sessionId);
 }
 
+void ScServer::SetSessionFormat(ScServerSessionId const & sessionId, ScServerMessageFormat format)
+{
+  ScServerLock lock(m_connectionsMutex);
+  (*m_formats)[sessionId] = format;
+}
+
+ScServerMessageFormat ScServer::GetSessionFormat(ScServerSessionId const & sessionId)
+{
+  ScServerLock lock(m_connectionsMutex);
+  auto const it = m_formats->find(sessionId);
+  return it == m_formats->cend() ? ScServerMessageFormat::Json : it->second;
+}
+
+ScServerMessageFormat ScServer::GetMessageFormat(std::string const & subprotocol)
+{
+  if (subprotocol == SC_SERVER_CBOR_SUBPROTOCOL)
+    return ScServerMessageFormat::Cbor;
+  if (subprotocol == SC_SERVER_MSGPACK_SUBPROTOCOL)
+    return ScServerMessageFormat::MessagePack;
+
+  return ScServerMessageFormat::Json;
+}
+
+ScServerMessageType ScServer::GetMessageType(ScServerMessageFormat format)
+{
+  return format == ScServerMessageFormat::Json ? ScServerMessageType::text : ScServerMessageType::binary;
+}
+
 void ScServer::Send(ScServerSessionId const & sessionId, std::string const & message, ScServerMessageType type)
 {
   m_instance->send(sessionId, message, type);
@@ -7,6 +7,8 @@
 #pragma once
 
 #include <utility>
+#include <vector>
+#include <thread>
 
 #include <sc-memory/sc_memory.hpp>
 
@@ -21,7 +23,7 @@ using ScServerLock = std::lock_guard<ScServerMutex>;
 class ScServer
 {
 public:
-  explicit ScServer(std::string hostName, size_t port);
+  explicit ScServer(std::string hostName, size_t port, size_t ioThreadsNum = 1, size_t actionsThreadsNum = 1);
 
   void Run();
 
@@ -43,6 +45,14 @@ public:
 
   ScAgentContext * GetSessionContext(ScServerSessionId const & sessionId);
 
+  void SetSessionFormat(ScServerSessionId const & sessionId, ScServerMessageFormat format);
+
+  ScServerMessageFormat GetSessionFormat(ScServerSessionId const & sessionId);
+
+  static ScServerMessageFormat GetMessageFormat(std::string const & subprotocol);
+
+  static ScServerMessageType GetMessageType(ScServerMessageFormat format);
+
   void SetChannels(ScServerLogLevel channels);
 
   void ClearChannels();
@@ -55,7 +65,18 @@ public:
 
   void CloseConnection(ScServerSessionId const & sessionId, ScServerCloseCode code, std::string const & reason);
 
-  virtual void OnEvent(ScServerSessionId const & sessionId, std::string const & msg) = 0;
+  virtual void OnEvent(ScServerSessionId const & sessionId, size_t subscriptionId, std::string const & msg) = 0;
+
+  //! Holds sc-event messages of session in its queue until they are released
+  virtual void HoldEvents(ScServerSessionId const & sessionId) = 0;
+
+  //! Releases held sc-event messages of session and sends them
+  virtual void ReleaseEvents(ScServerSessionId const & sessionId) = 0;
+
+  //! Removes sc-event messages queue of closed session, next sc-events of session are dropped
+  virtual void RemoveSessionEvents(ScServerSessionId const & sessionId) = 0;
+
+  virtual ScServerEventsStatistics GetEventsStatistics() = 0;
 
   virtual ~ScServer();
 
@@ -63,10 +84,13 @@ protected:
   std::atomic<sc_bool> m_isServerRun = SC_FALSE;
   std::string m_host;
   ScServerPort m_port;
+  size_t m_ioThreadsNum;
+  size_t m_actionsThreadsNum;
 
   ScServerLogger * m_logger;
   ScServerCore * m_instance;
   ScServerSessionContexts * m_connections;
+  ScServerSessionFormats * m_formats;
   ScServerMutex m_connectionsMutex;
 
   virtual void Initialize() = 0;
@@ -80,6 +104,6 @@ protected:
   virtual void OnMessage(ScServerSessionId const & sessionId, ScServerMessage const & msg) = 0;
 
 private:
-  std::thread m_ioThread;
-  std::thread m_actionsThread;
+  std::vector<std::thread> m_ioThreads;
+  std::vector<std::thread> m_actionsThreads;
 };
@@ -18,6 +18,41 @@ using ScServerPort = size_t;
 using ScServerSessionId = websocketpp::connection_hdl;
 using ScServerSessionContexts = std::map<ScServerSessionId, class ScAgentContext *, std::owner_less<ScServerSessionId>>;
 
+/*!
+ * Format of messages of session. It is negotiated at connection time by websocket subprotocol: `json` (default),
+ * `cbor` or `msgpack`. Messages of sessions with binary formats are sent as binary frames.
+ */
+enum class ScServerMessageFormat
+{
+  Json,
+  Cbor,
+  MessagePack
+};
+
+/*!
+ * Policy applied when a session does not read sc-event messages and its queue of sc-event messages is full.
+ */
+enum class ScServerEventsOverflowPolicy
+{
+  Drop,        ///< New sc-event message is dropped.
+  Coalesce,    ///< New sc-event message replaces queued message of the same subscription or is dropped.
+  Disconnect,  ///< Session is disconnected.
+};
+
+/*!
+ * Counters of sc-event messages sent by sc-server to all sessions.
+ */
+struct ScServerEventsStatistics
+{
+  size_t queuedEvents = 0;          ///< Current number of sc-event messages waiting to be sent.
+  size_t sentEvents = 0;            ///< Number of sent sc-event messages.
+  size_t droppedEvents = 0;         ///< Number of sc-event messages dropped because of full queues.
+  size_t coalescedEvents = 0;       ///< Number of sc-event messages replaced by newer ones of the same subscription.
+  size_t disconnectedSessions = 0;  ///< Number of sessions disconnected because of full queues.
+};
+
+using ScServerSessionFormats = std::map<ScServerSessionId, ScServerMessageFormat, std::owner_less<ScServerSessionId>>;
+
 using ScServerLogLevel = websocketpp::log::level;
 using ScServerDefaultErrorLogLevel = websocketpp::log::elevel;
 
@@ -184,3 +219,17 @@ using websocketpp::lib::placeholders::_3;
 
 #define SC_SERVER_CONSOLE_TYPE "Console"
 #define SC_SERVER_FILE_TYPE "File"
+
+#define SC_SERVER_DEFAULT_IO_THREADS_NUM 2
+#define SC_SERVER_DEFAULT_PREPARED_TEMPLATES_NUM 1000
+#define SC_SERVER_DEFAULT_EVENTS_QUEUE_SIZE 1000
+#define SC_SERVER_DEFAULT_EVENTS_BUFFERED_BYTES 1048576
+#define SC_SERVER_EVENTS_RETRY_PERIOD_MS 20
+
+#define SC_SERVER_DROP_EVENTS_POLICY "drop"
+#define SC_SERVER_COALESCE_EVENTS_POLICY "coalesce"
+#define SC_SERVER_DISCONNECT_EVENTS_POLICY "disconnect"
+
+#define SC_SERVER_JSON_SUBPROTOCOL "json"
+#define SC_SERVER_CBOR_SUBPROTOCOL "cbor"
+#define SC_SERVER_MSGPACK_SUBPROTOCOL "msgpack"
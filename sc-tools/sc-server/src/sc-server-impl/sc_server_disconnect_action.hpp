@@ -10,6 +10,7 @@
 
 #include "sc_server_action.hpp"
 #include "sc_server.hpp"
+#include "sc-memory-json/sc-memory-json-action/sc_memory_json_keynodes_cache.hpp"
 
 class ScServerDisconnectAction : public ScServerAction
 {
@@ -22,7 +23,10 @@ public:
 
   void Emit() override
   {
-    delete m_server->PopSessionContext(m_sessionId);
+    m_server->RemoveSessionEvents(m_sessionId);
+    ScAgentContext * sessionCtx = m_server->PopSessionContext(m_sessionId);
+    ScMemoryJsonKeynodesCache::GetInstance()->RemoveSession(sessionCtx);
+    delete sessionCtx;
   }
 
   ~ScServerDisconnectAction() override = default;
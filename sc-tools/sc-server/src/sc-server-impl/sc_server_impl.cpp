@@ -6,6 +6,8 @@
 
 #include "sc_server_impl.hpp"
 
+#include <algorithm>
+
 #include "sc_server_action_defines.hpp"
 
 extern "C"
@@ -13,17 +15,29 @@ extern "C"
 #include <sc-store/sc_storage.h>
 }
 
-ScServerImpl::ScServerImpl(std::string const & host, ScServerPort port, sc_bool parallelActions)
-  : ScServer(host, port)
+ScServerImpl::ScServerImpl(
+    std::string const & host,
+    ScServerPort port,
+    sc_bool parallelActions,
+    size_t ioThreadsNum,
+    size_t actionsThreadsNum)
+  : ScServer(host, port, ioThreadsNum, parallelActions ? actionsThreadsNum : 1)
   , m_parallelActions(parallelActions)
   , m_actionsRun(SC_TRUE)
-  , m_actions(new ScServerActions())
+  , m_actionsCount(0)
+  , m_sessionsActions(new ScServerSessionsActions())
+  , m_readySessions(new ScServerReadySessions())
+  , m_eventsQueueSize(SC_SERVER_DEFAULT_EVENTS_QUEUE_SIZE)
+  , m_eventsOverflowPolicy(ScServerEventsOverflowPolicy::Drop)
+  , m_eventsMaxBufferedBytes(SC_SERVER_DEFAULT_EVENTS_BUFFERED_BYTES)
+  , m_sessionsEvents(new ScServerSessionsEvents())
 {
   ScMemoryJsonActionsHandler::InitializeActionClasses();
 }
 
 void ScServerImpl::Initialize()
 {
+  m_instance->set_validate_handler(bind(&ScServerImpl::OnValidate, this, ::_1));
   m_instance->set_open_handler(bind(&ScServerImpl::OnOpen, this, ::_1));
   m_instance->set_close_handler(bind(&ScServerImpl::OnClose, this, ::_1));
   m_instance->set_message_handler(bind(&ScServerImpl::OnMessage, this, ::_1, ::_2));
@@ -31,15 +45,25 @@ void ScServerImpl::Initialize()
 
 void ScServerImpl::AfterInitialize()
 {
-  while (m_actions->empty() == SC_FALSE)
-    ;
+  {
+    ScServerUniqueLock actionLock(m_actionMutex);
+    m_actionsEmptyCond.wait(
+        actionLock,
+        [this]
+        {
+          return m_actionsCount == 0;
+        });
 
-  m_actionsRun = SC_FALSE;
-  m_actionCond.notify_one();
+    m_actionsRun = SC_FALSE;
+  }
+  m_actionCond.notify_all();
 }
 
 void ScServerImpl::EmitActions()
 {
+  // TODO(NikitaZotov): sc-server should not know about it
+  sc_storage_start_new_process();
+
   while (m_actionsRun == SC_TRUE)
   {
     ScServerUniqueLock actionLock(m_actionMutex);
@@ -48,14 +72,18 @@ void ScServerImpl::EmitActions()
         actionLock,
         [this]
         {
-          return !m_actions->empty() || !m_actionsRun;
+          return !m_readySessions->empty() || !m_actionsRun;
         });
 
     if (m_actionsRun == SC_FALSE)
       break;
 
-    ScServerAction * action = m_actions->front();
-    m_actions->pop();
+    ScServerSessionId const sessionId = m_readySessions->front();
+    m_readySessions->pop();
+
+    ScServerActions & sessionActions = m_sessionsActions->at(sessionId).actions;
+    ScServerAction * action = sessionActions.front();
+    sessionActions.pop();
 
     actionLock.unlock();
 
@@ -68,79 +96,312 @@ void ScServerImpl::EmitActions()
       LogMessage(ScServerErrorLevel::error, e.what());
     }
     delete action;
+
+    actionLock.lock();
+    // The session has been kept scheduled during emitting, so no other thread could take its next action.
+    auto const it = m_sessionsActions->find(sessionId);
+    if (it->second.actions.empty())
+      m_sessionsActions->erase(it);
+    else
+    {
+      m_readySessions->push(sessionId);
+      m_actionCond.notify_one();
+    }
+
+    if (--m_actionsCount == 0)
+      m_actionsEmptyCond.notify_all();
   }
+
+  sc_storage_end_new_process();
+}
+
+void ScServerImpl::ConfigureEvents(
+    size_t queueSize,
+    ScServerEventsOverflowPolicy overflowPolicy,
+    size_t maxBufferedBytes)
+{
+  ScServerLock eventsLock(m_eventsMutex);
+  m_eventsQueueSize = std::max<size_t>(queueSize, 1);
+  m_eventsOverflowPolicy = overflowPolicy;
+  m_eventsMaxBufferedBytes = maxBufferedBytes;
+}
+
+ScServerEventsStatistics ScServerImpl::GetEventsStatistics()
+{
+  ScServerLock eventsLock(m_eventsMutex);
+  ScServerEventsStatistics statistics = m_eventsStatistics;
+  statistics.queuedEvents = 0;
+  for (auto const & it : *m_sessionsEvents)
+    statistics.queuedEvents += it.second.events.size();
+
+  return statistics;
+}
+
+ScServerEventsOverflowPolicy ScServerImpl::GetEventsOverflowPolicy(std::string const & policy)
+{
+  if (policy == SC_SERVER_COALESCE_EVENTS_POLICY)
+    return ScServerEventsOverflowPolicy::Coalesce;
+  if (policy == SC_SERVER_DISCONNECT_EVENTS_POLICY)
+    return ScServerEventsOverflowPolicy::Disconnect;
+
+  return ScServerEventsOverflowPolicy::Drop;
 }
 
 sc_bool ScServerImpl::IsWorkable()
 {
-  return m_actions->empty() == SC_FALSE;
+  ScServerLock actionLock(m_actionMutex);
+  return m_actionsCount != 0;
 }
 
-void ScServerImpl::OnOpen(ScServerSessionId const & sessionId)
+void ScServerImpl::PushAction(ScServerSessionId const & sessionId, ScServerAction * action)
 {
-  auto * action = new ScServerConnectAction(this, sessionId);
   {
-    ScServerLock connectionLock(m_connectionMutex);
     ScServerLock actionLock(m_actionMutex);
-    m_actions->push(action);
+    ScServerSessionActions & sessionActions = (*m_sessionsActions)[sessionId];
+    sessionActions.actions.push(action);
+    ++m_actionsCount;
+
+    if (sessionActions.isScheduled == SC_TRUE)
+      return;
+
+    sessionActions.isScheduled = SC_TRUE;
+    m_readySessions->push(sessionId);
   }
   m_actionCond.notify_one();
 }
 
-void ScServerImpl::OnClose(ScServerSessionId const & sessionId)
+bool ScServerImpl::OnValidate(ScServerSessionId const & sessionId)
 {
-  auto * action = new ScServerDisconnectAction(this, sessionId);
+  // Select the first supported subprotocol requested by client, clients without subprotocols use json
+  auto const connection = m_instance->get_con_from_hdl(sessionId);
+  for (std::string const & subprotocol : connection->get_requested_subprotocols())
   {
-    ScServerLock connectionLock(m_connectionMutex);
-    ScServerLock actionLock(m_actionMutex);
-    m_actions->push(action);
+    if (subprotocol == SC_SERVER_JSON_SUBPROTOCOL || subprotocol == SC_SERVER_CBOR_SUBPROTOCOL
+        || subprotocol == SC_SERVER_MSGPACK_SUBPROTOCOL)
+    {
+      connection->select_subprotocol(subprotocol);
+      break;
+    }
   }
-  m_actionCond.notify_one();
+
+  return true;
+}
+
+void ScServerImpl::OnOpen(ScServerSessionId const & sessionId)
+{
+  {
+    ScServerLock eventsLock(m_eventsMutex);
+    m_sessionsEvents->insert({sessionId, ScServerSessionEvents()});
+  }
+
+  ScServerLock connectionLock(m_connectionMutex);
+  SetSessionFormat(sessionId, GetMessageFormat(m_instance->get_con_from_hdl(sessionId)->get_subprotocol()));
+  PushAction(sessionId, new ScServerConnectAction(this, sessionId));
+}
+
+void ScServerImpl::OnClose(ScServerSessionId const & sessionId)
+{
+  RemoveSessionEvents(sessionId);
+
+  ScServerLock connectionLock(m_connectionMutex);
+  PushAction(sessionId, new ScServerDisconnectAction(this, sessionId));
 }
 
 void ScServerImpl::OnMessage(ScServerSessionId const & sessionId, ScServerMessage const & msg)
 {
   ScServerLock connectionLock(m_connectionMutex);
+  PushAction(sessionId, new ScServerMessageAction(this, sessionId, msg));
+}
+
+void ScServerImpl::OnEvent(ScServerSessionId const & sessionId, size_t subscriptionId, std::string const & msg)
+{
   if (!IsSessionValid(sessionId))
     return;
 
-  auto * action = new ScServerMessageAction(this, sessionId, msg);
-
-  if (m_parallelActions == SC_FALSE)
+  sc_bool isOverflowed = SC_FALSE;
   {
+    ScServerLock eventsLock(m_eventsMutex);
+    // Queue of session is removed when it is closed, sc-events of closed session are dropped
+    auto const sessionEventsIt = m_sessionsEvents->find(sessionId);
+    if (sessionEventsIt == m_sessionsEvents->cend())
+      return;
+
+    ScServerSessionEvents & sessionEvents = sessionEventsIt->second;
+
+    if (sessionEvents.events.size() < m_eventsQueueSize)
+      sessionEvents.events.push_back({subscriptionId, msg});
+    else if (m_eventsOverflowPolicy == ScServerEventsOverflowPolicy::Coalesce)
     {
-      ScServerLock actionLock(m_actionMutex);
-      m_actions->push(action);
+      auto const it = std::find_if(
+          sessionEvents.events.rbegin(),
+          sessionEvents.events.rend(),
+          [subscriptionId](ScServerEvent const & event)
+          {
+            return event.subscriptionId == subscriptionId;
+          });
+      if (it != sessionEvents.events.rend())
+      {
+        it->message = msg;
+        ++m_eventsStatistics.coalescedEvents;
+      }
+      else
+        ++m_eventsStatistics.droppedEvents;
+    }
+    else
+    {
+      ++m_eventsStatistics.droppedEvents;
+      isOverflowed = m_eventsOverflowPolicy == ScServerEventsOverflowPolicy::Disconnect;
     }
-    m_actionCond.notify_one();
-  }
-  else
-  {
-    // TODO(NikitaZotov): sc-server should not know about it
-    sc_storage_start_new_process();
 
-    action->Emit();
-    delete action;
+    if (isOverflowed)
+    {
+      m_eventsStatistics.droppedEvents += sessionEvents.events.size();
+      ++m_eventsStatistics.disconnectedSessions;
+      m_sessionsEvents->erase(sessionEventsIt);
+    }
+    else if (sessionEvents.isSending == SC_FALSE && sessionEvents.isHeld == SC_FALSE)
+    {
+      sessionEvents.isSending = SC_TRUE;
+      PostSendEvents(sessionId);
+    }
+  }
 
-    sc_storage_end_new_process();
+  if (isOverflowed)
+  {
+    LogMessage(ScServerErrorLevel::warning, "Session doesn't read sc-event messages, it is disconnected");
+    try
+    {
+      CloseConnection(sessionId, websocketpp::close::status::try_again_later, "Sc-event messages queue is full");
+    }
+    catch (std::exception const & e)
+    {
+      LogMessage(ScServerErrorLevel::error, e.what());
+    }
   }
 }
 
-void ScServerImpl::OnEvent(ScServerSessionId const & sessionId, std::string const & msg)
+void ScServerImpl::HoldEvents(ScServerSessionId const & sessionId)
 {
-  ScServerLock connectionLock(m_connectionMutex);
   if (!IsSessionValid(sessionId))
     return;
 
+  ScServerLock eventsLock(m_eventsMutex);
+  auto const it = m_sessionsEvents->find(sessionId);
+  if (it != m_sessionsEvents->cend())
+    it->second.isHeld = SC_TRUE;
+}
+
+void ScServerImpl::RemoveSessionEvents(ScServerSessionId const & sessionId)
+{
+  ScServerLock eventsLock(m_eventsMutex);
+  m_sessionsEvents->erase(sessionId);
+}
+
+void ScServerImpl::ReleaseEvents(ScServerSessionId const & sessionId)
+{
+  ScServerLock eventsLock(m_eventsMutex);
+  auto const it = m_sessionsEvents->find(sessionId);
+  if (it == m_sessionsEvents->cend())
+    return;
+
+  ScServerSessionEvents & sessionEvents = it->second;
+  sessionEvents.isHeld = SC_FALSE;
+  if (sessionEvents.isSending == SC_FALSE && !sessionEvents.events.empty())
   {
-    ScServerLock actionLock(m_actionMutex);
-    m_actions->push(new ScServerEventCallbackAction(this, sessionId, msg));
+    sessionEvents.isSending = SC_TRUE;
+    PostSendEvents(sessionId);
+  }
+}
+
+void ScServerImpl::PostSendEvents(ScServerSessionId const & sessionId)
+{
+  asio::post(
+      m_instance->get_io_service(),
+      [this, sessionId]()
+      {
+        SendEvents(sessionId);
+      });
+}
+
+size_t ScServerImpl::GetBufferedAmount(ScServerSessionId const & sessionId)
+{
+  return m_instance->get_con_from_hdl(sessionId)->get_buffered_amount();
+}
+
+void ScServerImpl::SendEvents(ScServerSessionId const & sessionId)
+{
+  ScServerMessageType const type = GetMessageType(GetSessionFormat(sessionId));
+
+  while (true)
+  {
+    std::string message;
+    {
+      ScServerLock eventsLock(m_eventsMutex);
+      auto const it = m_sessionsEvents->find(sessionId);
+      if (it == m_sessionsEvents->cend())
+        return;
+
+      ScServerSessionEvents & sessionEvents = it->second;
+      // Held messages are sent when they are released
+      if (sessionEvents.events.empty() || sessionEvents.isHeld == SC_TRUE)
+      {
+        sessionEvents.isSending = SC_FALSE;
+        return;
+      }
+
+      size_t bufferedBytes;
+      try
+      {
+        bufferedBytes = GetBufferedAmount(sessionId);
+      }
+      catch (ScServerException const &)
+      {
+        m_sessionsEvents->erase(it);
+        return;
+      }
+
+      // Session has not read previous messages yet, try later and keep its messages queued
+      if (bufferedBytes > m_eventsMaxBufferedBytes)
+      {
+        m_instance->set_timer(
+            SC_SERVER_EVENTS_RETRY_PERIOD_MS,
+            [this, sessionId](websocketpp::lib::error_code const & errorCode)
+            {
+              if (!errorCode)
+                SendEvents(sessionId);
+            });
+        return;
+      }
+
+      message = std::move(sessionEvents.events.front().message);
+      sessionEvents.events.pop_front();
+      ++m_eventsStatistics.sentEvents;
+    }
+
+    try
+    {
+      Send(sessionId, message, type);
+    }
+    catch (std::exception const & e)
+    {
+      LogMessage(ScServerErrorLevel::error, e.what());
+    }
   }
-  m_actionCond.notify_one();
 }
 
 ScServerImpl::~ScServerImpl()
 {
   ScMemoryJsonActionsHandler::ClearActionClasses();
-  delete m_actions;
+
+  for (auto & it : *m_sessionsActions)
+  {
+    while (!it.second.actions.empty())
+    {
+      delete it.second.actions.front();
+      it.second.actions.pop();
+    }
+  }
+  delete m_sessionsActions;
+  delete m_readySessions;
+  delete m_sessionsEvents;
 }
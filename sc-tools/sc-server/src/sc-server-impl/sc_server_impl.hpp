@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include <list>
+
 #include "sc_server.hpp"
 
 using ScServerUniqueLock = std::unique_lock<ScServerMutex>;
@@ -13,35 +15,107 @@ using ScServerCondVar = std::condition_variable;
 
 using ScServerActions = std::queue<ScServerAction *>;
 
+/*!
+ * Pending actions of one session. The session is scheduled while it is placed in the ready sessions queue
+ * or while one of its actions is being emitted, so actions of one session are never emitted concurrently.
+ */
+struct ScServerSessionActions
+{
+  ScServerActions actions;
+  sc_bool isScheduled = SC_FALSE;
+};
+
+using ScServerSessionsActions =
+    std::map<ScServerSessionId, ScServerSessionActions, std::owner_less<ScServerSessionId>>;
+using ScServerReadySessions = std::queue<ScServerSessionId>;
+
+struct ScServerEvent
+{
+  size_t subscriptionId;
+  std::string message;
+};
+
+/*!
+ * Sc-event messages of one session waiting to be sent. They are sent from input-output threads while the session
+ * reads them fast enough, otherwise they stay in the queue and overflow policy is applied to new ones. Messages are
+ * held in the queue while the session subscribes to sc-events, so they aren't sent before the subscription response.
+ * The queue exists from opening of the session to its closing.
+ */
+struct ScServerSessionEvents
+{
+  std::list<ScServerEvent> events;
+  sc_bool isSending = SC_FALSE;
+  sc_bool isHeld = SC_FALSE;
+};
+
+using ScServerSessionsEvents = std::map<ScServerSessionId, ScServerSessionEvents, std::owner_less<ScServerSessionId>>;
+
 class ScServerImpl : public ScServer
 {
 public:
-  explicit ScServerImpl(std::string const & host, ScServerPort port, sc_bool parallelActions);
+  explicit ScServerImpl(
+      std::string const & host,
+      ScServerPort port,
+      sc_bool parallelActions,
+      size_t ioThreadsNum = 1,
+      size_t actionsThreadsNum = 1);
 
   void EmitActions() override;
 
   sc_bool IsWorkable() override;
 
+  void ConfigureEvents(size_t queueSize, ScServerEventsOverflowPolicy overflowPolicy, size_t maxBufferedBytes);
+
+  ScServerEventsStatistics GetEventsStatistics() override;
+
+  static ScServerEventsOverflowPolicy GetEventsOverflowPolicy(std::string const & policy);
+
   ~ScServerImpl() override;
 
 protected:
   ScServerMutex m_actionMutex;
   ScServerMutex m_connectionMutex;
   ScServerCondVar m_actionCond;
+  ScServerCondVar m_actionsEmptyCond;
   sc_bool m_parallelActions;
 
   std::atomic<sc_bool> m_actionsRun;
-  ScServerActions * m_actions;
+  size_t m_actionsCount;
+  ScServerSessionsActions * m_sessionsActions;
+  ScServerReadySessions * m_readySessions;
+
+  ScServerMutex m_eventsMutex;
+  size_t m_eventsQueueSize;
+  ScServerEventsOverflowPolicy m_eventsOverflowPolicy;
+  size_t m_eventsMaxBufferedBytes;
+  ScServerSessionsEvents * m_sessionsEvents;
+  ScServerEventsStatistics m_eventsStatistics;
 
   void Initialize() override;
 
   void AfterInitialize() override;
 
+  bool OnValidate(ScServerSessionId const & sessionId);
+
   void OnOpen(ScServerSessionId const & sessionId) override;
 
   void OnClose(ScServerSessionId const & sessionId) override;
 
   void OnMessage(ScServerSessionId const & sessionId, ScServerMessage const & msg) override;
 
-  void OnEvent(ScServerSessionId const & sessionId, std::string const & msg) override;
+  void OnEvent(ScServerSessionId const & sessionId, size_t subscriptionId, std::string const & msg) override;
+
+  void HoldEvents(ScServerSessionId const & sessionId) override;
+
+  void ReleaseEvents(ScServerSessionId const & sessionId) override;
+
+  void RemoveSessionEvents(ScServerSessionId const & sessionId) override;
+
+  void SendEvents(ScServerSessionId const & sessionId);
+
+  void PostSendEvents(ScServerSessionId const & sessionId);
+
+  virtual size_t GetBufferedAmount(ScServerSessionId const & sessionId);
+
+  void PushAction(ScServerSessionId const & sessionId, ScServerAction * action);
 };
@@ -25,30 +25,45 @@ public:
     : ScServerAction(sessionId)
     , m_server(server)
     , m_msg(std::move(msg))
+    , m_actionsHandler(nullptr)
+    , m_eventsHandler(nullptr)
   {
-    ScAgentContext * sessionCtx = m_server->GetSessionContext(sessionId);
-    m_actionsHandler = new ScMemoryJsonActionsHandler(server, sessionCtx);
-    m_eventsHandler = new ScMemoryJsonEventsHandler(server, sessionCtx);
   }
 
   void HandleEmit()
   {
-    std::string const & messageType = GetMessageType(m_msg);
+    m_format = m_server->GetSessionFormat(m_sessionId);
+    // Text frames are always json, so clients that do not know about binary formats can use any session.
+    ScServerMessageFormat const requestFormat =
+        m_msg->get_opcode() == ScServerMessageType::text ? ScServerMessageFormat::Json : m_format;
+    ScMemoryJsonPayload const & request = ScMemoryJsonPayloadFormat::Parse(m_msg->get_payload(), requestFormat);
+
+    std::string const & messageType = GetMessageType(request);
 
     if (IsHealthCheck(messageType))
       OnHealthCheck(m_sessionId, m_msg);
     else if (IsConnectionInfo(messageType))
       OnConnectionInfo(m_sessionId, m_msg);
+    else if (IsStatistics(messageType))
+      OnStatistics(m_sessionId, m_msg);
     else if (IsEvent(messageType))
-      OnEvent(m_sessionId, m_msg);
+      OnEvent(m_sessionId, request);
     else
-      OnAction(m_sessionId, m_msg);
+      OnAction(m_sessionId, request);
   }
 
   void Emit() override
   {
+    // Session context is resolved at emit time: connect action of this session is emitted before it.
+    if (!m_server->IsSessionValid(m_sessionId))
+      return;
+
     try
     {
+      ScAgentContext * sessionCtx = m_server->GetSessionContext(m_sessionId);
+      m_actionsHandler = new ScMemoryJsonActionsHandler(m_server, sessionCtx);
+      m_eventsHandler = new ScMemoryJsonEventsHandler(m_server, sessionCtx);
+
       HandleEmit();
     }
     catch (ScServerException const & e)
@@ -61,22 +76,34 @@ public:
     }
   }
 
-  void OnAction(ScServerSessionId const & sessionId, ScServerMessage const & msg)
+  void OnAction(ScServerSessionId const & sessionId, ScMemoryJsonPayload const & request)
   {
-    m_server->LogMessage(ScServerErrorLevel::debug, "[request] " + msg->get_payload());
-    auto const & responseText = m_actionsHandler->Handle(sessionId, msg->get_payload());
+    LogPayload("[request] ", request);
+    ScMemoryJsonPayload const & response = m_actionsHandler->Handle(sessionId, request);
 
-    m_server->LogMessage(ScServerErrorLevel::debug, "[response] " + responseText);
-    m_server->Send(sessionId, responseText, ScServerMessageType::text);
+    LogPayload("[response] ", response);
+    Send(sessionId, response);
   }
 
-  void OnEvent(ScServerSessionId const & sessionId, ScServerMessage const & msg)
+  void OnEvent(ScServerSessionId const & sessionId, ScMemoryJsonPayload const & request)
   {
-    m_server->LogMessage(ScServerErrorLevel::debug, "[event] " + msg->get_payload());
-    auto const & responseText = m_eventsHandler->Handle(sessionId, msg->get_payload());
+    LogPayload("[event] ", request);
+
+    // Sc-events of created subscriptions may be emitted before the response is sent, their messages wait for it
+    m_server->HoldEvents(sessionId);
+    try
+    {
+      ScMemoryJsonPayload const & response = m_eventsHandler->Handle(sessionId, request);
 
-    m_server->LogMessage(ScServerErrorLevel::debug, "[event response] " + responseText);
-    m_server->Send(sessionId, responseText, ScServerMessageType::text);
+      LogPayload("[event response] ", response);
+      Send(sessionId, response);
+    }
+    catch (...)
+    {
+      m_server->ReleaseEvents(sessionId);
+      throw;
+    }
+    m_server->ReleaseEvents(sessionId);
   }
 
   void OnHealthCheck(ScServerSessionId const & sessionId, ScServerMessage const &)
@@ -101,7 +128,7 @@ public:
       m_server->LogMessage(ScServerErrorLevel::info, "I've died...");
     }
 
-    m_server->Send(sessionId, response.dump(), ScServerMessageType::text);
+    Send(sessionId, response);
     m_server->CloseConnection(sessionId, websocketpp::close::status::normal, "Status checked");
   }
 
@@ -110,7 +137,21 @@ public:
     ScAddr const & userAddr = m_server->GetSessionContext(sessionId)->GetUser();
     ScMemoryJsonPayload response{{"connection_id", (sc_uint64)sessionId.lock().get()}, {"user_addr", userAddr.Hash()}};
 
-    m_server->Send(sessionId, response.dump(), ScServerMessageType::text);
+    Send(sessionId, response);
+  }
+
+  void OnStatistics(ScServerSessionId const & sessionId, ScServerMessage const &)
+  {
+    ScServerEventsStatistics const & statistics = m_server->GetEventsStatistics();
+    ScMemoryJsonPayload response{
+        {"events",
+         {{"queued", statistics.queuedEvents},
+          {"sent", statistics.sentEvents},
+          {"dropped", statistics.droppedEvents},
+          {"coalesced", statistics.coalescedEvents},
+          {"disconnected_sessions", statistics.disconnectedSessions}}}};
+
+    Send(sessionId, response);
   }
 
   ~ScServerMessageAction() override
@@ -122,17 +163,29 @@ public:
 protected:
   ScServer * m_server;
   ScServerMessage m_msg;
+  ScServerMessageFormat m_format = ScServerMessageFormat::Json;
 
   ScMemoryJsonHandler * m_actionsHandler;
   ScMemoryJsonHandler * m_eventsHandler;
 
-  static std::string GetMessageType(ScServerMessage const & msg)
+  void Send(ScServerSessionId const & sessionId, ScMemoryJsonPayload const & response)
   {
-    if (ScMemoryJsonPayload::accept(msg->get_payload()))
-    {
-      ScMemoryJsonPayload const & payload = ScMemoryJsonPayload::parse(msg->get_payload());
-      return payload.contains("type") ? payload["type"].get<std::string>() : "";
-    }
+    m_server->Send(
+        sessionId, ScMemoryJsonPayloadFormat::Dump(response, m_format), ScServer::GetMessageType(m_format));
+  }
+
+  void LogPayload(std::string const & prefix, ScMemoryJsonPayload const & payload)
+  {
+    if (m_format == ScServerMessageFormat::Json)
+      m_server->LogMessage(ScServerErrorLevel::debug, prefix + payload.dump());
+    else
+      m_server->LogMessage(ScServerErrorLevel::debug, prefix + "<binary payload>");
+  }
+
+  static std::string GetMessageType(ScMemoryJsonPayload const & payload)
+  {
+    if (payload.is_object() && payload.contains("type") && payload["type"].is_string())
+      return payload["type"].get<std::string>();
 
     return "";
   }
@@ -151,4 +204,9 @@ protected:
   {
     return messageType == "connection_info";
   }
+
+  static sc_bool IsStatistics(std::string const & messageType)
+  {
+    return messageType == "statistics";
+  }
 };
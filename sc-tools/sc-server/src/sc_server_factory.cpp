@@ -5,15 +5,42 @@
  */
 
 #include "sc_server_factory.hpp"
+
+#include <algorithm>
+#include <thread>
+
 #include "sc-server-impl/sc_server_logger_impl.hpp"
+#include "sc-server-impl/sc-memory-json/sc-memory-json-action/sc_memory_json_templates_manager.hpp"
 
 std::shared_ptr<ScServer> ScServerFactory::ConfigureScServer(ScParams const & serverParams)
 {
   sc_bool parallelActions = SC_TRUE;
   if (serverParams.Has("parallel_actions"))
     parallelActions = serverParams.Get<std::string>("parallel_actions") == "true";
-  std::unique_ptr<ScServer> server = std::unique_ptr<ScServer>(new ScServerImpl(
-      serverParams.Get<std::string>("host", "127.0.0.1"), serverParams.Get("port", 8090), parallelActions));
+
+  size_t const hardwareThreadsNum = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+  size_t const ioThreadsNum = serverParams.Get<size_t>("io_threads", (size_t)SC_SERVER_DEFAULT_IO_THREADS_NUM);
+  size_t const actionsThreadsNum = serverParams.Get<size_t>("actions_threads", hardwareThreadsNum);
+
+  auto * serverImpl = new ScServerImpl(
+      serverParams.Get<std::string>("host", "127.0.0.1"),
+      serverParams.Get("port", 8090),
+      parallelActions,
+      ioThreadsNum,
+      actionsThreadsNum);
+
+  size_t const eventsQueueSize =
+      serverParams.Get<size_t>("events_queue_size", (size_t)SC_SERVER_DEFAULT_EVENTS_QUEUE_SIZE);
+  ScServerEventsOverflowPolicy const eventsOverflowPolicy = ScServerImpl::GetEventsOverflowPolicy(
+      serverParams.Get<std::string>("events_overflow_policy", SC_SERVER_DROP_EVENTS_POLICY));
+  size_t const eventsMaxBufferedBytes =
+      serverParams.Get<size_t>("events_max_buffered_bytes", (size_t)SC_SERVER_DEFAULT_EVENTS_BUFFERED_BYTES);
+  serverImpl->ConfigureEvents(eventsQueueSize, eventsOverflowPolicy, eventsMaxBufferedBytes);
+
+  std::unique_ptr<ScServer> server = std::unique_ptr<ScServer>(serverImpl);
+
+  ScMemoryJsonTemplatesManager::GetInstance()->SetCapacity(
+      serverParams.Get<size_t>("prepared_templates_cache_size", (size_t)SC_SERVER_DEFAULT_PREPARED_TEMPLATES_NUM));
 
   return server;
 }
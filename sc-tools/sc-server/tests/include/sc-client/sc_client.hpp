@@ -9,11 +9,11 @@
 #include <nlohmann/json.hpp>
 
 #include "sc-server-impl/sc_server_defines.hpp"
+#include "sc-server-impl/sc_server.hpp"
+#include "sc-server-impl/sc-memory-json/sc_memory_json_payload.hpp"
 
 #include "sc_client_defines.hpp"
 
-using ScMemoryJsonPayload = nlohmann::json;
-
 class ScClient
 {
 public:
@@ -23,7 +23,7 @@ public:
     Initialize();
   }
 
-  sc_bool Connect(std::string const & uri)
+  sc_bool Connect(std::string const & uri, std::string const & subprotocol = "")
   {
     ScClientErrorCode code;
     m_connection = m_instance.get_connection(uri, code);
@@ -31,6 +31,12 @@ public:
     if (code.value())
       return SC_FALSE;
 
+    if (!subprotocol.empty())
+    {
+      m_connection->add_subprotocol(subprotocol);
+      m_format = ScServer::GetMessageFormat(subprotocol);
+    }
+
     m_instance.connect(m_connection);
 
     return SC_TRUE;
@@ -49,19 +55,36 @@ public:
     m_thread.join();
   }
 
-  sc_bool Send(std::string const & msg)
+  sc_bool Send(std::string const & msg, ScServerMessageType type = ScServerMessageType::text)
   {
     std::this_thread::sleep_for(std::chrono::milliseconds(400));
 
     ScClientErrorCode code;
-    m_instance.send(m_connection, msg, ScServerMessageType::text, code);
+    m_instance.send(m_connection, msg, type, code);
 
     return !code;
   }
 
+  sc_bool SendPayload(ScMemoryJsonPayload const & payload)
+  {
+    return Send(ScMemoryJsonPayloadFormat::Dump(payload, m_format), ScServer::GetMessageType(m_format));
+  }
+
+  sc_bool IsOpen() const
+  {
+    return m_connection->get_state() == websocketpp::session::state::open;
+  }
+
+  std::string GetSubprotocol() const
+  {
+    return m_connection->get_subprotocol();
+  }
+
   void OnMessage(ScServerSessionId const &, ScServerMessage const & msg)
   {
-    m_currentPayload = ScMemoryJsonPayload::parse(msg->get_payload());
+    ScServerMessageFormat const format =
+        msg->get_opcode() == ScServerMessageType::text ? ScServerMessageFormat::Json : m_format;
+    m_currentPayload = ScMemoryJsonPayloadFormat::Parse(msg->get_payload(), format);
     m_isNewMessage = SC_TRUE;
   }
 
@@ -85,6 +108,7 @@ private:
 
   sc_bool m_isNewMessage;
   ScMemoryJsonPayload m_currentPayload;
+  ScServerMessageFormat m_format = ScServerMessageFormat::Json;
 
   void Initialize()
   {
@@ -11,6 +11,8 @@
 #include <memory>
 #include <unordered_set>
 #include <filesystem>
+#include <functional>
+#include <limits>
 
 #include <sc-memory/sc_memory.hpp>
 #include <sc-memory/sc_keynodes.hpp>
@@ -51,7 +53,7 @@ protected:
     std::filesystem::remove_all(SC_SERVER_KB_BIN);
   }
 
-  void Initialize(sc_bool parallel_actions)
+  void Initialize(sc_bool parallel_actions, size_t ioThreadsNum = 1, size_t actionsThreadsNum = 1)
   {
     sc_memory_params params;
     sc_memory_params_clear(&params);
@@ -64,12 +66,20 @@ protected:
 
     ScMemory::LogMute();
     ScMemory::Initialize(params);
-    m_server = std::make_unique<ScServerImpl>("127.0.0.1", 8898, parallel_actions);
+    m_server = CreateServer(parallel_actions, ioThreadsNum, actionsThreadsNum);
     m_server->ClearChannels();
     m_server->Run();
     ScMemory::LogUnmute();
   }
 
+  virtual std::unique_ptr<ScServer> CreateServer(
+      sc_bool parallel_actions,
+      size_t ioThreadsNum,
+      size_t actionsThreadsNum)
+  {
+    return std::make_unique<ScServerImpl>("127.0.0.1", 8898, parallel_actions, ioThreadsNum, actionsThreadsNum);
+  }
+
   void Shutdown()
   {
     ScMemory::LogMute();
@@ -93,3 +103,100 @@ protected:
     m_ctx = std::make_unique<ScAgentContext>();
   }
 };
+
+class ScServerTestWithThreadPools : public ScServerTest
+{
+protected:
+  void SetUp() override
+  {
+    Initialize(SC_TRUE, 4, 4);
+    m_ctx = std::make_unique<ScAgentContext>();
+  }
+};
+
+//! Server that considers its sessions not reading sc-event messages until they are allowed to read
+class ScServerWithNotReadingSessions : public ScServerImpl
+{
+public:
+  using ScServerImpl::ScServerImpl;
+
+  void SetSessionsReading(sc_bool isReading)
+  {
+    m_isSessionsReading = isReading;
+  }
+
+  //! Sends sc-event message and holds sc-event messages of each session right after it is closed
+  void SetEventsAfterClose(sc_bool isEventsAfterClose)
+  {
+    m_isEventsAfterClose = isEventsAfterClose;
+  }
+
+  size_t GetClosedSessionsCount() const
+  {
+    return m_closedSessionsCount;
+  }
+
+  size_t GetSessionsEventsCount()
+  {
+    ScServerLock eventsLock(m_eventsMutex);
+    return m_sessionsEvents->size();
+  }
+
+protected:
+  std::atomic<sc_bool> m_isSessionsReading = SC_TRUE;
+  std::atomic<sc_bool> m_isEventsAfterClose = SC_FALSE;
+  std::atomic<size_t> m_closedSessionsCount = 0;
+
+  void OnClose(ScServerSessionId const & sessionId) override
+  {
+    ScServerImpl::OnClose(sessionId);
+
+    // Disconnect action of session is not emitted yet usually, so session is still valid
+    if (m_isEventsAfterClose == SC_TRUE)
+    {
+      OnEvent(sessionId, 0, "{}");
+      HoldEvents(sessionId);
+    }
+    ++m_closedSessionsCount;
+  }
+
+  size_t GetBufferedAmount(ScServerSessionId const & sessionId) override
+  {
+    // Buffers of sessions that don't read are always full
+    if (m_isSessionsReading == SC_FALSE)
+      return std::numeric_limits<size_t>::max();
+
+    return ScServerImpl::GetBufferedAmount(sessionId);
+  }
+};
+
+class ScServerTestWithNotReadingSessions : public ScServerTest
+{
+protected:
+  std::unique_ptr<ScServer> CreateServer(
+      sc_bool parallel_actions,
+      size_t ioThreadsNum,
+      size_t actionsThreadsNum) override
+  {
+    return std::make_unique<ScServerWithNotReadingSessions>(
+        "127.0.0.1", 8898, parallel_actions, ioThreadsNum, actionsThreadsNum);
+  }
+
+  ScServerWithNotReadingSessions * GetServer()
+  {
+    return static_cast<ScServerWithNotReadingSessions *>(m_server.get());
+  }
+
+  ScServerEventsStatistics WaitEventsStatistics(
+      std::function<sc_bool(ScServerEventsStatistics const &)> const & isReached)
+  {
+    ScServerEventsStatistics statistics = m_server->GetEventsStatistics();
+    for (size_t i = 0; i < 100 && !isReached(statistics); ++i)
+    {
+      std::this_thread::sleep_for(std::chrono::milliseconds(50));
+      statistics = m_server->GetEventsStatistics();
+    }
+
+    return statistics;
+  }
+};
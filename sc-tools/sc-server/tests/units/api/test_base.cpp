@@ -6,6 +6,8 @@
 
 #include "sc_server_test.hpp"
 
+#include <limits>
+
 extern "C"
 {
 #include <sc-core/sc_types.h>
@@ -17,6 +19,8 @@ extern "C"
 
 #include "sc-client/sc_memory_json_converter.hpp"
 
+#include "sc-server-impl/sc-memory-json/sc-memory-json-action/sc_memory_json_keynodes_cache.hpp"
+
 TEST_F(ScServerTest, GenerateElements)
 {
   ScClient client;
@@ -1527,6 +1531,306 @@ TEST_F(ScServerTest, SearchTemplateByAddr)
   client.Stop();
 }
 
+TEST_F(ScServerTest, PrepareAndSearchTemplate)
+{
+  ScAddr const & addr1 = m_ctx->ResolveElementSystemIdentifier("node1", ScType::ConstNode);
+  ScAddr const & addr2 = m_ctx->ResolveElementSystemIdentifier("node2", ScType::ConstNode);
+  ScAddr const & addr3 = m_ctx->ResolveElementSystemIdentifier("node3", ScType::ConstNode);
+  ScAddr const & nonRoleAddr = m_ctx->ResolveElementSystemIdentifier("nonRole1", ScType::ConstNodeNonRole);
+
+  m_ctx->GenerateConnector(
+      ScType::ConstPermPosArc, nonRoleAddr, m_ctx->GenerateConnector(ScType::ConstCommonArc, addr1, addr2));
+  m_ctx->GenerateConnector(
+      ScType::ConstPermPosArc, nonRoleAddr, m_ctx->GenerateConnector(ScType::ConstCommonArc, addr3, addr2));
+
+  ScClient client;
+  EXPECT_TRUE(client.Connect(m_server->GetUri()));
+  client.Run();
+
+  ScMemoryJsonPayload preparePayload;
+  preparePayload["templ"] = "@alias = (_node1 _=> _node2);; nonRole1 _-> @alias;;";
+  EXPECT_TRUE(client.Send(ScMemoryJsonConverter::From(0, "prepare_template", preparePayload)));
+
+  auto response = client.GetResponseMessage();
+  EXPECT_TRUE(response["status"].get<sc_bool>());
+  size_t const handle = response["payload"]["handle"].get<size_t>();
+
+  EXPECT_TRUE(client.Send(ScMemoryJsonConverter::From(1, "prepare_template", preparePayload)));
+  response = client.GetResponseMessage();
+  EXPECT_EQ(response["payload"]["handle"].get<size_t>(), handle);
+
+  ScMemoryJsonPayload payload;
+  payload["handle"] = handle;
+  EXPECT_TRUE(client.Send(ScMemoryJsonConverter::From(2, "search_template", payload)));
+
+  response = client.GetResponseMessage();
+  EXPECT_TRUE(response["status"].get<sc_bool>());
+  EXPECT_EQ(response["payload"]["addrs"].size(), 2u);
+
+  payload["params"]["_node1"] = addr3.Hash();
+  EXPECT_TRUE(client.Send(ScMemoryJsonConverter::From(3, "search_template", payload)));
+
+  response = client.GetResponseMessage();
+  EXPECT_TRUE(response["status"].get<sc_bool>());
+  EXPECT_EQ(response["payload"]["addrs"].size(), 1u);
+  auto const & addrs = response["payload"]["addrs"][0].get<std::vector<size_t>>();
+  EXPECT_TRUE(ScAddr(addrs[0]) == addr3);
+  EXPECT_TRUE(ScAddr(addrs[2]) == addr2);
+
+  client.Stop();
+}
+
+TEST_F(ScServerTest, PrepareAndSearchVarTemplateByParams)
+{
+  ScAddr const & addr1 = m_ctx->GenerateNode(ScType::ConstNode);
+  ScAddr const & addr2 = m_ctx->GenerateNode(ScType::ConstNode);
+  ScAddr const & arcAddr = m_ctx->GenerateConnector(ScType::ConstPermPosArc, addr1, addr2);
+  m_ctx->GenerateConnector(ScType::ConstPermPosArc, addr2, addr1);
+
+  ScClient client;
+  EXPECT_TRUE(client.Connect(m_server->GetUri()));
+  client.Run();
+
+  ScMemoryJsonPayload preparePayload;
+  preparePayload["templ"] = "_src _-> _trg;;";
+  EXPECT_TRUE(client.Send(ScMemoryJsonConverter::From(0, "prepare_template", preparePayload)));
+
+  auto response = client.GetResponseMessage();
+  EXPECT_TRUE(response["status"].get<sc_bool>());
+
+  ScMemoryJsonPayload payload;
+  payload["handle"] = response["payload"]["handle"];
+  payload["params"]["_src"] = addr1.Hash();
+  payload["params"]["_trg"] = addr2.Hash();
+  EXPECT_TRUE(client.Send(ScMemoryJsonConverter::From(1, "search_template", payload)));
+
+  response = client.GetResponseMessage();
+  EXPECT_TRUE(response["status"].get<sc_bool>());
+  EXPECT_EQ(response["payload"]["addrs"].size(), 1u);
+  auto const & addrs = response["payload"]["addrs"][0].get<std::vector<size_t>>();
+  EXPECT_TRUE(ScAddr(addrs[0]) == addr1);
+  EXPECT_TRUE(ScAddr(addrs[1]) == arcAddr);
+  EXPECT_TRUE(ScAddr(addrs[2]) == addr2);
+
+  client.Stop();
+}
+
+TEST_F(ScServerTest, PrepareAndSearchTemplateByIdentifierParams)
+{
+  ScAddr addr1 = m_ctx->ResolveElementSystemIdentifier("prepared_src", ScType::ConstNode);
+  ScAddr arcAddr = m_ctx->GenerateConnector(ScType::ConstPermPosArc, addr1, m_ctx->GenerateNode(ScType::ConstNode));
+
+  {
+    ScClient client;
+    EXPECT_TRUE(client.Connect(m_server->GetUri()));
+    client.Run();
+
+    ScMemoryJsonPayload preparePayload;
+    preparePayload["templ"] = "_src _-> _trg;;";
+    EXPECT_TRUE(client.Send(ScMemoryJsonConverter::From(0, "prepare_template", preparePayload)));
+
+    auto response = client.GetResponseMessage();
+    EXPECT_TRUE(response["status"].get<sc_bool>());
+
+    ScMemoryJsonPayload payload;
+    payload["handle"] = response["payload"]["handle"];
+    payload["params"]["_src"] = "prepared_src";
+    EXPECT_TRUE(client.Send(ScMemoryJsonConverter::From(1, "search_template", payload)));
+
+    response = client.GetResponseMessage();
+    EXPECT_TRUE(response["status"].get<sc_bool>());
+    EXPECT_EQ(response["payload"]["addrs"].size(), 1u);
+    EXPECT_TRUE(ScAddr(response["payload"]["addrs"][0][1].get<size_t>()) == arcAddr);
+    // Identifier of parameter is cached for the session
+    EXPECT_EQ(ScMemoryJsonKeynodesCache::GetInstance()->Size(), 1u);
+
+    // Cached identifier is found again after its sc-element is changed
+    EXPECT_TRUE(m_ctx->EraseElement(addr1));
+    addr1 = m_ctx->ResolveElementSystemIdentifier("prepared_src", ScType::ConstNode);
+    arcAddr = m_ctx->GenerateConnector(ScType::ConstPermPosArc, addr1, m_ctx->GenerateNode(ScType::ConstNode));
+    EXPECT_TRUE(client.Send(ScMemoryJsonConverter::From(2, "search_template", payload)));
+
+    response = client.GetResponseMessage();
+    EXPECT_TRUE(response["status"].get<sc_bool>());
+    EXPECT_EQ(response["payload"]["addrs"].size(), 1u);
+    EXPECT_TRUE(ScAddr(response["payload"]["addrs"][0][1].get<size_t>()) == arcAddr);
+
+    client.Stop();
+  }
+
+  // Cache of session is removed when it is disconnected
+  for (size_t i = 0; i < 100 && ScMemoryJsonKeynodesCache::GetInstance()->Size() != 0; ++i)
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  EXPECT_EQ(ScMemoryJsonKeynodesCache::GetInstance()->Size(), 0u);
+}
+
+TEST_F(ScServerTest, PrepareTemplateAndEraseItsElement)
+{
+  ScAddr addr1 = m_ctx->ResolveElementSystemIdentifier("prepared_node", ScType::ConstNode);
+  m_ctx->GenerateConnector(ScType::ConstPermPosArc, addr1, m_ctx->GenerateNode(ScType::ConstNode));
+
+  ScClient client;
+  EXPECT_TRUE(client.Connect(m_server->GetUri()));
+  client.Run();
+
+  ScMemoryJsonPayload preparePayload;
+  preparePayload["templ"] = "prepared_node _-> _trg;;";
+  EXPECT_TRUE(client.Send(ScMemoryJsonConverter::From(0, "prepare_template", preparePayload)));
+
+  auto response = client.GetResponseMessage();
+  EXPECT_TRUE(response["status"].get<sc_bool>());
+
+  EXPECT_TRUE(m_ctx->EraseElement(addr1));
+  addr1 = m_ctx->ResolveElementSystemIdentifier("prepared_node", ScType::ConstNode);
+  ScAddr const & addr2 = m_ctx->GenerateNode(ScType::ConstNode);
+  m_ctx->GenerateConnector(ScType::ConstPermPosArc, addr1, addr2);
+
+  ScMemoryJsonPayload payload;
+  payload["handle"] = response["payload"]["handle"];
+  EXPECT_TRUE(client.Send(ScMemoryJsonConverter::From(1, "search_template", payload)));
+
+  response = client.GetResponseMessage();
+  EXPECT_TRUE(response["status"].get<sc_bool>());
+  EXPECT_EQ(response["payload"]["addrs"].size(), 1u);
+  auto const & addrs = response["payload"]["addrs"][0].get<std::vector<size_t>>();
+  EXPECT_TRUE(ScAddr(addrs[0]) == addr1);
+  EXPECT_TRUE(ScAddr(addrs[2]) == addr2);
+
+  client.Stop();
+}
+
+TEST_F(ScServerTest, PrepareAndGenerateTemplate)
+{
+  ScAddr const & addr = m_ctx->GenerateNode(ScType::ConstNode);
+
+  ScClient client;
+  EXPECT_TRUE(client.Connect(m_server->GetUri()));
+  client.Run();
+
+  ScMemoryJsonPayload preparePayload;
+  preparePayload["templ"] = "_src _-> _trg;;";
+  EXPECT_TRUE(client.Send(ScMemoryJsonConverter::From(0, "prepare_template", preparePayload)));
+
+  auto response = client.GetResponseMessage();
+  EXPECT_TRUE(response["status"].get<sc_bool>());
+
+  ScMemoryJsonPayload payload;
+  payload["handle"] = response["payload"]["handle"];
+  payload["params"]["_src"] = addr.Hash();
+  EXPECT_TRUE(client.Send(ScMemoryJsonConverter::From(1, "generate_template", payload)));
+
+  response = client.GetResponseMessage();
+  EXPECT_TRUE(response["status"].get<sc_bool>());
+  auto const & addrs = response["payload"]["addrs"].get<std::vector<size_t>>();
+  EXPECT_EQ(addrs.size(), 3u);
+  EXPECT_TRUE(ScAddr(addrs[0]) == addr);
+  EXPECT_TRUE(m_ctx->CheckConnector(addr, ScAddr(addrs[2]), ScType::ConstPermPosArc));
+
+  client.Stop();
+}
+
+TEST_F(ScServerTest, SearchTemplateByUnknownHandle)
+{
+  ScClient client;
+  EXPECT_TRUE(client.Connect(m_server->GetUri()));
+  client.Run();
+
+  ScMemoryJsonPayload payload;
+  payload["handle"] = std::numeric_limits<size_t>::max();
+  EXPECT_TRUE(client.Send(ScMemoryJsonConverter::From(0, "search_template", payload)));
+
+  auto const response = client.GetResponseMessage();
+  EXPECT_FALSE(response["status"].get<sc_bool>());
+  EXPECT_FALSE(response["errors"].empty());
+
+  client.Stop();
+}
+
+TEST_F(ScServerTest, BatchWithReferences)
+{
+  ScClient client;
+  EXPECT_TRUE(client.Connect(m_server->GetUri()));
+  client.Run();
+
+  ScMemoryJsonPayload const payload = ScMemoryJsonPayload::array({
+      {
+          {"type", "create_elements"},
+          {"payload",
+           ScMemoryJsonPayload::array({
+               {
+                   {"el", "node"},
+                   {"type", sc_type_node | sc_type_const},
+               },
+               {
+                   {"el", "node"},
+                   {"type", sc_type_node | sc_type_const},
+               },
+           })},
+      },
+      {
+          {"type", "create_elements"},
+          {"payload",
+           ScMemoryJsonPayload::array({
+               {
+                   {"el", "edge"},
+                   {"src", {{"type", "addr"}, {"value", {{"$ref", "/0/0"}}}}},
+                   {"trg", {{"type", "addr"}, {"value", {{"$ref", "/0/1"}}}}},
+                   {"type", sc_type_const_perm_pos_arc},
+               },
+           })},
+      },
+      {
+          {"type", "check_elements"},
+          {"payload", ScMemoryJsonPayload::array({{{"$ref", "/1/0"}}})},
+      },
+  });
+  EXPECT_TRUE(client.Send(ScMemoryJsonConverter::From(0, "batch", payload)));
+
+  auto const response = client.GetResponseMessage();
+  EXPECT_TRUE(response["status"].get<sc_bool>());
+  EXPECT_TRUE(response["errors"].empty());
+
+  auto const & responsePayload = response["payload"];
+  EXPECT_EQ(responsePayload.size(), 3u);
+  for (auto const & subresponse : responsePayload)
+    EXPECT_TRUE(subresponse["status"].get<sc_bool>());
+
+  ScAddr const & sourceAddr = ScAddr(responsePayload[0]["payload"][0].get<size_t>());
+  ScAddr const & targetAddr = ScAddr(responsePayload[0]["payload"][1].get<size_t>());
+  ScAddr const & arcAddr = ScAddr(responsePayload[1]["payload"][0].get<size_t>());
+  EXPECT_EQ(m_ctx->GetArcSourceElement(arcAddr), sourceAddr);
+  EXPECT_EQ(m_ctx->GetArcTargetElement(arcAddr), targetAddr);
+  EXPECT_EQ(responsePayload[2]["payload"][0].get<size_t>(), sc_type_const_perm_pos_arc);
+
+  client.Stop();
+}
+
+TEST_F(ScServerTest, BatchWithInvalidReference)
+{
+  ScClient client;
+  EXPECT_TRUE(client.Connect(m_server->GetUri()));
+  client.Run();
+
+  ScMemoryJsonPayload const payload = ScMemoryJsonPayload::array({
+      {
+          {"type", "check_elements"},
+          {"payload", ScMemoryJsonPayload::array({{{"$ref", "/5/0"}}})},
+      },
+      {
+          {"type", "connection_info"},
+          {"payload", ScMemoryJsonPayload::object()},
+      },
+  });
+  EXPECT_TRUE(client.Send(ScMemoryJsonConverter::From(0, "batch", payload)));
+
+  auto const response = client.GetResponseMessage();
+  EXPECT_FALSE(response["status"].get<sc_bool>());
+  EXPECT_FALSE(response["payload"][0]["status"].get<sc_bool>());
+  EXPECT_FALSE(response["payload"][1]["status"].get<sc_bool>());
+
+  client.Stop();
+}
+
 TEST_F(ScServerTest, GenerateTemplate)
 {
   ScAddr const & addr = m_ctx->GenerateNode(ScType::ConstNode);
@@ -1770,6 +2074,258 @@ TEST_F(ScServerTest, HandleEvents)
   client.Stop();
 }
 
+TEST_F(ScServerTest, HandleEventsAndGetStatistics)
+{
+  ScClient client;
+  EXPECT_TRUE(client.Connect(m_server->GetUri()));
+  client.Run();
+
+  ScAddr const & addr1 = m_ctx->GenerateNode(ScType::ConstNode);
+
+  std::string const payloadString = ScMemoryJsonConverter::From(
+      0,
+      "events",
+      ScMemoryJsonPayload::object({{
+          "create",
+          ScMemoryJsonPayload::array({
+              {
+                  {"type", "sc_event_after_generate_outgoing_arc"},
+                  {"addr", addr1.Hash()},
+              },
+          }),
+      }}));
+  EXPECT_TRUE(client.Send(payloadString));
+  auto response = client.GetResponseMessage();
+  EXPECT_TRUE(response["status"].get<sc_bool>());
+
+  ScAddr const & addr2 = m_ctx->GenerateNode(ScType::ConstNode);
+  m_ctx->GenerateConnector(ScType::ConstPermPosArc, addr1, addr2);
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+  response = client.GetResponseMessage();
+  EXPECT_TRUE(response["event"].get<sc_bool>());
+
+  EXPECT_TRUE(client.Send(R"({"type": "statistics"})"));
+  response = client.GetResponseMessage();
+  auto const & eventsStatistics = response["events"];
+  EXPECT_EQ(eventsStatistics["queued"].get<size_t>(), 0u);
+  EXPECT_GE(eventsStatistics["sent"].get<size_t>(), 1u);
+  EXPECT_EQ(eventsStatistics["dropped"].get<size_t>(), 0u);
+  EXPECT_EQ(eventsStatistics["disconnected_sessions"].get<size_t>(), 0u);
+
+  client.Stop();
+}
+
+TEST_F(ScServerTest, HandleEventsOfConnectorsGeneratedWhileSubscribing)
+{
+  ScClient client;
+  EXPECT_TRUE(client.Connect(m_server->GetUri()));
+  client.Run();
+
+  ScAddr const & addr1 = m_ctx->GenerateNode(ScType::ConstNode);
+
+  std::atomic<sc_bool> isGenerating = SC_TRUE;
+  std::thread generator(
+      [&addr1, &isGenerating]()
+      {
+        ScAgentContext context;
+        while (isGenerating)
+        {
+          ScAddr const & addr2 = context.GenerateNode(ScType::ConstNode);
+          context.GenerateConnector(ScType::ConstPermPosArc, addr1, addr2);
+        }
+      });
+
+  std::string const payloadString = ScMemoryJsonConverter::From(
+      0,
+      "events",
+      ScMemoryJsonPayload::object({{
+          "create",
+          ScMemoryJsonPayload::array({
+              {
+                  {"type", "sc_event_after_generate_outgoing_arc"},
+                  {"addr", addr1.Hash()},
+              },
+          }),
+      }}));
+  EXPECT_TRUE(client.Send(payloadString));
+
+  // Sc-event messages of subscription are sent after its response
+  auto const response = client.GetResponseMessage();
+  EXPECT_FALSE(response["event"].get<sc_bool>());
+  EXPECT_TRUE(response["status"].get<sc_bool>());
+
+  isGenerating = SC_FALSE;
+  generator.join();
+
+  client.Stop();
+}
+
+namespace
+{
+void SubscribeToOutgoingArcs(ScClient & client, ScAddr const & addr)
+{
+  std::string const payloadString = ScMemoryJsonConverter::From(
+      0,
+      "events",
+      ScMemoryJsonPayload::object({{
+          "create",
+          ScMemoryJsonPayload::array({
+              {
+                  {"type", "sc_event_after_generate_outgoing_arc"},
+                  {"addr", addr.Hash()},
+              },
+          }),
+      }}));
+  EXPECT_TRUE(client.Send(payloadString));
+
+  auto const response = client.GetResponseMessage();
+  EXPECT_TRUE(response["status"].get<sc_bool>());
+}
+
+void GenerateOutgoingArcs(std::unique_ptr<ScAgentContext> const & context, ScAddr const & addr, size_t count)
+{
+  for (size_t i = 0; i < count; ++i)
+    context->GenerateConnector(ScType::ConstPermPosArc, addr, context->GenerateNode(ScType::ConstNode));
+}
+}  // namespace
+
+TEST_F(ScServerTestWithNotReadingSessions, DropEventsAndSendQueuedOnesWhenSessionReads)
+{
+  GetServer()->ConfigureEvents(2, ScServerEventsOverflowPolicy::Drop, SC_SERVER_DEFAULT_EVENTS_BUFFERED_BYTES);
+
+  ScClient client;
+  EXPECT_TRUE(client.Connect(m_server->GetUri()));
+  client.Run();
+
+  ScAddr const & addr = m_ctx->GenerateNode(ScType::ConstNode);
+  SubscribeToOutgoingArcs(client, addr);
+
+  GetServer()->SetSessionsReading(SC_FALSE);
+  GenerateOutgoingArcs(m_ctx, addr, 5);
+
+  ScServerEventsStatistics statistics = WaitEventsStatistics(
+      [](ScServerEventsStatistics const & current)
+      {
+        return current.queuedEvents + current.droppedEvents == 5;
+      });
+  EXPECT_EQ(statistics.queuedEvents, 2u);
+  EXPECT_EQ(statistics.droppedEvents, 3u);
+  EXPECT_EQ(statistics.sentEvents, 0u);
+
+  // Queued messages are sent by retry after the session reads again
+  GetServer()->SetSessionsReading(SC_TRUE);
+  EXPECT_TRUE(client.GetResponseMessage()["event"].get<sc_bool>());
+  EXPECT_TRUE(client.GetResponseMessage()["event"].get<sc_bool>());
+
+  statistics = WaitEventsStatistics(
+      [](ScServerEventsStatistics const & current)
+      {
+        return current.sentEvents == 2;
+      });
+  EXPECT_EQ(statistics.queuedEvents, 0u);
+  EXPECT_EQ(statistics.sentEvents, 2u);
+  EXPECT_EQ(statistics.droppedEvents, 3u);
+  EXPECT_EQ(statistics.disconnectedSessions, 0u);
+  EXPECT_TRUE(client.IsOpen());
+
+  client.Stop();
+}
+
+TEST_F(ScServerTestWithNotReadingSessions, CoalesceEventsOfNotReadingSession)
+{
+  GetServer()->ConfigureEvents(1, ScServerEventsOverflowPolicy::Coalesce, SC_SERVER_DEFAULT_EVENTS_BUFFERED_BYTES);
+
+  ScClient client;
+  EXPECT_TRUE(client.Connect(m_server->GetUri()));
+  client.Run();
+
+  ScAddr const & addr = m_ctx->GenerateNode(ScType::ConstNode);
+  SubscribeToOutgoingArcs(client, addr);
+
+  GetServer()->SetSessionsReading(SC_FALSE);
+  GenerateOutgoingArcs(m_ctx, addr, 3);
+
+  ScServerEventsStatistics statistics = WaitEventsStatistics(
+      [](ScServerEventsStatistics const & current)
+      {
+        return current.queuedEvents + current.coalescedEvents == 3;
+      });
+  EXPECT_EQ(statistics.queuedEvents, 1u);
+  EXPECT_EQ(statistics.coalescedEvents, 2u);
+  EXPECT_EQ(statistics.droppedEvents, 0u);
+
+  GetServer()->SetSessionsReading(SC_TRUE);
+  EXPECT_TRUE(client.GetResponseMessage()["event"].get<sc_bool>());
+
+  statistics = WaitEventsStatistics(
+      [](ScServerEventsStatistics const & current)
+      {
+        return current.sentEvents == 1;
+      });
+  EXPECT_EQ(statistics.queuedEvents, 0u);
+  EXPECT_EQ(statistics.sentEvents, 1u);
+
+  client.Stop();
+}
+
+TEST_F(ScServerTestWithNotReadingSessions, DisconnectNotReadingSession)
+{
+  GetServer()->ConfigureEvents(1, ScServerEventsOverflowPolicy::Disconnect, SC_SERVER_DEFAULT_EVENTS_BUFFERED_BYTES);
+
+  ScClient client;
+  EXPECT_TRUE(client.Connect(m_server->GetUri()));
+  client.Run();
+
+  ScAddr const & addr = m_ctx->GenerateNode(ScType::ConstNode);
+  SubscribeToOutgoingArcs(client, addr);
+
+  GetServer()->SetSessionsReading(SC_FALSE);
+  GenerateOutgoingArcs(m_ctx, addr, 2);
+
+  ScServerEventsStatistics const statistics = WaitEventsStatistics(
+      [](ScServerEventsStatistics const & current)
+      {
+        return current.disconnectedSessions == 1;
+      });
+  EXPECT_EQ(statistics.disconnectedSessions, 1u);
+  EXPECT_EQ(statistics.queuedEvents, 0u);
+  EXPECT_EQ(statistics.droppedEvents, 2u);
+  EXPECT_EQ(statistics.sentEvents, 0u);
+
+  for (size_t i = 0; i < 100 && client.IsOpen(); ++i)
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  EXPECT_FALSE(client.IsOpen());
+
+  client.Stop();
+}
+
+TEST_F(ScServerTestWithNotReadingSessions, DropEventsOfClosedSession)
+{
+  GetServer()->SetEventsAfterClose(SC_TRUE);
+
+  {
+    ScClient client;
+    EXPECT_TRUE(client.Connect(m_server->GetUri()));
+    client.Run();
+
+    for (size_t i = 0; i < 100 && GetServer()->GetSessionsEventsCount() == 0; ++i)
+      std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_EQ(GetServer()->GetSessionsEventsCount(), 1u);
+
+    client.Stop();
+  }
+
+  for (size_t i = 0; i < 100 && (GetServer()->GetClosedSessionsCount() == 0 || m_server->IsWorkable()); ++i)
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  EXPECT_EQ(GetServer()->GetClosedSessionsCount(), 1u);
+  EXPECT_EQ(GetServer()->GetSessionsEventsCount(), 0u);
+
+  ScServerEventsStatistics const statistics = m_server->GetEventsStatistics();
+  EXPECT_EQ(statistics.queuedEvents, 0u);
+  EXPECT_EQ(statistics.sentEvents, 0u);
+}
+
 TEST_F(ScServerTest, UnknownEvent)
 {
   ScClient client;
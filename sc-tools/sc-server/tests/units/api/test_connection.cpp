@@ -8,6 +8,11 @@
 
 #include <cstdlib>
 
+extern "C"
+{
+#include <sc-core/sc_types.h>
+}
+
 #include <sc-config/sc_options.hpp>
 #include <sc-config/sc_config.hpp>
 #include <sc-config/sc_memory_config.hpp>
@@ -129,6 +134,118 @@ TEST_F(ScServerTestWithoutParallelMode, HealthcheckOK)
   client.Stop();
 }
 
+TEST_F(ScServerTestWithThreadPools, HealthcheckOK)
+{
+  ScClient client;
+  EXPECT_TRUE(client.Connect(m_server->GetUri()));
+  client.Run();
+
+  std::string const payloadString = R"({"type": "healthcheck"})";
+  EXPECT_TRUE(client.Send(payloadString));
+
+  auto const response = client.GetResponseMessage();
+  EXPECT_FALSE(response.is_null());
+  EXPECT_EQ(response.get<std::string>(), "OK");
+
+  client.Stop();
+}
+
+TEST_F(ScServerTestWithThreadPools, SeveralClientsGetUsers)
+{
+  size_t const CLIENTS = 8;
+  std::vector<std::unique_ptr<ScClient>> clients;
+  for (size_t i = 0; i < CLIENTS; ++i)
+  {
+    auto client = std::make_unique<ScClient>();
+    EXPECT_TRUE(client->Connect(m_server->GetUri()));
+    client->Run();
+    clients.push_back(std::move(client));
+  }
+
+  std::vector<std::thread> threads;
+  for (auto & client : clients)
+  {
+    threads.emplace_back(
+        [&client]()
+        {
+          std::string const payloadString = R"({"type": "connection_info"})";
+          EXPECT_TRUE(client->Send(payloadString));
+
+          auto const response = client->GetResponseMessage();
+          EXPECT_FALSE(response.is_null());
+          ScAddr const & userAddr = ScAddr(response["user_addr"].get<sc_addr_hash>());
+          EXPECT_TRUE(userAddr.IsValid());
+        });
+  }
+
+  for (auto & thread : threads)
+    thread.join();
+
+  for (auto & client : clients)
+    client->Stop();
+}
+
+TEST_F(ScServerTest, ConnectAndGetUserByCbor)
+{
+  ScClient client;
+  EXPECT_TRUE(client.Connect(m_server->GetUri(), SC_SERVER_CBOR_SUBPROTOCOL));
+  client.Run();
+
+  EXPECT_TRUE(client.SendPayload({{"type", "connection_info"}}));
+
+  auto const response = client.GetResponseMessage();
+  EXPECT_EQ(client.GetSubprotocol(), SC_SERVER_CBOR_SUBPROTOCOL);
+
+  EXPECT_FALSE(response.is_null());
+  ScAddr const & userAddr = ScAddr(response["user_addr"].get<sc_addr_hash>());
+  EXPECT_TRUE(userAddr.IsValid());
+  client.Stop();
+}
+
+TEST_F(ScServerTest, GenerateElementsByMessagePack)
+{
+  ScClient client;
+  EXPECT_TRUE(client.Connect(m_server->GetUri(), SC_SERVER_MSGPACK_SUBPROTOCOL));
+  client.Run();
+
+  ScMemoryJsonPayload const request = {
+      {"id", 0},
+      {"type", "create_elements"},
+      {"payload",
+       ScMemoryJsonPayload::array({
+           {
+               {"el", "node"},
+               {"type", sc_type_node | sc_type_const},
+           },
+       })}};
+  EXPECT_TRUE(client.SendPayload(request));
+
+  auto const response = client.GetResponseMessage();
+  EXPECT_EQ(client.GetSubprotocol(), SC_SERVER_MSGPACK_SUBPROTOCOL);
+  EXPECT_FALSE(response.is_null());
+  EXPECT_TRUE(response["status"].get<sc_bool>());
+
+  ScAddr const & nodeAddr = ScAddr(response["payload"][0].get<size_t>());
+  EXPECT_TRUE(m_ctx->GetElementType(nodeAddr).IsNode());
+  client.Stop();
+}
+
+TEST_F(ScServerTest, SendJsonTextToMessagePackSession)
+{
+  ScClient client;
+  EXPECT_TRUE(client.Connect(m_server->GetUri(), SC_SERVER_MSGPACK_SUBPROTOCOL));
+  client.Run();
+
+  std::string const payloadString = R"({"type": "connection_info"})";
+  EXPECT_TRUE(client.Send(payloadString));
+
+  auto const response = client.GetResponseMessage();
+  EXPECT_FALSE(response.is_null());
+  ScAddr const & userAddr = ScAddr(response["user_addr"].get<sc_addr_hash>());
+  EXPECT_TRUE(userAddr.IsValid());
+  client.Stop();
+}
+
 void TEST_N_CONNECTIONS(std::unique_ptr<ScServer> const & server, size_t const amount)
 {
   size_t const CONNECTIONS = amount;